@@ -18,6 +18,14 @@ def _configure_argument_parser():
                              "Valid options are 'CPU', 'CUDA', 'OPTIX', 'HIP', 'ONEAPI', or 'METAL'."
                              "Additionally, you can append '+CPU' to any GPU type for hybrid rendering.",
                         default=None)
+    parser.add_argument("--cycles-sample-chunks",
+                        help="Split the samples of the render into NUM chunks and only render chunk CURRENT "
+                             "(starting from 1), to distribute a single frame over multiple machines. "
+                             "The rendered multi-layer EXR files can be combined with the Merge Images operator.",
+                        nargs=2,
+                        type=int,
+                        metavar=("NUM", "CURRENT"),
+                        default=None)
     return parser
 
 
@@ -39,6 +47,10 @@ def _parse_command_line():
         import _cycles
         _cycles.set_device_override(args.cycles_device)
 
+    if args.cycles_sample_chunks:
+        import _cycles
+        _cycles.set_sample_chunk(*args.cycles_sample_chunks)
+
 
 def init():
     import bpy
@@ -506,6 +506,19 @@ class CyclesRenderSettings(bpy.types.PropertyGroup):
         max=4096,
         default=0,
     )
+    use_preview_focus_cursor: BoolProperty(
+        name="Focus on 3D Cursor",
+        description="Spend the samples of adaptive sampling on the area around the 3D cursor first, for faster feedback while working on a part of the viewport",
+        default=False,
+    )
+    preview_focus_size: FloatProperty(
+        name="Focus Size",
+        description="Size of the focus area around the 3D cursor, relative to the viewport size",
+        min=0.01,
+        max=1.0,
+        default=0.25,
+        subtype='FACTOR',
+    )
 
     direct_light_sampling_type: EnumProperty(
         name="Direct Light Sampling",
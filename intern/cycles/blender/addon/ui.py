@@ -198,6 +198,13 @@ class CYCLES_RENDER_PT_sampling_viewport(CyclesButtonsPanel, Panel):
             col = layout.column(align=True)
             col.prop(cscene, "preview_samples", text="Max Samples")
             col.prop(cscene, "preview_adaptive_min_samples", text="Min Samples")
+
+            col = layout.column(align=True, heading="Focus")
+            row = col.row(align=True)
+            row.prop(cscene, "use_preview_focus_cursor", text="3D Cursor")
+            sub = row.row()
+            sub.active = cscene.use_preview_focus_cursor
+            sub.prop(cscene, "preview_focus_size", text="")
         else:
             layout.prop(cscene, "preview_samples", text="Samples")
 
@@ -4,6 +4,7 @@
 
 #include "scene/camera.h"
 #include "scene/bake.h"
+#include "scene/film.h"
 #include "scene/scene.h"
 
 #include "blender/sync.h"
@@ -975,6 +976,31 @@ void BlenderSync::sync_view(BL::SpaceView3D &b_v3d,
   else {
     *scene->dicing_camera = *scene->camera;
   }
+
+  /* Focus adaptive sampling on the area around the 3D cursor. */
+  float2 focus_min = zero_float2();
+  float2 focus_max = zero_float2();
+  if (get_boolean(cscene, "use_preview_focus_cursor")) {
+    BL::Array<float, 16> b_perspective_matrix = b_rv3d.perspective_matrix();
+    ProjectionTransform perspective_matrix;
+    memcpy((void *)&perspective_matrix, &b_perspective_matrix, sizeof(float) * 16);
+    perspective_matrix = projection_transpose(perspective_matrix);
+
+    const float3 location = get_float3(b_scene.cursor().location());
+    const float4 P = make_float4(location.x, location.y, location.z, 1.0f);
+    const float w = dot(perspective_matrix.w, P);
+
+    /* Cursor behind the view has no focus. */
+    if (w > 0.0f) {
+      const float2 center = make_float2(0.5f + 0.5f * dot(perspective_matrix.x, P) / w,
+                                        0.5f + 0.5f * dot(perspective_matrix.y, P) / w);
+      const float half_size = 0.5f * get_float(cscene, "preview_focus_size");
+      focus_min = center - make_float2(half_size, half_size);
+      focus_max = center + make_float2(half_size, half_size);
+    }
+  }
+  scene->film->set_focus_min(focus_min);
+  scene->film->set_focus_max(focus_max);
 }
 
 BufferParams BlenderSync::get_buffer_params(
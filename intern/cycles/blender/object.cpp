@@ -238,9 +238,12 @@ Object *BlenderSync::sync_object(BL::Depsgraph &b_depsgraph,
     return NULL;
   }
 
-  /* Use task pool only for non-instances, since sync_dupli_particle accesses
-   * geometry. This restriction should be removed for better performance. */
-  TaskPool *object_geom_task_pool = (is_instance) ? NULL : geom_task_pool;
+  /* Don't use the task pool for instances generated from a particle system, since
+   * sync_dupli_particle accesses their geometry. Other instances, like the ones generated by
+   * geometry nodes or collection instances, often make up most of the unique geometry. */
+  TaskPool *object_geom_task_pool = (is_instance && b_instance.particle_system()) ?
+                                        NULL :
+                                        geom_task_pool;
 
   /* key to lookup object */
   ObjectKey key(b_parent, persistent_id, b_ob_info.real_object, use_particle_hair);
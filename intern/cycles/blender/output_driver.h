@@ -21,6 +21,11 @@ class BlenderOutputDriver : public OutputDriver {
   virtual bool update_render_tile(const Tile &tile) override;
   virtual bool read_render_tile(const Tile &tile) override;
 
+  virtual bool supports_partial_tiles() const override
+  {
+    return true;
+  }
+
  protected:
   BL::RenderEngine b_engine_;
 };
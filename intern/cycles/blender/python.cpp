@@ -936,6 +936,24 @@ static PyObject *set_device_override_func(PyObject * /*self*/, PyObject *arg)
   Py_RETURN_TRUE;
 }
 
+static PyObject *set_sample_chunk_func(PyObject * /*self*/, PyObject *args)
+{
+  int num_chunks, current_chunk;
+  if (!PyArg_ParseTuple(args, "ii", &num_chunks, &current_chunk)) {
+    return NULL;
+  }
+
+  if (num_chunks < 1 || current_chunk < 1 || current_chunk > num_chunks) {
+    printf("\nError: invalid sample chunk %d of %d.\n", current_chunk, num_chunks);
+    Py_RETURN_FALSE;
+  }
+
+  BlenderSession::num_sample_chunks = num_chunks;
+  BlenderSession::current_sample_chunk = current_chunk - 1;
+
+  Py_RETURN_TRUE;
+}
+
 static PyMethodDef methods[] = {
     {"init", init_func, METH_VARARGS, ""},
     {"exit", exit_func, METH_VARARGS, ""},
@@ -969,6 +987,7 @@ static PyMethodDef methods[] = {
     /* Compute Device selection */
     {"get_device_types", get_device_types_func, METH_VARARGS, ""},
     {"set_device_override", set_device_override_func, METH_O, ""},
+    {"set_sample_chunk", set_sample_chunk_func, METH_VARARGS, ""},
 
     {NULL, NULL, 0, NULL},
 };
@@ -41,6 +41,8 @@ CCL_NAMESPACE_BEGIN
 DeviceTypeMask BlenderSession::device_override = DEVICE_MASK_ALL;
 bool BlenderSession::headless = false;
 bool BlenderSession::print_render_stats = false;
+int BlenderSession::num_sample_chunks = 1;
+int BlenderSession::current_sample_chunk = 0;
 
 BlenderSession::BlenderSession(BL::RenderEngine &b_engine,
                                BL::Preferences &b_userpref,
@@ -895,7 +897,7 @@ void BlenderSession::view_draw(int w, int h)
 
       sync->sync_view(b_v3d, b_rv3d, width, height);
 
-      if (scene->camera->is_modified()) {
+      if (scene->camera->is_modified() || scene->film->is_modified()) {
         reset = true;
       }
 
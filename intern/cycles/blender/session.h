@@ -120,6 +120,11 @@ class BlenderSession {
 
   static bool print_render_stats;
 
+  /* Split the samples of final renders into this many chunks and only render one of them, so
+   * that multiple machines can render the same frame. The results are merged afterwards. */
+  static int num_sample_chunks;
+  static int current_sample_chunk;
+
  protected:
   void stamp_view_layer_metadata(Scene *scene, const string &view_layer_name);
 
@@ -1498,7 +1498,30 @@ bool BlenderSync::scene_attr_needs_recalc(Shader *shader, BL::Depsgraph &b_depsg
 
 /* Sync Materials */
 
-void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
+/* When the frame changes, only shaders using animated images have to be synced again. Other
+ * shaders keep their compiled graph and images, which avoids re-syncing all shaders for every
+ * frame of an animation render with persistent data. */
+static bool shader_has_animated_images(const Shader *shader)
+{
+  if (shader->graph == nullptr) {
+    return false;
+  }
+  foreach (const ShaderNode *node, shader->graph->nodes) {
+    if (node->type == ImageTextureNode::get_node_type()) {
+      if (static_cast<const ImageTextureNode *>(node)->get_animated()) {
+        return true;
+      }
+    }
+    else if (node->type == EnvironmentTextureNode::get_node_type()) {
+      if (static_cast<const EnvironmentTextureNode *>(node)->get_animated()) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool auto_refresh_update)
 {
   shader_map.set_default(scene->default_surface);
 
@@ -1514,7 +1537,8 @@ void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
     Shader *shader;
 
     /* test if we need to sync */
-    if (shader_map.add_or_update(&shader, b_mat) || update_all ||
+    if (shader_map.add_or_update(&shader, b_mat) ||
+        (auto_refresh_update && shader_has_animated_images(shader)) ||
         scene_attr_needs_recalc(shader, b_depsgraph))
     {
       ShaderGraph *graph = new ShaderGraph();
@@ -1586,7 +1610,9 @@ void BlenderSync::sync_materials(BL::Depsgraph &b_depsgraph, bool update_all)
 
 /* Sync World */
 
-void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all)
+void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph,
+                             BL::SpaceView3D &b_v3d,
+                             bool auto_refresh_update)
 {
   Background *background = scene->background;
   Integrator *integrator = scene->integrator;
@@ -1598,7 +1624,8 @@ void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d,
 
   Shader *shader = scene->default_background;
 
-  if (world_recalc || update_all || b_world.ptr.data != world_map ||
+  if (world_recalc || (auto_refresh_update && shader_has_animated_images(shader)) ||
+      b_world.ptr.data != world_map ||
       viewport_parameters.shader_modified(new_viewport_parameters) ||
       scene_attr_needs_recalc(shader, b_depsgraph))
   {
@@ -1755,7 +1782,7 @@ void BlenderSync::sync_world(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d,
 
 /* Sync Lights */
 
-void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
+void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool auto_refresh_update)
 {
   shader_map.set_default(scene->default_light);
 
@@ -1768,7 +1795,8 @@ void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
     Shader *shader;
 
     /* test if we need to sync */
-    if (shader_map.add_or_update(&shader, b_light) || update_all ||
+    if (shader_map.add_or_update(&shader, b_light) ||
+        (auto_refresh_update && shader_has_animated_images(shader)) ||
         scene_attr_needs_recalc(shader, b_depsgraph))
     {
       ShaderGraph *graph = new ShaderGraph();
@@ -1799,13 +1827,15 @@ void BlenderSync::sync_lights(BL::Depsgraph &b_depsgraph, bool update_all)
   }
 }
 
-void BlenderSync::sync_shaders(BL::Depsgraph &b_depsgraph, BL::SpaceView3D &b_v3d, bool update_all)
+void BlenderSync::sync_shaders(BL::Depsgraph &b_depsgraph,
+                               BL::SpaceView3D &b_v3d,
+                               bool auto_refresh_update)
 {
   shader_map.pre_sync();
 
-  sync_world(b_depsgraph, b_v3d, update_all);
-  sync_lights(b_depsgraph, update_all);
-  sync_materials(b_depsgraph, update_all);
+  sync_world(b_depsgraph, b_v3d, auto_refresh_update);
+  sync_lights(b_depsgraph, auto_refresh_update);
+  sync_materials(b_depsgraph, auto_refresh_update);
 }
 
 CCL_NAMESPACE_END
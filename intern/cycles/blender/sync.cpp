@@ -903,6 +903,16 @@ SessionParams BlenderSync::get_session_params(BL::RenderEngine &b_engine,
   /* Clamp samples. */
   params.samples = clamp(params.samples, 0, Integrator::MAX_SAMPLES - params.sample_offset);
 
+  /* Render only a part of the samples when the frame is distributed over multiple machines. */
+  if (background && BlenderSession::num_sample_chunks > 1) {
+    const int64_t num_chunks = BlenderSession::num_sample_chunks;
+    const int64_t chunk = BlenderSession::current_sample_chunk;
+    const int chunk_start = int(params.samples * chunk / num_chunks);
+    const int chunk_end = int(params.samples * (chunk + 1) / num_chunks);
+    params.sample_offset += chunk_start;
+    params.samples = chunk_end - chunk_start;
+  }
+
   /* Viewport Performance */
   params.pixel_size = b_engine.get_preview_pixel_size(b_scene);
 
@@ -935,6 +945,8 @@ SessionParams BlenderSync::get_session_params(BL::RenderEngine &b_engine,
   /* Profiling. */
   params.use_profiling = params.device.has_profiling && !b_engine.is_preview() && background &&
                          BlenderSession::print_render_stats;
+  params.use_kernel_statistics = params.device.type != DEVICE_CPU && !b_engine.is_preview() &&
+                                 background && BlenderSession::print_render_stats;
 
   if (background) {
     params.use_auto_tile = RNA_boolean_get(&cscene, "use_auto_tile");
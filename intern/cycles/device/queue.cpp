@@ -16,7 +16,8 @@ DeviceQueue::DeviceQueue(Device *device)
     : device(device),
       last_kernels_enqueued_(0),
       last_sync_time_(0.0),
-      is_per_kernel_performance_(false)
+      is_per_kernel_performance_(false),
+      use_kernel_statistics_(false)
 {
   DCHECK_NE(device, nullptr);
   is_per_kernel_performance_ = getenv("CYCLES_DEBUG_PER_KERNEL_PERFORMANCE");
@@ -53,9 +54,20 @@ DeviceQueue::~DeviceQueue()
   }
 }
 
+void DeviceQueue::enable_kernel_statistics()
+{
+  use_kernel_statistics_ = true;
+  kernel_statistics_.resize(DEVICE_KERNEL_NUM);
+}
+
+const vector<DeviceQueue::KernelStatistics> &DeviceQueue::get_kernel_statistics() const
+{
+  return kernel_statistics_;
+}
+
 void DeviceQueue::debug_init_execution()
 {
-  if (VLOG_DEVICE_STATS_IS_ON) {
+  if (VLOG_DEVICE_STATS_IS_ON || use_kernel_statistics_) {
     last_sync_time_ = time_dt();
   }
 
@@ -69,19 +81,25 @@ void DeviceQueue::debug_enqueue_begin(DeviceKernel kernel, const int work_size)
                       << work_size;
   }
 
+  if (use_kernel_statistics_) {
+    KernelStatistics &statistics = kernel_statistics_[kernel];
+    statistics.num_launches++;
+    statistics.num_work_items += work_size;
+  }
+
   last_kernels_enqueued_ |= (uint64_t(1) << (uint64_t)kernel);
 }
 
 void DeviceQueue::debug_enqueue_end()
 {
-  if (VLOG_DEVICE_STATS_IS_ON && is_per_kernel_performance_) {
+  if ((VLOG_DEVICE_STATS_IS_ON && is_per_kernel_performance_) || use_kernel_statistics_) {
     synchronize();
   }
 }
 
 void DeviceQueue::debug_synchronize()
 {
-  if (VLOG_DEVICE_STATS_IS_ON) {
+  if (VLOG_DEVICE_STATS_IS_ON || use_kernel_statistics_) {
     const double new_time = time_dt();
     const double elapsed_time = new_time - last_sync_time_;
     VLOG_DEVICE_STATS << "GPU queue synchronize, elapsed " << std::setw(10) << elapsed_time << "s";
@@ -92,6 +110,13 @@ void DeviceQueue::debug_synchronize()
       stats_kernel_time_[last_kernels_enqueued_] += elapsed_time;
     }
 
+    /* Every kernel is followed by a synchronization when gathering per-kernel statistics, so
+     * only a single kernel can have been enqueued since the last one. */
+    if (use_kernel_statistics_ && last_kernels_enqueued_ != 0) {
+      const int kernel = bitscan(last_kernels_enqueued_);
+      kernel_statistics_[kernel].time += elapsed_time;
+    }
+
     last_sync_time_ = new_time;
   }
 
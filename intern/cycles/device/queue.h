@@ -12,6 +12,7 @@
 #include "util/map.h"
 #include "util/string.h"
 #include "util/unique_ptr.h"
+#include "util/vector.h"
 
 CCL_NAMESPACE_BEGIN
 
@@ -93,6 +94,13 @@ struct DeviceKernelArguments {
  * This class encapsulates all properties needed for commands execution. */
 class DeviceQueue {
  public:
+  /* Accumulated execution statistics of a single kernel. */
+  struct KernelStatistics {
+    double time = 0.0;
+    int64_t num_launches = 0;
+    int64_t num_work_items = 0;
+  };
+
   virtual ~DeviceQueue();
 
   /* Number of concurrent states to process for integrator,
@@ -159,6 +167,13 @@ class DeviceQueue {
     return nullptr;
   }
 
+  /* Gather execution statistics of every kernel, accessible with #get_kernel_statistics().
+   * This adds a synchronization after every kernel, so it is only meant for profiling. */
+  void enable_kernel_statistics();
+
+  /* Statistics of the kernels executed so far, indexed by DeviceKernel. */
+  const vector<KernelStatistics> &get_kernel_statistics() const;
+
   /* Device this queue has been created for. */
   Device *device;
 
@@ -182,6 +197,9 @@ class DeviceQueue {
   /* If it is true, then a performance statistics in the debugging logs will have focus on kernels
    * and an explicit queue synchronization will be added after each kernel execution. */
   bool is_per_kernel_performance_;
+  /* Per-kernel statistics, only gathered when enabled with #enable_kernel_statistics(). */
+  bool use_kernel_statistics_;
+  vector<KernelStatistics> kernel_statistics_;
 };
 
 CCL_NAMESPACE_END
@@ -742,15 +742,19 @@ void PathTrace::write_tile_buffer(const RenderWork &render_work)
   render_state_.tile_written = true;
 
   const bool has_multiple_tiles = tile_manager_.has_multiple_tiles();
+  const bool write_tile_to_software = !tile_manager_.need_full_frame_processing() &&
+                                      output_driver_ && output_driver_->supports_partial_tiles();
 
-  /* Write render tile result, but only if not using tiled rendering.
+  /* Write render tile result, but only if not using tiled rendering, or if the tile can be
+   * written as-is.
    *
-   * Tiles are written to a file during rendering, and written to the software at the end
-   * of rendering (wither when all tiles are finished, or when rendering was requested to be
-   * canceled).
+   * Otherwise tiles are written to a file during rendering, and written to the software at the
+   * end of rendering (wither when all tiles are finished, or when rendering was requested to be
+   * canceled). Streaming the tiles to the software avoids writing and reading the file, and the
+   * memory of the whole frame used while reading it.
    *
    * Important thing is: tile should be written to the software via callback only once. */
-  if (!has_multiple_tiles) {
+  if (!has_multiple_tiles || write_tile_to_software) {
     VLOG_WORK << "Write tile result via buffer write callback.";
     tile_buffer_write();
   }
@@ -1271,6 +1275,20 @@ string PathTrace::full_report() const
   return result;
 }
 
+void PathTrace::enable_kernel_statistics()
+{
+  for (auto &&path_trace_work : path_trace_works_) {
+    path_trace_work->enable_kernel_statistics();
+  }
+}
+
+void PathTrace::collect_statistics(RenderStats *render_stats)
+{
+  for (auto &&path_trace_work : path_trace_works_) {
+    path_trace_work->collect_statistics(render_stats);
+  }
+}
+
 void PathTrace::set_guiding_params(const GuidingParams &guiding_params, const bool reset)
 {
 #ifdef WITH_PATH_GUIDING
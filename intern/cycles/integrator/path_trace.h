@@ -27,6 +27,7 @@ class DisplayDriver;
 class Film;
 class RenderBuffers;
 class RenderScheduler;
+class RenderStats;
 class RenderWork;
 class PathTraceDisplay;
 class OutputDriver;
@@ -175,6 +176,13 @@ class PathTrace {
    * times, and so on. */
   string full_report() const;
 
+  /* Gather execution statistics of every kernel executed by GPU devices. This adds a
+   * synchronization after every kernel, so it is only meant for profiling. */
+  void enable_kernel_statistics();
+
+  /* Add the gathered kernel statistics to the render statistics. */
+  void collect_statistics(RenderStats *render_stats);
+
   /* Callback which is called to report current rendering progress.
    *
    * It is supposed to be cheaper than buffer update/write, hence can be called more often.
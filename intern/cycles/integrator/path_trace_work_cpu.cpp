@@ -22,6 +22,12 @@
 
 CCL_NAMESPACE_BEGIN
 
+/* Size of the square blocks of pixels which are rendered by a single thread. Neighbor pixels
+ * mostly intersect the same objects and evaluate the same shaders, so tracing them one after
+ * another on the same thread keeps the BVH nodes, shader nodes and textures they use in the
+ * caches, which is not the case when threads get arbitrary long spans of a pixel row. */
+static constexpr int PIXEL_BLOCK_SIZE = 8;
+
 /* Create TBB arena for execution of path tracing and rendering tasks. */
 static inline tbb::task_arena local_tbb_arena_create(const Device *device)
 {
@@ -63,9 +69,8 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
                                       int samples_num,
                                       int sample_offset)
 {
-  const int64_t image_width = effective_buffer_params_.width;
-  const int64_t image_height = effective_buffer_params_.height;
-  const int64_t total_pixels_num = image_width * image_height;
+  const int image_width = effective_buffer_params_.width;
+  const int image_height = effective_buffer_params_.height;
 
   if (device_->profiler.active()) {
     for (CPUKernelThreadGlobals &kernel_globals : kernel_thread_globals_) {
@@ -75,28 +80,31 @@ void PathTraceWorkCPU::render_samples(RenderStatistics &statistics,
 
   tbb::task_arena local_arena = local_tbb_arena_create(device_);
   local_arena.execute([&]() {
-    parallel_for(int64_t(0), total_pixels_num, [&](int64_t work_index) {
-      if (is_cancel_requested()) {
-        return;
-      }
-
-      const int y = work_index / image_width;
-      const int x = work_index - y * image_width;
-
-      KernelWorkTile work_tile;
-      work_tile.x = effective_buffer_params_.full_x + x;
-      work_tile.y = effective_buffer_params_.full_y + y;
-      work_tile.w = 1;
-      work_tile.h = 1;
-      work_tile.start_sample = start_sample;
-      work_tile.sample_offset = sample_offset;
-      work_tile.num_samples = 1;
-      work_tile.offset = effective_buffer_params_.offset;
-      work_tile.stride = effective_buffer_params_.stride;
-
+    const blocked_range2d<int> range(
+        0, image_height, PIXEL_BLOCK_SIZE, 0, image_width, PIXEL_BLOCK_SIZE);
+    parallel_for(range, [&](const blocked_range2d<int> &block) {
       CPUKernelThreadGlobals *kernel_globals = kernel_thread_globals_get(kernel_thread_globals_);
 
-      render_samples_full_pipeline(kernel_globals, work_tile, samples_num);
+      for (int y = block.rows().begin(); y < block.rows().end(); y++) {
+        for (int x = block.cols().begin(); x < block.cols().end(); x++) {
+          if (is_cancel_requested()) {
+            return;
+          }
+
+          KernelWorkTile work_tile;
+          work_tile.x = effective_buffer_params_.full_x + x;
+          work_tile.y = effective_buffer_params_.full_y + y;
+          work_tile.w = 1;
+          work_tile.h = 1;
+          work_tile.start_sample = start_sample;
+          work_tile.sample_offset = sample_offset;
+          work_tile.num_samples = 1;
+          work_tile.offset = effective_buffer_params_.offset;
+          work_tile.stride = effective_buffer_params_.stride;
+
+          render_samples_full_pipeline(kernel_globals, work_tile, samples_num);
+        }
+      }
     });
   });
   if (device_->profiler.active()) {
@@ -9,6 +9,7 @@
 
 #include "integrator/pass_accessor_gpu.h"
 #include "scene/scene.h"
+#include "scene/stats.h"
 #include "session/buffers.h"
 #include "util/log.h"
 #include "util/string.h"
@@ -361,6 +362,41 @@ void PathTraceWorkGPU::render_samples(RenderStatistics &statistics,
   }
 
   statistics.occupancy = static_cast<float>(num_busy_accum) / num_iterations / max_num_paths_;
+
+  occupancy_accum_ += statistics.occupancy;
+  num_occupancy_samples_++;
+}
+
+void PathTraceWorkGPU::enable_kernel_statistics()
+{
+  queue_->enable_kernel_statistics();
+}
+
+void PathTraceWorkGPU::collect_statistics(RenderStats *render_stats)
+{
+  const vector<DeviceQueue::KernelStatistics> &kernel_statistics =
+      queue_->get_kernel_statistics();
+  if (kernel_statistics.empty()) {
+    return;
+  }
+
+  render_stats->has_device_kernels = true;
+
+  for (int i = 0; i < kernel_statistics.size(); i++) {
+    const DeviceQueue::KernelStatistics &statistics = kernel_statistics[i];
+    if (statistics.num_launches == 0) {
+      continue;
+    }
+    render_stats->device_kernels.add_kernel(device_kernel_as_string(DeviceKernel(i)),
+                                            statistics.time,
+                                            statistics.num_launches,
+                                            statistics.num_work_items);
+  }
+
+  if (num_occupancy_samples_) {
+    render_stats->device_kernels.add_occupancy(device_->info.description,
+                                               occupancy_accum_ / num_occupancy_samples_);
+  }
 }
 
 DeviceKernel PathTraceWorkGPU::get_most_queued_kernel() const
@@ -49,6 +49,9 @@ class PathTraceWorkGPU : public PathTraceWork {
   virtual int adaptive_sampling_converge_filter_count_active(float threshold, bool reset) override;
   virtual void cryptomatte_postproces() override;
 
+  virtual void enable_kernel_statistics() override;
+  virtual void collect_statistics(RenderStats *render_stats) override;
+
  protected:
   void alloc_integrator_soa();
   void alloc_integrator_queue();
@@ -162,6 +165,10 @@ class PathTraceWorkGPU : public PathTraceWork {
   /* Maximum number of concurrent integrator states. */
   int max_num_paths_;
 
+  /* Accumulated occupancy of all render_samples() calls, for the render statistics. */
+  double occupancy_accum_ = 0.0;
+  int num_occupancy_samples_ = 0;
+
   /* Minimum number of paths which keeps the device bust. If the actual number of paths falls below
    * this value more work will be scheduled. */
   int min_num_active_main_paths_;
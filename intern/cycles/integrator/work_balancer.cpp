@@ -38,9 +38,9 @@ static double calculate_total_time(const vector<WorkBalanceInfo> &work_balance_i
   return total_time;
 }
 
-/* The balance is based on equalizing time which devices spent performing a task. Assume that
- * average of the observed times is usable for estimating whether more or less work is to be
- * scheduled, and how difference in the work scheduling is needed. */
+/* The balance is based on equalizing time which devices spent performing a task. The amount of
+ * work a device did per second is assumed to stay the same for the next work, so the weights are
+ * chosen such that all devices are expected to finish at the same time. */
 
 bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
 {
@@ -49,26 +49,24 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
   const double total_time = calculate_total_time(work_balance_infos);
   const double time_average = total_time / num_infos;
 
-  double total_weight = 0;
-  vector<double> new_weights;
-  new_weights.reserve(num_infos);
+  /* Directly use the measured throughput instead of moving the times only partially towards the
+   * average. With devices of very different speed the latter needs many rebalances to converge,
+   * and in the meantime the faster devices are idle at the end of every work waiting for the
+   * slowest one. */
+  double total_throughput = 0;
+  vector<double> throughputs;
+  throughputs.reserve(num_infos);
 
-  /* Equalize the overall average time. This means that we don't make it so every work will perform
-   * amount of work based on the current average, but that after the weights changes the time will
-   * equalize.
-   * Can think of it that if one of the devices is 10% faster than another, then one device needs
-   * to do 5% less of the current work, and another needs to do 5% more. */
-  const double lerp_weight = 1.0 / num_infos;
+  for (const WorkBalanceInfo &info : work_balance_infos) {
+    const double throughput = info.weight / max(info.time_spent, 1e-6);
+    throughputs.push_back(throughput);
+    total_throughput += throughput;
+  }
 
   bool has_big_difference = false;
 
   for (const WorkBalanceInfo &info : work_balance_infos) {
-    const double time_target = mix(info.time_spent, time_average, lerp_weight);
-    const double new_weight = info.weight * time_target / info.time_spent;
-    new_weights.push_back(new_weight);
-    total_weight += new_weight;
-
-    if (std::fabs(1.0 - time_target / time_average) > 0.02) {
+    if (std::fabs(1.0 - info.time_spent / time_average) > 0.02) {
       has_big_difference = true;
     }
   }
@@ -77,10 +75,10 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
     return false;
   }
 
-  const double total_weight_inv = 1.0 / total_weight;
+  const double total_throughput_inv = 1.0 / total_throughput;
   for (int i = 0; i < num_infos; ++i) {
     WorkBalanceInfo &info = work_balance_infos[i];
-    info.weight = new_weights[i] * total_weight_inv;
+    info.weight = throughputs[i] * total_throughput_inv;
     info.time_spent = 0;
   }
 
@@ -116,6 +116,11 @@ KERNEL_STRUCT_MEMBER(film, int, pass_cryptomatte)
 /* Adaptive sampling. */
 KERNEL_STRUCT_MEMBER(film, int, pass_adaptive_aux_buffer)
 KERNEL_STRUCT_MEMBER(film, int, pass_sample_count)
+/* Focus region of adaptive sampling, in normalized full frame coordinates. */
+KERNEL_STRUCT_MEMBER(film, float, focus_min_x)
+KERNEL_STRUCT_MEMBER(film, float, focus_min_y)
+KERNEL_STRUCT_MEMBER(film, float, focus_max_x)
+KERNEL_STRUCT_MEMBER(film, float, focus_max_y)
 /* Mist. */
 KERNEL_STRUCT_MEMBER(film, int, pass_mist)
 KERNEL_STRUCT_MEMBER(film, float, mist_start)
@@ -27,6 +27,26 @@ ccl_device_forceinline bool film_need_sample_pixel(KernelGlobals kg,
   return buffer[aux_w_offset] == 0.0f;
 }
 
+/* Pixels outside of the focus region accept a larger error, so that they stop sampling early and
+ * the samples are spent on the pixels inside of the region. */
+
+ccl_device_inline float film_adaptive_sampling_focus_scale(KernelGlobals kg, int x, int y)
+{
+  if (kernel_data.film.focus_max_x <= kernel_data.film.focus_min_x) {
+    return 1.0f;
+  }
+
+  const float u = (x + 0.5f) / kernel_data.cam.width;
+  const float v = (y + 0.5f) / kernel_data.cam.height;
+  if (u >= kernel_data.film.focus_min_x && u <= kernel_data.film.focus_max_x &&
+      v >= kernel_data.film.focus_min_y && v <= kernel_data.film.focus_max_y)
+  {
+    return 1.0f;
+  }
+
+  return 8.0f;
+}
+
 /* Determines whether to continue sampling a given pixel or if it has sufficiently converged. */
 
 ccl_device bool film_adaptive_sampling_convergence_check(KernelGlobals kg,
@@ -84,7 +104,7 @@ ccl_device bool film_adaptive_sampling_convergence_check(KernelGlobals kg,
 
   /* A small epsilon is added to the divisor to prevent division by zero. */
   const float error = error_difference / (0.0001f + error_normalize);
-  const bool did_converge = (error < threshold);
+  const bool did_converge = (error < threshold * film_adaptive_sampling_focus_scale(kg, x, y));
 
   const uint aux_w_offset = kernel_data.film.pass_adaptive_aux_buffer + 3;
   buffer[aux_w_offset] = did_converge;
@@ -84,9 +84,9 @@ ccl_device_inline void triangle_vertices_and_normals(KernelGlobals kg,
   P[1] = kernel_data_fetch(tri_verts, tri_vindex.y);
   P[2] = kernel_data_fetch(tri_verts, tri_vindex.z);
 
-  N[0] = kernel_data_fetch(tri_vnormal, tri_vindex.x);
-  N[1] = kernel_data_fetch(tri_vnormal, tri_vindex.y);
-  N[2] = kernel_data_fetch(tri_vnormal, tri_vindex.z);
+  N[0] = octahedral_normal_decode(kernel_data_fetch(tri_vnormal, tri_vindex.x));
+  N[1] = octahedral_normal_decode(kernel_data_fetch(tri_vnormal, tri_vindex.y));
+  N[2] = octahedral_normal_decode(kernel_data_fetch(tri_vnormal, tri_vindex.z));
 }
 
 /* Interpolate smooth vertex normal from vertices */
@@ -97,9 +97,9 @@ triangle_smooth_normal(KernelGlobals kg, float3 Ng, int prim, float u, float v)
   /* load triangle vertices */
   const uint3 tri_vindex = kernel_data_fetch(tri_vindex, prim);
 
-  float3 n0 = kernel_data_fetch(tri_vnormal, tri_vindex.x);
-  float3 n1 = kernel_data_fetch(tri_vnormal, tri_vindex.y);
-  float3 n2 = kernel_data_fetch(tri_vnormal, tri_vindex.z);
+  float3 n0 = octahedral_normal_decode(kernel_data_fetch(tri_vnormal, tri_vindex.x));
+  float3 n1 = octahedral_normal_decode(kernel_data_fetch(tri_vnormal, tri_vindex.y));
+  float3 n2 = octahedral_normal_decode(kernel_data_fetch(tri_vnormal, tri_vindex.z));
 
   float3 N = safe_normalize((1.0f - u - v) * n0 + u * n1 + v * n2);
 
@@ -112,9 +112,9 @@ ccl_device_inline float3 triangle_smooth_normal_unnormalized(
   /* load triangle vertices */
   const uint3 tri_vindex = kernel_data_fetch(tri_vindex, prim);
 
-  float3 n0 = kernel_data_fetch(tri_vnormal, tri_vindex.x);
-  float3 n1 = kernel_data_fetch(tri_vnormal, tri_vindex.y);
-  float3 n2 = kernel_data_fetch(tri_vnormal, tri_vindex.z);
+  float3 n0 = octahedral_normal_decode(kernel_data_fetch(tri_vnormal, tri_vindex.x));
+  float3 n1 = octahedral_normal_decode(kernel_data_fetch(tri_vnormal, tri_vindex.y));
+  float3 n2 = octahedral_normal_decode(kernel_data_fetch(tri_vnormal, tri_vindex.z));
 
   /* ensure that the normals are in object space */
   if (sd->object_flag & SD_OBJECT_TRANSFORM_APPLIED) {
@@ -121,6 +121,9 @@ NODE_DEFINE(Film)
 
   SOCKET_BOOLEAN(use_approximate_shadow_catcher, "Use Approximate Shadow Catcher", false);
 
+  SOCKET_POINT2(focus_min, "Focus Min", zero_float2());
+  SOCKET_POINT2(focus_max, "Focus Max", zero_float2());
+
   return type;
 }
 
@@ -157,6 +160,11 @@ void Film::device_update(Device *device, DeviceScene *dscene, Scene *scene)
 
   kfilm->use_approximate_shadow_catcher = get_use_approximate_shadow_catcher();
 
+  kfilm->focus_min_x = focus_min.x;
+  kfilm->focus_min_y = focus_min.y;
+  kfilm->focus_max_x = focus_max.x;
+  kfilm->focus_max_y = focus_max.y;
+
   kfilm->light_pass_flag = 0;
   kfilm->pass_stride = 0;
 
@@ -51,6 +51,11 @@ class Film : public Node {
    * shadows can be alpha-overed onto a backdrop. */
   NODE_SOCKET_API(bool, use_approximate_shadow_catcher)
 
+  /* Region of the frame where adaptive sampling spends its samples first, in normalized
+   * coordinates. Empty when there is no focus. */
+  NODE_SOCKET_API(float2, focus_min)
+  NODE_SOCKET_API(float2, focus_max)
+
  private:
   size_t filter_table_offset_;
   bool prev_have_uv_pass = false;
@@ -54,6 +54,7 @@ Geometry::Geometry(const NodeType *node_type, const Type type)
 {
   need_update_rebuild = false;
   need_update_bvh_for_offset = false;
+  bvh_build_area = 0.0f;
 
   transform_applied = false;
   transform_negative_scaled = false;
@@ -101,6 +101,8 @@ class Geometry : public Node {
 
   /* BVH */
   BVH *bvh;
+  /* Surface area of the bounds when the BVH was last fully built. */
+  float bvh_build_area;
   size_t attr_map_offset;
   size_t prim_offset;
 
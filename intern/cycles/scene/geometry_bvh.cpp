@@ -71,7 +71,14 @@ void Geometry::compute_bvh(Device *device,
     vector<Object *> objects;
     objects.push_back(&object);
 
-    if (bvh && !need_update_rebuild) {
+    const float area = bounds.valid() ? bounds.safe_area() : 0.0f;
+    const bool refit_degraded = params->bvh_refit_max_area_ratio > 0.0f &&
+                                area > bvh_build_area * params->bvh_refit_max_area_ratio;
+    if (bvh && !need_update_rebuild && refit_degraded) {
+      VLOG_WORK << "Rebuilding BVH of " << name << ", bounds grew too much to refit.";
+    }
+
+    if (bvh && !need_update_rebuild && !refit_degraded) {
       progress->set_status(msg, "Refitting BVH");
 
       bvh->replace_geometry(geometry, objects);
@@ -96,6 +103,7 @@ void Geometry::compute_bvh(Device *device,
       delete bvh;
       bvh = BVH::create(bparams, geometry, objects, device);
       MEM_GUARDED_CALL(progress, device->build_bvh, bvh, *progress, false);
+      bvh_build_area = area;
     }
   }
 
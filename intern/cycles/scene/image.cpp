@@ -531,6 +531,41 @@ static bool image_associate_alpha(ImageManager::Image *img)
            img->params.alpha_type == IMAGE_ALPHA_CHANNEL_PACKED);
 }
 
+/* Check if an RGBA image only contains gray values without alpha, which is common for roughness,
+ * displacement or mask textures saved as RGB. Values are compared bitwise to be exact for all
+ * storage types. */
+template<typename StorageType>
+static bool image_is_grayscale_without_alpha(const StorageType *pixels, const size_t num_pixels)
+{
+  const StorageType one = util_image_cast_from_float<StorageType>(1.0f);
+  for (size_t i = 0; i < num_pixels; i++) {
+    const StorageType *pixel = &pixels[i * 4];
+    if (memcmp(&pixel[0], &pixel[1], sizeof(StorageType)) != 0 ||
+        memcmp(&pixel[0], &pixel[2], sizeof(StorageType)) != 0 ||
+        memcmp(&pixel[3], &one, sizeof(StorageType)) != 0)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static ImageDataType image_single_channel_type(const ImageDataType type)
+{
+  switch (type) {
+    case IMAGE_DATA_TYPE_FLOAT4:
+      return IMAGE_DATA_TYPE_FLOAT;
+    case IMAGE_DATA_TYPE_HALF4:
+      return IMAGE_DATA_TYPE_HALF;
+    case IMAGE_DATA_TYPE_BYTE4:
+      return IMAGE_DATA_TYPE_BYTE;
+    case IMAGE_DATA_TYPE_USHORT4:
+      return IMAGE_DATA_TYPE_USHORT;
+    default:
+      return type;
+  }
+}
+
 template<TypeDesc::BASETYPE FileFormat, typename StorageType>
 bool ImageManager::file_load_image(Image *img, int texture_limit)
 {
@@ -653,6 +688,35 @@ bool ImageManager::file_load_image(Image *img, int texture_limit)
     }
   }
 
+  /* Store gray images as a single channel, using a quarter of the memory. The kernel returns the
+   * same color and an alpha of one for single channel lookups. */
+  if (is_rgba && image_is_grayscale_without_alpha(pixels, num_pixels)) {
+    VLOG_WORK << "Storing grayscale image " << img->loader->name() << " as a single channel.";
+    for (size_t i = 0; i < num_pixels; i++) {
+      pixels[i] = pixels[i * 4];
+    }
+    is_rgba = false;
+
+    thread_scoped_lock device_lock(device_mutex);
+    device_texture *mem = new device_texture(img->mem->device,
+                                             img->mem_name.c_str(),
+                                             img->mem->slot,
+                                             image_single_channel_type(img->metadata.type),
+                                             img->params.interpolation,
+                                             img->params.extension);
+    mem->info.use_transform_3d = img->mem->info.use_transform_3d;
+    mem->info.transform_3d = img->mem->info.transform_3d;
+    if (pixels_storage.size() > 0) {
+      pixels_storage.resize(num_pixels);
+    }
+    else {
+      StorageType *texture_pixels = (StorageType *)mem->alloc(width, height, depth);
+      memcpy(texture_pixels, pixels, num_pixels * sizeof(StorageType));
+    }
+    delete img->mem;
+    img->mem = mem;
+  }
+
   /* Scale image down if needed. */
   if (pixels_storage.size() > 0) {
     float scale_factor = 1.0f;
@@ -451,8 +451,8 @@ class LightTree {
   /* Check whether the light tree can use this triangle as light-emissive. */
   bool triangle_usable_as_light(Mesh *mesh, int prim_id);
 
-  /* Add all the emissive triangles of a mesh to the light tree. */
-  void add_mesh(Scene *scene, Mesh *mesh, int object_id);
+  /* Add all the emissive triangles of a mesh to the given emitters. */
+  void add_mesh(Scene *scene, Mesh *mesh, int object_id, vector<LightTreeEmitter> &emitters);
 };
 
 CCL_NAMESPACE_END
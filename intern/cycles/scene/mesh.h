@@ -215,7 +215,7 @@ class Mesh : public Geometry {
   void get_uv_tiles(ustring map, unordered_set<int> &tiles) override;
 
   void pack_shaders(Scene *scene, uint *shader);
-  void pack_normals(packed_float3 *vnormal);
+  void pack_normals(uint *vnormal);
   void pack_verts(packed_float3 *tri_verts,
                   packed_uint3 *tri_vindex,
                   uint *tri_patch,
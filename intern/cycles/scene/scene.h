@@ -68,6 +68,11 @@ class SceneParams {
   bool use_bvh_compact_structure;
   bool use_bvh_unaligned_nodes;
   int num_bvh_time_steps;
+  /* Geometry BVHs are refit when only the positions of primitives changed. A full rebuild is
+   * done instead when the surface area of the bounds grew by more than this factor since the
+   * last build, since the refit hierarchy gets less efficient to traverse. Zero disables the
+   * rebuild. */
+  float bvh_refit_max_area_ratio;
   int hair_subdivisions;
   CurveShapeType hair_shape;
   int texture_limit;
@@ -83,6 +88,7 @@ class SceneParams {
     use_bvh_compact_structure = true;
     use_bvh_unaligned_nodes = true;
     num_bvh_time_steps = 0;
+    bvh_refit_max_area_ratio = 2.0f;
     hair_subdivisions = 3;
     hair_shape = CURVE_RIBBON;
     texture_limit = 0;
@@ -97,6 +103,7 @@ class SceneParams {
              use_bvh_compact_structure == params.use_bvh_compact_structure &&
              use_bvh_unaligned_nodes == params.use_bvh_unaligned_nodes &&
              num_bvh_time_steps == params.num_bvh_time_steps &&
+             bvh_refit_max_area_ratio == params.bvh_refit_max_area_ratio &&
              hair_subdivisions == params.hair_subdivisions && hair_shape == params.hair_shape &&
              texture_limit == params.texture_limit);
   }
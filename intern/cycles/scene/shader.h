@@ -125,6 +125,10 @@ class Shader : public Node {
   /* determined before compiling */
   uint id;
 
+  /* Compiled SVM nodes, kept so that unmodified shaders don't have to be compiled again. */
+  array<int4> svm_nodes;
+  bool svm_nodes_background = false;
+
 #ifdef WITH_OSL
   /* osl shading state references */
   OSL::ShaderGroupRef osl_surface_ref;
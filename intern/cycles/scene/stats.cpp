@@ -222,11 +222,64 @@ string ImageStats::full_report(int indent_level)
   return result;
 }
 
+/* Device kernel statistics. */
+
+string DeviceKernelStats::full_report(int indent_level)
+{
+  const string indent(indent_level * kIndentNumSpaces, ' ');
+  const string child_indent((indent_level + 1) * kIndentNumSpaces, ' ');
+
+  vector<KernelEntry> sorted_kernels = kernels;
+  sort(sorted_kernels.begin(),
+       sorted_kernels.end(),
+       [](const KernelEntry &a, const KernelEntry &b) { return a.time > b.time; });
+
+  string result = "";
+  result += indent + "Kernels (name, time in seconds, launches, work items):\n";
+  for (const KernelEntry &kernel : sorted_kernels) {
+    result += child_indent + string_printf("%-50s %12.6f %10lld %14lld\n",
+                                           kernel.name.c_str(),
+                                           kernel.time,
+                                           (long long)kernel.num_launches,
+                                           (long long)kernel.num_work_items);
+  }
+
+  result += indent + "Occupancy (device, fraction of active paths):\n";
+  for (const auto &[device_name, device_occupancy] : occupancy) {
+    /* Device names contain spaces, quote them to keep the line parsable. */
+    result += child_indent + string_printf("\"%s\" %.4f\n", device_name.c_str(), device_occupancy);
+  }
+
+  return result;
+}
+
+void DeviceKernelStats::add_kernel(const string &name,
+                                   double time,
+                                   int64_t num_launches,
+                                   int64_t num_work_items)
+{
+  for (KernelEntry &kernel : kernels) {
+    if (kernel.name == name) {
+      kernel.time += time;
+      kernel.num_launches += num_launches;
+      kernel.num_work_items += num_work_items;
+      return;
+    }
+  }
+  kernels.push_back({name, time, num_launches, num_work_items});
+}
+
+void DeviceKernelStats::add_occupancy(const string &device_name, float occupancy)
+{
+  this->occupancy.emplace_back(device_name, occupancy);
+}
+
 /* Overall statistics. */
 
 RenderStats::RenderStats()
 {
   has_profiling = false;
+  has_device_kernels = false;
 }
 
 void RenderStats::collect_profiling(Scene *scene, Profiler &prof)
@@ -292,8 +345,12 @@ string RenderStats::full_report()
     result += "Shader statistics:\n" + shaders.full_report(1);
     result += "Object statistics:\n" + objects.full_report(1);
   }
+  else if (has_device_kernels) {
+    result += "Device kernel statistics:\n" + device_kernels.full_report(1);
+  }
   else {
-    result += "Profiling information not available (only works with CPU rendering)";
+    result += "Profiling information not available (only works with CPU, CUDA, OptiX, HIP and "
+              "oneAPI rendering)";
   }
   return result;
 }
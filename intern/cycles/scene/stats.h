@@ -161,6 +161,30 @@ class ImageStats {
   NamedSizeStats textures;
 };
 
+/* Statistics about kernels executed on GPU devices. */
+class DeviceKernelStats {
+ public:
+  /* Generate full report. Every kernel and device is one line of whitespace separated values,
+   * so that the report can be parsed by scripts. */
+  string full_report(int indent_level = 0);
+
+  /* Add execution statistics of a kernel, accumulated with the ones of other devices. */
+  void add_kernel(const string &name, double time, int64_t num_launches, int64_t num_work_items);
+
+  /* Add average fraction of the path states of a device which were active. */
+  void add_occupancy(const string &device_name, float occupancy);
+
+  struct KernelEntry {
+    string name;
+    double time = 0.0;
+    int64_t num_launches = 0;
+    int64_t num_work_items = 0;
+  };
+
+  vector<KernelEntry> kernels;
+  vector<std::pair<string, float>> occupancy;
+};
+
 /* Render process statistics. */
 class RenderStats {
  public:
@@ -173,12 +197,14 @@ class RenderStats {
   void collect_profiling(Scene *scene, Profiler &prof);
 
   bool has_profiling;
+  bool has_device_kernels;
 
   MeshStats mesh;
   ImageStats image;
   NamedNestedSampleStats kernel;
   NamedSampleCountStats shaders;
   NamedSampleCountStats objects;
+  DeviceKernelStats device_kernels;
 };
 
 class UpdateTimeStats {
@@ -44,7 +44,7 @@ class SVMShaderManager : public ShaderManager {
   void device_update_shader(Scene *scene,
                             Shader *shader,
                             Progress *progress,
-                            array<int4> *svm_nodes);
+                            bool background);
 };
 
 /* Graph Compiler */
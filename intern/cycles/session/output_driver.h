@@ -51,6 +51,15 @@ class OutputDriver {
   /* Write tile once it has finished rendering. */
   virtual void write_render_tile(const Tile &tile) = 0;
 
+  /* Check whether the driver can write tiles which only cover a part of the full frame. When it
+   * can, each tile of a tiled render is written as soon as it is finished, unless the full frame
+   * needs post-processing. Otherwise tiles are stored in a file on disk and are written as a
+   * single full frame tile at the end of rendering. */
+  virtual bool supports_partial_tiles() const
+  {
+    return false;
+  }
+
   /* Update tile while rendering is in progress. Return true if any update
    * was performed. */
   virtual bool update_render_tile(const Tile & /* tile */)
@@ -54,6 +54,9 @@ Session::Session(const SessionParams &params_, const SceneParams &scene_params)
   path_trace_ = make_unique<PathTrace>(
       device, scene->film, &scene->dscene, render_scheduler_, tile_manager_);
   path_trace_->set_progress(&progress);
+  if (params.use_kernel_statistics) {
+    path_trace_->enable_kernel_statistics();
+  }
   path_trace_->progress_update_cb = [&]() { update_status_time(); };
 
   tile_manager_.full_buffer_written_cb = [&](string_view filename) {
@@ -745,6 +748,9 @@ void Session::collect_statistics(RenderStats *render_stats)
   if (params.use_profiling && (params.device.type == DEVICE_CPU)) {
     render_stats->collect_profiling(scene, profiler);
   }
+  else if (params.use_kernel_statistics) {
+    path_trace_->collect_statistics(render_stats);
+  }
 }
 
 /* --------------------------------------------------------------------
@@ -51,6 +51,8 @@ class SessionParams {
   double time_limit;
 
   bool use_profiling;
+  /* Gather per-kernel execution statistics on GPU devices, for the render statistics. */
+  bool use_kernel_statistics;
 
   bool use_auto_tile;
   int tile_size;
@@ -75,6 +77,7 @@ class SessionParams {
     time_limit = 0.0;
 
     use_profiling = false;
+    use_kernel_statistics = false;
 
     use_auto_tile = true;
     tile_size = 2048;
@@ -91,7 +94,9 @@ class SessionParams {
     return !(device == params.device && headless == params.headless &&
              background == params.background && experimental == params.experimental &&
              pixel_size == params.pixel_size && threads == params.threads &&
-             use_profiling == params.use_profiling && shadingsystem == params.shadingsystem &&
+             use_profiling == params.use_profiling &&
+             use_kernel_statistics == params.use_kernel_statistics &&
+             shadingsystem == params.shadingsystem &&
              use_auto_tile == params.use_auto_tile && tile_size == params.tile_size);
   }
 };
@@ -367,6 +367,8 @@ void TileManager::update(const BufferParams &params, const Scene *scene)
     node_to_image_spec_atttributes(
         &write_state_.image_spec, &denoise_params, ATTR_DENOISE_SOCKET_PREFIX);
 
+    need_full_frame_processing_ = denoise_params.use;
+
     /* Not adaptive sampling overscan yet for baking, would need overscan also
      * for buffers read from the output driver. */
     if (adaptive_sampling.use && !scene->bake_manager->get_baking()) {
@@ -379,6 +381,7 @@ void TileManager::update(const BufferParams &params, const Scene *scene)
   else {
     write_state_.image_spec = ImageSpec();
     overscan_ = 0;
+    need_full_frame_processing_ = false;
   }
 }
 
@@ -74,6 +74,13 @@ class TileManager {
     return overscan_;
   }
 
+  /* Check whether the full frame is to be post-processed once all tiles are rendered (i.e. it is
+   * to be denoised). This requires the tiles to be stored in a file on disk. */
+  inline bool need_full_frame_processing() const
+  {
+    return need_full_frame_processing_;
+  }
+
   bool next();
   bool done();
 
@@ -135,6 +142,8 @@ class TileManager {
   /* Number of extra pixels around the actual tile to render. */
   int overscan_ = 0;
 
+  bool need_full_frame_processing_ = false;
+
   BufferParams buffer_params_;
 
   /* Tile scheduling state. */
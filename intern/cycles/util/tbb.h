@@ -9,6 +9,7 @@
  * WIN32_LEAN_AND_MEAN and similar are defined beforehand. */
 #include "util/windows.h"
 
+#include <tbb/blocked_range2d.h>
 #include <tbb/enumerable_thread_specific.h>
 #include <tbb/parallel_for.h>
 #include <tbb/parallel_for_each.h>
@@ -24,6 +25,7 @@
 CCL_NAMESPACE_BEGIN
 
 using tbb::blocked_range;
+using tbb::blocked_range2d;
 using tbb::enumerable_thread_specific;
 using tbb::parallel_for;
 using tbb::parallel_for_each;
@@ -149,6 +149,17 @@ extern void (*MEM_callbackmemlist)(void (*func)(void *));
 /** Print statistics about memory usage */
 extern void (*MEM_printmemlist_stats)(void);
 
+/**
+ * Call \a func for every distinct allocation name, with the number of blocks allocated with that
+ * name and their total size in bytes. Names are only stored by the guarded allocator (enabled with
+ * the memory debugging command line argument), the lock-free allocator never calls \a func.
+ */
+extern void (*MEM_foreach_name_stats)(void (*func)(const char *name,
+                                                   unsigned int items,
+                                                   size_t len,
+                                                   void *user_data),
+                                      void *user_data);
+
 /** Set the callback function for error output. */
 extern void (*MEM_set_error_callback)(void (*func)(const char *));
 
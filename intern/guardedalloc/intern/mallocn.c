@@ -41,6 +41,11 @@ void (*MEM_printmemlist_pydict)(void) = MEM_lockfree_printmemlist_pydict;
 void (*MEM_printmemlist)(void) = MEM_lockfree_printmemlist;
 void (*MEM_callbackmemlist)(void (*func)(void *)) = MEM_lockfree_callbackmemlist;
 void (*MEM_printmemlist_stats)(void) = MEM_lockfree_printmemlist_stats;
+void (*MEM_foreach_name_stats)(void (*func)(const char *name,
+                                            uint items,
+                                            size_t len,
+                                            void *user_data),
+                               void *user_data) = MEM_lockfree_foreach_name_stats;
 void (*MEM_set_error_callback)(void (*func)(const char *)) = MEM_lockfree_set_error_callback;
 bool (*MEM_consistency_check)(void) = MEM_lockfree_consistency_check;
 void (*MEM_set_memory_debug)(void) = MEM_lockfree_set_memory_debug;
@@ -123,6 +128,7 @@ void MEM_use_lockfree_allocator(void)
   MEM_printmemlist = MEM_lockfree_printmemlist;
   MEM_callbackmemlist = MEM_lockfree_callbackmemlist;
   MEM_printmemlist_stats = MEM_lockfree_printmemlist_stats;
+  MEM_foreach_name_stats = MEM_lockfree_foreach_name_stats;
   MEM_set_error_callback = MEM_lockfree_set_error_callback;
   MEM_consistency_check = MEM_lockfree_consistency_check;
   MEM_set_memory_debug = MEM_lockfree_set_memory_debug;
@@ -157,6 +163,7 @@ void MEM_use_guarded_allocator(void)
   MEM_printmemlist = MEM_guarded_printmemlist;
   MEM_callbackmemlist = MEM_guarded_callbackmemlist;
   MEM_printmemlist_stats = MEM_guarded_printmemlist_stats;
+  MEM_foreach_name_stats = MEM_guarded_foreach_name_stats;
   MEM_set_error_callback = MEM_guarded_set_error_callback;
   MEM_consistency_check = MEM_guarded_consistency_check;
   MEM_set_memory_debug = MEM_guarded_set_memory_debug;
@@ -614,27 +614,30 @@ static int compare_len(const void *p1, const void *p2)
   return -1;
 }
 
-void MEM_guarded_printmemlist_stats(void)
+/**
+ * Collect all allocated blocks into an array, with blocks of the same name merged together.
+ * Must be called with the memory lock held. The returned array must be freed with `free()`.
+ */
+static MemPrintBlock *mem_printblock_collect(uint *r_totpb, size_t *r_mem_in_use_slop)
 {
   MemHead *membl;
   MemPrintBlock *pb, *printblock;
   uint totpb, a, b;
   size_t mem_in_use_slop = 0;
 
-  mem_lock_thread();
+  *r_totpb = 0;
+  *r_mem_in_use_slop = 0;
 
-  if (totblock != 0) {
-    /* put memory blocks into array */
-    printblock = malloc(sizeof(MemPrintBlock) * totblock);
-
-    if (UNLIKELY(!printblock)) {
-      mem_unlock_thread();
-      print_error("malloc returned null while generating stats");
-      return;
-    }
+  if (totblock == 0) {
+    return NULL;
   }
-  else {
-    printblock = NULL;
+
+  /* put memory blocks into array */
+  printblock = malloc(sizeof(MemPrintBlock) * totblock);
+
+  if (UNLIKELY(!printblock)) {
+    print_error("malloc returned null while generating stats");
+    return NULL;
   }
 
   pb = printblock;
@@ -686,7 +689,21 @@ void MEM_guarded_printmemlist_stats(void)
       memcpy(&printblock[b], &printblock[a], sizeof(MemPrintBlock));
     }
   }
-  totpb = b + 1;
+
+  *r_totpb = totpb ? b + 1 : 0;
+  *r_mem_in_use_slop = mem_in_use_slop;
+  return printblock;
+}
+
+void MEM_guarded_printmemlist_stats(void)
+{
+  MemPrintBlock *pb, *printblock;
+  uint totpb, a;
+  size_t mem_in_use_slop;
+
+  mem_lock_thread();
+
+  printblock = mem_printblock_collect(&totpb, &mem_in_use_slop);
 
   /* sort by length and print */
   if (totpb > 1) {
@@ -717,6 +734,30 @@ void MEM_guarded_printmemlist_stats(void)
 #endif
 }
 
+void MEM_guarded_foreach_name_stats(void (*func)(const char *name,
+                                                 uint items,
+                                                 size_t len,
+                                                 void *user_data),
+                                    void *user_data)
+{
+  MemPrintBlock *printblock;
+  uint totpb, a;
+  size_t mem_in_use_slop;
+
+  mem_lock_thread();
+  printblock = mem_printblock_collect(&totpb, &mem_in_use_slop);
+  mem_unlock_thread();
+
+  /* Call outside of the lock, the callback is allowed to allocate memory. */
+  for (a = 0; a < totpb; a++) {
+    func(printblock[a].name, (uint)printblock[a].items, (size_t)printblock[a].len, user_data);
+  }
+
+  if (printblock != NULL) {
+    free(printblock);
+  }
+}
+
 static const char mem_printmemlist_pydict_script[] =
     "mb_userinfo = {}\n"
     "totmem = 0\n"
@@ -160,6 +160,11 @@ void MEM_lockfree_printmemlist_pydict(void);
 void MEM_lockfree_printmemlist(void);
 void MEM_lockfree_callbackmemlist(void (*func)(void *));
 void MEM_lockfree_printmemlist_stats(void);
+void MEM_lockfree_foreach_name_stats(void (*func)(const char *name,
+                                                  unsigned int items,
+                                                  size_t len,
+                                                  void *user_data),
+                                     void *user_data);
 void MEM_lockfree_set_error_callback(void (*func)(const char *));
 bool MEM_lockfree_consistency_check(void);
 void MEM_lockfree_set_memory_debug(void);
@@ -207,6 +212,11 @@ void MEM_guarded_printmemlist_pydict(void);
 void MEM_guarded_printmemlist(void);
 void MEM_guarded_callbackmemlist(void (*func)(void *));
 void MEM_guarded_printmemlist_stats(void);
+void MEM_guarded_foreach_name_stats(void (*func)(const char *name,
+                                                 unsigned int items,
+                                                 size_t len,
+                                                 void *user_data),
+                                    void *user_data);
 void MEM_guarded_set_error_callback(void (*func)(const char *));
 bool MEM_guarded_consistency_check(void);
 void MEM_guarded_set_memory_debug(void);
@@ -360,6 +360,17 @@ void MEM_lockfree_printmemlist_stats(void)
 #endif
 }
 
+/* The lock-free allocator doesn't store block names, so there are no statistics to report. */
+void MEM_lockfree_foreach_name_stats(void (*func)(const char *name,
+                                                  uint items,
+                                                  size_t len,
+                                                  void *user_data),
+                                     void *user_data)
+{
+  (void)func;
+  (void)user_data;
+}
+
 void MEM_lockfree_set_error_callback(void (*func)(const char *))
 {
   error_callback = func;
@@ -2562,6 +2562,10 @@ class USERPREF_PT_experimental_prototypes(ExperimentalPanel, Panel):
                 ({"property": "use_grease_pencil_version3"}, ("blender/blender/projects/6", "Grease Pencil 3.0")),
                 ({"property": "enable_overlay_next"}, ("blender/blender/issues/102179", "#102179")),
                 ({"property": "use_extension_repos"}, ("/blender/blender/issues/106254", "#106254")),
+                ({"property": "use_evaluated_frame_cache"}, None),
+                ({"property": "use_geometry_nodes_result_cache"}, None),
+                ({"property": "use_geometry_nodes_shared_evaluation"}, None),
+                ({"property": "use_shader_binary_cache"}, None),
             ),
         )
 
@@ -0,0 +1,155 @@
+# This script is an example of how you can keep a single blender process running
+# in background mode and send it jobs over a socket, avoiding the cost of starting
+# blender (and compiling shaders, loading render kernels... etc) for every task.
+#
+# Example usage for this test.
+#  blender --background --factory-startup --python $HOME/background_job_server.py -- \
+#          --port=8765 --token=secret
+#
+# Jobs are sent as one JSON object per line, each job gets a single JSON line in reply.
+# Example using netcat:
+#  echo '{"token": "secret", "open": "/tmp/hello.blend"}' | nc localhost 8765
+#  echo '{"token": "secret", "render": "/tmp/hello", "frame": 10}' | nc localhost 8765
+#  echo '{"token": "secret", "script": "/tmp/my_script.py"}' | nc localhost 8765
+#  echo '{"token": "secret", "reset": true}' | nc localhost 8765
+#  echo '{"token": "secret", "quit": true}' | nc localhost 8765
+#
+# WARNING: jobs run arbitrary Python scripts and open arbitrary .blend files (which may contain
+# auto-running scripts too), so anyone who can connect to the server can run any code with the
+# permissions of this process. Only listen on trusted interfaces. Every job has to contain the
+# shared token passed with '--token', or the token that is printed on startup when none is given.
+#
+# Notice:
+# '--factory-startup' is used to avoid the user default settings from
+#                     interfering with automated scene generation.
+#
+# '--' causes blender to ignore all following arguments so python can use them.
+#
+# See blender --help for details.
+
+
+import bpy
+
+
+def job_reset(_value):
+    # Clear all data, keeping the process (and its caches) alive.
+    bpy.ops.wm.read_factory_settings(use_empty=True)
+
+
+def job_open(filepath):
+    bpy.ops.wm.open_mainfile(filepath=filepath)
+
+
+def job_script(filepath):
+    with open(filepath, "r", encoding="utf-8") as fh:
+        code = compile(fh.read(), filepath, "exec")
+    exec(code, {"__name__": "__main__", "__file__": filepath})
+
+
+def job_render(render_path, frame=None):
+    scene = bpy.context.scene
+    if frame is not None:
+        scene.frame_set(frame)
+    render = scene.render
+    render.use_file_extension = True
+    render.filepath = render_path
+    bpy.ops.render.render(write_still=True)
+
+
+def job_execute(job):
+    # Run the actions of a job in a fixed order so a single request
+    # can open a file, run a script on it and render it.
+    if job.get("reset"):
+        job_reset(job["reset"])
+    if "open" in job:
+        job_open(job["open"])
+    if "script" in job:
+        job_script(job["script"])
+    if "render" in job:
+        job_render(job["render"], frame=job.get("frame"))
+
+
+def serve(host, port, token):
+    import hmac
+    import json
+    import socket
+    import traceback
+
+    with socket.create_server((host, port)) as server:
+        print("job server listening on {:s}:{:d}".format(host, port))
+        while True:
+            connection, _address = server.accept()
+            with connection, connection.makefile("rw", encoding="utf-8") as stream:
+                for line in stream:
+                    line = line.strip()
+                    if not line:
+                        continue
+                    try:
+                        job = json.loads(line)
+                        if not hmac.compare_digest(str(job.get("token", "")), token):
+                            raise PermissionError("invalid token")
+                        if job.get("quit"):
+                            stream.write(json.dumps({"status": "OK"}) + "\n")
+                            stream.flush()
+                            return
+                        job_execute(job)
+                        reply = {"status": "OK"}
+                    except Exception as ex:
+                        traceback.print_exc()
+                        reply = {"status": "ERROR", "message": str(ex)}
+                    stream.write(json.dumps(reply) + "\n")
+                    stream.flush()
+
+
+def main():
+    import sys       # to get command line args
+    import argparse  # to parse options for us and print a nice help message
+
+    # get the args passed to blender after "--", all of which are ignored by
+    # blender so scripts may receive their own arguments
+    argv = sys.argv
+
+    if "--" not in argv:
+        argv = []  # as if no args are passed
+    else:
+        argv = argv[argv.index("--") + 1:]  # get all args after "--"
+
+    usage_text = (
+        "Run blender in background mode with this script:"
+        "  blender --background --python " + __file__ + " -- [options]"
+    )
+
+    parser = argparse.ArgumentParser(description=usage_text)
+
+    parser.add_argument(
+        "--host", dest="host", type=str, default="localhost",
+        help="Address to listen on (defaults to localhost, WARNING: only use trusted interfaces)",
+    )
+    parser.add_argument(
+        "-p", "--port", dest="port", type=int, default=8765,
+        help="Port to listen on",
+    )
+    parser.add_argument(
+        "-t", "--token", dest="token", type=str, default="",
+        help="Shared token every job has to contain (a random token is printed when not given)",
+    )
+
+    args = parser.parse_args(argv)
+
+    if not bpy.app.background:
+        print("Error: this script must be run in background mode, aborting.")
+        return
+
+    token = args.token
+    if not token:
+        import secrets
+        token = secrets.token_hex(16)
+        print("job server token: {:s}".format(token))
+
+    serve(args.host, args.port, token)
+
+    print("job server finished, exiting")
+
+
+if __name__ == "__main__":
+    main()
@@ -61,6 +61,11 @@ struct NodeCache {
 
   /** Where to load blobs from disk when loading the baked data lazily. */
   std::optional<std::string> blobs_dir;
+  /**
+   * Keeps blob files open between the loading of different frames. This avoids opening the same
+   * files many times, because frames often reference blobs that were written for earlier frames.
+   */
+  std::unique_ptr<DiskBlobReader> blob_reader;
   /** Used to avoid reading blobs multiple times for different frames. */
   std::unique_ptr<BlobSharing> blob_sharing;
   /** Used to avoid checking if a bake exists many times. */
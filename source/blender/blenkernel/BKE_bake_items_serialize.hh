@@ -110,6 +110,12 @@ class BlobSharing {
  */
 class DiskBlobReader : public BlobReader {
  private:
+  /**
+   * The reader may be kept alive for a long time to avoid opening the same files again. Limit the
+   * number of open files to avoid running into operating system limits.
+   */
+  static constexpr int max_open_streams = 64;
+
   const std::string blobs_dir_;
   mutable std::mutex mutex_;
   mutable Map<std::string, std::unique_ptr<fstream>> open_input_streams_;
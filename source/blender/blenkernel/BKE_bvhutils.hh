@@ -246,3 +246,8 @@ BVHCache *bvhcache_init();
  * Frees a BVH-cache.
  */
 void bvhcache_free(BVHCache *bvh_cache);
+/**
+ * Keep the trees that only depend on the topology so that they can be refit to the new positions
+ * when they are requested again, instead of building them from scratch. Other trees are freed.
+ */
+void bvhcache_tag_positions_changed(BVHCache *bvh_cache);
@@ -353,6 +353,11 @@ class CurvesGeometry : public ::CurvesGeometry {
 
   /** Call after deforming the position attribute. */
   void tag_positions_changed();
+  /**
+   * Call after deforming the positions of only some curves. Evaluated data that is already
+   * cached is updated for the changed curves instead of being recomputed for all curves.
+   */
+  void tag_positions_changed(const IndexMask &changed_curves);
   /**
    * Call after any operation that changes the topology
    * (number of points, evaluated points, or the total count).
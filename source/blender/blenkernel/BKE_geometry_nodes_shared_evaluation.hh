@@ -0,0 +1,67 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bke
+ *
+ * Many objects often use the same geometry nodes modifier on the same geometry with the same
+ * inputs, for example when they are linked from the same asset. Within a single dependency graph
+ * evaluation, such modifiers result in the same geometry, so it only has to be computed once. The
+ * result is then implicitly shared by all objects.
+ *
+ * The storage is owned by the dependency graph and is cleared after every evaluation, so other
+ * data that a node tree depends on (like the scene time or other objects) can't change while an
+ * evaluation is shared.
+ */
+
+#include <memory>
+#include <mutex>
+
+#include "BLI_cache_mutex.hh"
+#include "BLI_map.hh"
+#include "BLI_vector.hh"
+
+#include "BKE_geometry_set.hh"
+
+struct bNodeTree;
+struct IDProperty;
+
+namespace blender::bke {
+
+class GeometryNodesSharedEvaluations {
+ public:
+  struct Evaluation {
+    /**
+     * The inputs that identify the evaluation. The input geometry is kept alive, so that its data
+     * can't be freed and replaced by other data at the same address.
+     */
+    IDProperty *properties = nullptr;
+    GeometrySet input_geometry;
+
+    /** Computes #result only once, other threads wait until it is available. */
+    CacheMutex result_mutex;
+    GeometrySet result;
+
+    ~Evaluation();
+  };
+
+ private:
+  std::mutex mutex_;
+  Map<const bNodeTree *, Vector<std::shared_ptr<Evaluation>>> evaluations_by_tree_;
+
+ public:
+  /**
+   * Find the evaluation of the node tree with the same inputs, or add a new one. Null is returned
+   * when the input geometry contains data that can't be compared cheaply.
+   */
+  std::shared_ptr<Evaluation> lookup_or_add(const bNodeTree &tree,
+                                            const IDProperty *properties,
+                                            const GeometrySet &input_geometry);
+
+  void clear();
+};
+
+}  // namespace blender::bke
@@ -209,6 +209,11 @@ struct GeometrySet {
   void clear();
 
   bool owns_direct_data() const;
+  /**
+   * Approximate number of bytes used by the attribute arrays of all components (not including
+   * nested instances). Implicit sharing of the arrays is not taken into account.
+   */
+  int64_t attributes_memory_estimate() const;
   /**
    * Make sure that the geometry can be cached. This does not ensure ownership of object/collection
    * instances. This is necessary because sometimes components only have read-only or editing
@@ -291,6 +291,13 @@ void mesh_vert_normals_assign(Mesh &mesh, Span<float3> vert_normals);
 /** Set mesh vertex normals to known-correct values, avoiding future lazy computation. */
 void mesh_vert_normals_assign(Mesh &mesh, Vector<float3> vert_normals);
 
+/**
+ * Call after changing the positions of some vertices instead of
+ * #BKE_mesh_tag_positions_changed. Face and vertex normals that are cached already are only
+ * recomputed around the changed vertices. Corner normals and other caches are tagged dirty.
+ */
+void mesh_tag_positions_changed_partial(Mesh &mesh, const IndexMask &changed_verts);
+
 }  // namespace blender::bke
 
 /* -------------------------------------------------------------------- */
@@ -0,0 +1,99 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bke
+ *
+ * Cache of evaluated object geometry per frame, used to make revisiting frames (for example when
+ * scrubbing the timeline back and forth) cheap. The cached data is implicitly shared with the
+ * evaluated data, so storing a frame only costs memory once the evaluated data at the next frame
+ * differs from it.
+ *
+ * The cache is owned by the dependency graph, which clears it whenever anything other than the
+ * time changes, so entries only have to be keyed by the object and the scene time.
+ */
+
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "BLI_map.hh"
+
+#include "DNA_customdata_types.h"
+
+struct Mesh;
+struct Object;
+
+namespace blender::bke {
+
+struct GeometrySet;
+
+class ObjectFrameCache {
+ public:
+  /** Approximate limit of the memory used by all cached frames. */
+  static constexpr size_t memory_limit = size_t(2) << 30;
+
+ private:
+  struct Key {
+    uint32_t object_session_uuid;
+    float ctime;
+
+    uint64_t hash() const;
+    friend bool operator==(const Key &a, const Key &b)
+    {
+      return a.object_session_uuid == b.object_session_uuid && a.ctime == b.ctime;
+    }
+  };
+
+  struct Entry {
+    CustomData_MeshMasks data_mask;
+    bool need_mapping;
+    Mesh *mesh_eval;
+    Mesh *mesh_deform_eval;
+    std::unique_ptr<GeometrySet> geometry_set;
+    size_t memory;
+
+    ~Entry();
+  };
+
+  std::mutex mutex_;
+  Map<Key, std::unique_ptr<Entry>> entries_;
+  /** Keys in the order they were added, to free the oldest frames first. */
+  std::deque<Key> order_;
+  size_t memory_ = 0;
+
+ public:
+  ~ObjectFrameCache();
+
+  /**
+   * Get copies of cached evaluated meshes of the object at the given time, if there are any
+   * which contain at least the requested data.
+   * The returned meshes and geometry set are owned by the caller.
+   */
+  bool lookup(const Object &object,
+              float ctime,
+              const CustomData_MeshMasks &data_mask,
+              bool need_mapping,
+              Mesh **r_mesh_eval,
+              Mesh **r_mesh_deform_eval,
+              GeometrySet **r_geometry_set);
+
+  /**
+   * Store the result of the modifier stack evaluation of the object at the given time.
+   * The passed geometry set must not contain the final mesh yet.
+   */
+  void add(const Object &object,
+           float ctime,
+           const CustomData_MeshMasks &data_mask,
+           bool need_mapping,
+           const Mesh &mesh_eval,
+           const Mesh *mesh_deform_eval,
+           const GeometrySet &geometry_set);
+
+  void clear();
+};
+
+}  // namespace blender::bke
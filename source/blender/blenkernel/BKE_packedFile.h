@@ -106,6 +106,18 @@ int BKE_packedfile_write_to_file(struct ReportList *reports,
                                  const char *filepath,
                                  struct PackedFile *pf);
 
+/**
+ * Make the packed file's data shareable, see #PackedFile::sharing_info.
+ */
+void BKE_packedfile_ensure_sharing_info(struct PackedFile *pf);
+
+/**
+ * Make packed files with identical content share their data, so that e.g. the same texture or
+ * font packed in several libraries is only stored once in memory.
+ * Only packed files of IDs tagged with #LIB_TAG_NEW get their data replaced.
+ */
+void BKE_packedfile_share_identical_data(struct Main *bmain);
+
 /* Free. */
 
 void BKE_packedfile_free(struct PackedFile *pf);
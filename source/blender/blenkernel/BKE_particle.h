@@ -163,6 +163,12 @@ typedef struct ParticleThreadContext {
   struct CurveMapping *clumpcurve;
   struct CurveMapping *roughcurve;
   struct CurveMapping *twistcurve;
+  /**
+   * Sample positions and accumulated integral of #twistcurve along the path segments, so the
+   * curve is not integrated again for every key of every child.
+   */
+  float *twist_integral_x, *twist_integral;
+  int twist_integral_len;
 } ParticleThreadContext;
 
 typedef struct ParticleTask {
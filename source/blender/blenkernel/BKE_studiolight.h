@@ -130,6 +130,7 @@ typedef struct StudioLight {
 
 /* API */
 
+/** Studio-lights are only read from disk when first accessed. */
 void BKE_studiolight_init(void);
 void BKE_studiolight_free(void);
 void BKE_studiolight_default(SolidLight lights[4], float light_ambient[3]);
@@ -54,6 +54,7 @@
 #include "BKE_multires.hh"
 #include "BKE_object.hh"
 #include "BKE_object_deform.h"
+#include "BKE_object_frame_cache.hh"
 #include "BKE_object_types.hh"
 #include "BKE_paint.hh"
 #include "BKE_subdiv_modifier.hh"
@@ -1305,17 +1306,38 @@ static void mesh_build_data(Depsgraph *depsgraph,
 
   Mesh *mesh_eval = nullptr, *mesh_deform_eval = nullptr;
   GeometrySet *geometry_set_eval = nullptr;
-  mesh_calc_modifiers(depsgraph,
-                      scene,
-                      ob,
-                      true,
-                      need_mapping,
-                      dataMask,
-                      true,
-                      true,
-                      &mesh_deform_eval,
-                      &mesh_eval,
-                      &geometry_set_eval);
+
+  /* Paint modes and sculpt modify the evaluated state in place, only cache in object mode. Without
+   * modifiers the evaluated mesh is a cheap copy of the original, not worth to be cached. */
+  blender::bke::ObjectFrameCache *frame_cache =
+      (ob->mode == OB_MODE_OBJECT && !BLI_listbase_is_empty(&ob->modifiers)) ?
+          DEG_get_object_frame_cache(depsgraph) :
+          nullptr;
+  const float ctime = DEG_get_ctime(depsgraph);
+  if (frame_cache == nullptr || !frame_cache->lookup(*ob,
+                                                     ctime,
+                                                     *dataMask,
+                                                     need_mapping,
+                                                     &mesh_eval,
+                                                     &mesh_deform_eval,
+                                                     &geometry_set_eval))
+  {
+    mesh_calc_modifiers(depsgraph,
+                        scene,
+                        ob,
+                        true,
+                        need_mapping,
+                        dataMask,
+                        true,
+                        true,
+                        &mesh_deform_eval,
+                        &mesh_eval,
+                        &geometry_set_eval);
+    if (frame_cache) {
+      frame_cache->add(
+          *ob, ctime, *dataMask, need_mapping, *mesh_eval, mesh_deform_eval, *geometry_set_eval);
+    }
+  }
 
   /* The modifier stack evaluation is storing result in mesh->runtime.mesh_eval, but this result
    * is not guaranteed to be owned by object.
@@ -338,6 +338,11 @@ static bool is_fcurve_evaluatable(FCurve *fcu)
   return true;
 }
 
+static bool animsys_rna_path_resolve_validate(const PointerRNA *ptr,
+                                              const char *path,
+                                              int array_index,
+                                              PathResolvedRNA *r_result);
+
 bool BKE_animsys_rna_path_resolve(
     PointerRNA *ptr, /* typically 'fcu->rna_path', 'fcu->array_index' */
     const char *rna_path,
@@ -363,6 +368,17 @@ bool BKE_animsys_rna_path_resolve(
     return false;
   }
 
+  return animsys_rna_path_resolve_validate(ptr, path, array_index, r_result);
+}
+
+/**
+ * Check that the resolved property can be animated and that the array index is valid.
+ */
+static bool animsys_rna_path_resolve_validate(const PointerRNA *ptr,
+                                              const char *path,
+                                              const int array_index,
+                                              PathResolvedRNA *r_result)
+{
   if (ptr->owner_id != nullptr && !RNA_property_animateable(&r_result->ptr, r_result->prop)) {
     return false;
   }
@@ -384,6 +400,71 @@ bool BKE_animsys_rna_path_resolve(
   return true;
 }
 
+/**
+ * Remembers the struct that the previous RNA path resolved to. Consecutive F-Curves usually
+ * animate properties of the same struct (e.g. all channels of a pose bone), so the property can
+ * be looked up directly in that struct instead of resolving the whole path again.
+ */
+struct AnimsysRNAPathCache {
+  /** Path of the struct, referencing the `rna_path` of a previous F-Curve. */
+  blender::StringRef struct_path;
+  PointerRNA struct_ptr;
+  bool is_valid = false;
+};
+
+static bool animsys_rna_path_resolve_cached(PointerRNA *ptr,
+                                            const char *rna_path,
+                                            const int array_index,
+                                            AnimsysRNAPathCache &cache,
+                                            PathResolvedRNA *r_result)
+{
+  if (rna_path == nullptr) {
+    return false;
+  }
+  /* Only paths ending with a simple property identifier are split, everything else (custom
+   * properties, array access, etc.) uses the regular path resolving. */
+  const blender::StringRef path = rna_path;
+  const int64_t dot_pos = path.rfind('.');
+  const blender::StringRef struct_path = path.substr(0, std::max<int64_t>(dot_pos, 0));
+  const blender::StringRef identifier = path.substr(dot_pos + 1);
+  char struct_path_buf[256];
+  if (identifier.is_empty() || struct_path.size() >= sizeof(struct_path_buf) ||
+      std::any_of(identifier.begin(), identifier.end(), [](const char c) {
+        return !(isalnum(c) || c == '_');
+      }))
+  {
+    return BKE_animsys_rna_path_resolve(ptr, rna_path, array_index, r_result);
+  }
+
+  if (!cache.is_valid || cache.struct_path != struct_path) {
+    cache.struct_path = struct_path;
+    if (struct_path.is_empty()) {
+      cache.struct_ptr = *ptr;
+      cache.is_valid = true;
+    }
+    else {
+      struct_path.unsafe_copy(struct_path_buf);
+      PropertyRNA *struct_prop;
+      cache.is_valid = RNA_path_resolve(ptr, struct_path_buf, &cache.struct_ptr, &struct_prop) &&
+                       struct_prop == nullptr;
+    }
+  }
+
+  if (cache.is_valid) {
+    char identifier_buf[MAX_IDPROP_NAME];
+    if (identifier.size() < sizeof(identifier_buf)) {
+      identifier.unsafe_copy(identifier_buf);
+      r_result->ptr = cache.struct_ptr;
+      r_result->prop = RNA_struct_find_property(&r_result->ptr, identifier_buf);
+      if (r_result->prop != nullptr) {
+        return animsys_rna_path_resolve_validate(ptr, rna_path, array_index, r_result);
+      }
+    }
+  }
+  /* Fall back to the regular path resolving, which also reports errors. */
+  return BKE_animsys_rna_path_resolve(ptr, rna_path, array_index, r_result);
+}
+
 /* less than 1.0 evaluates to false, use epsilon to avoid float error */
 #define ANIMSYS_FLOAT_AS_BOOL(value) ((value) > (1.0f - FLT_EPSILON))
 
@@ -562,6 +643,8 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
                                      const AnimationEvalContext *anim_eval_context,
                                      bool flush_to_original)
 {
+  AnimsysRNAPathCache path_cache;
+
   /* Calculate then execute each curve. */
   LISTBASE_FOREACH (FCurve *, fcu, list) {
 
@@ -570,7 +653,9 @@ static void animsys_evaluate_fcurves(PointerRNA *ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (BKE_animsys_rna_path_resolve(ptr, fcu->rna_path, fcu->array_index, &anim_rna)) {
+    if (animsys_rna_path_resolve_cached(
+            ptr, fcu->rna_path, fcu->array_index, path_cache, &anim_rna))
+    {
       const float curval = calculate_fcurve(&anim_rna, fcu, anim_eval_context);
       BKE_animsys_write_to_rna_path(&anim_rna, curval);
       if (flush_to_original) {
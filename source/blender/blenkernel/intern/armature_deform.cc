@@ -201,6 +201,7 @@ static float dist_bone_deform(const bPoseChannel *pchan,
 }
 
 static void pchan_bone_deform(const bPoseChannel *pchan,
+                              const bool use_bbone,
                               const float weight,
                               float vec[3],
                               DualQuat *dq,
@@ -209,13 +210,11 @@ static void pchan_bone_deform(const bPoseChannel *pchan,
                               const bool full_deform,
                               float *contrib)
 {
-  const Bone *bone = pchan->bone;
-
   if (!weight) {
     return;
   }
 
-  if (bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments) {
+  if (use_bbone) {
     b_bone_deform(pchan, co, weight, vec, dq, mat, full_deform);
   }
   else {
@@ -234,6 +233,20 @@ static void pchan_bone_deform(const bPoseChannel *pchan,
  * #BKE_armature_deform_coords and related functions.
  * \{ */
 
+/**
+ * Deform data of a vertex group, gathered once before the vertex loop so the per-weight loop
+ * does not have to look up the bone and its settings again.
+ */
+struct ArmatureDeformGroup {
+  /** Null when the group has no deforming bone. */
+  const bPoseChannel *pchan;
+  const Bone *bone;
+  /** Deform with the B-Bone segments instead of the bone matrix. */
+  bool use_bbone;
+  /** Multiply the vertex group weight with the bone envelope. */
+  bool use_envelope_multiply;
+};
+
 struct ArmatureUserdata {
   const Object *ob_arm;
   const Mesh *me_target;
@@ -251,7 +264,7 @@ struct ArmatureUserdata {
   const MDeformVert *dverts;
   int dverts_len;
 
-  bPoseChannel **pchan_from_defbase;
+  const ArmatureDeformGroup *deform_groups;
   int defbase_len;
 
   float premat[4][4];
@@ -343,19 +356,25 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     uint j;
     for (j = dvert->totweight; j != 0; j--, dw++) {
       const uint index = dw->def_nr;
-      if (index < data->defbase_len && (pchan = data->pchan_from_defbase[index])) {
-        float weight = dw->weight;
-        const Bone *bone = pchan->bone;
+      if (index >= data->defbase_len) {
+        continue;
+      }
+      const ArmatureDeformGroup &group = data->deform_groups[index];
+      if (group.pchan == nullptr) {
+        continue;
+      }
+      float weight = dw->weight;
 
-        deformed = 1;
+      deformed = 1;
 
-        if (bone && bone->flag & BONE_MULT_VG_ENV) {
-          weight *= distfactor_to_bone(
-              co, bone->arm_head, bone->arm_tail, bone->rad_head, bone->rad_tail, bone->dist);
-        }
-
-        pchan_bone_deform(pchan, weight, vec, dq, smat, co, full_deform, &contrib);
+      if (group.use_envelope_multiply) {
+        const Bone *bone = group.bone;
+        weight *= distfactor_to_bone(
+            co, bone->arm_head, bone->arm_tail, bone->rad_head, bone->rad_tail, bone->dist);
       }
+
+      pchan_bone_deform(
+          group.pchan, group.use_bbone, weight, vec, dq, smat, co, full_deform, &contrib);
     }
     /* If there are vertex-groups but not groups with bones (like for soft-body groups). */
     if (deformed == 0 && use_envelope) {
@@ -491,7 +510,7 @@ static void armature_deform_coords_impl(const Object *ob_arm,
                                         bGPDstroke *gps_target)
 {
   const bArmature *arm = static_cast<const bArmature *>(ob_arm->data);
-  bPoseChannel **pchan_from_defbase = nullptr;
+  ArmatureDeformGroup *deform_groups = nullptr;
   const MDeformVert *dverts = nullptr;
   const bool use_envelope = (deformflag & ARM_DEF_ENVELOPE) != 0;
   const bool use_quaternion = (deformflag & ARM_DEF_QUATERNION) != 0;
@@ -562,21 +581,26 @@ static void armature_deform_coords_impl(const Object *ob_arm,
       }
 
       if (use_dverts) {
-        pchan_from_defbase = static_cast<bPoseChannel **>(
-            MEM_callocN(sizeof(*pchan_from_defbase) * defbase_len, "defnrToBone"));
+        deform_groups = static_cast<ArmatureDeformGroup *>(
+            MEM_callocN(sizeof(*deform_groups) * defbase_len, "defnrToBone"));
         /* TODO(sergey): Some considerations here:
          *
          * - Check whether keeping this consistent across frames gives speedup.
          */
         int i;
         LISTBASE_FOREACH_INDEX (bDeformGroup *, dg, defbase, i) {
-          pchan_from_defbase[i] = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
+          const bPoseChannel *pchan = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
           /* exclude non-deforming bones */
-          if (pchan_from_defbase[i]) {
-            if (pchan_from_defbase[i]->bone->flag & BONE_NO_DEFORM) {
-              pchan_from_defbase[i] = nullptr;
-            }
+          if (pchan == nullptr || pchan->bone->flag & BONE_NO_DEFORM) {
+            continue;
           }
+          const Bone *bone = pchan->bone;
+          ArmatureDeformGroup &group = deform_groups[i];
+          group.pchan = pchan;
+          group.bone = bone;
+          group.use_bbone = bone->segments > 1 &&
+                            pchan->runtime.bbone_segments == bone->segments;
+          group.use_envelope_multiply = (bone->flag & BONE_MULT_VG_ENV) != 0;
         }
       }
     }
@@ -595,7 +619,7 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   data.armature_def_nr = armature_def_nr;
   data.dverts = dverts;
   data.dverts_len = dverts_len;
-  data.pchan_from_defbase = pchan_from_defbase;
+  data.deform_groups = deform_groups;
   data.defbase_len = defbase_len;
   data.bmesh.cd_dvert_offset = cd_dvert_offset;
 
@@ -629,8 +653,8 @@ static void armature_deform_coords_impl(const Object *ob_arm,
     BLI_task_parallel_range(0, vert_coords_len, &data, armature_vert_task, &settings);
   }
 
-  if (pchan_from_defbase) {
-    MEM_freeN(pchan_from_defbase);
+  if (deform_groups) {
+    MEM_freeN(deform_groups);
   }
 }
 
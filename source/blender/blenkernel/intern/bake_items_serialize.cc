@@ -60,6 +60,9 @@ DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blo
   BLI_path_join(blob_path, sizeof(blob_path), blobs_dir_.c_str(), slice.name.c_str());
 
   std::lock_guard lock{mutex_};
+  if (open_input_streams_.size() >= max_open_streams && !open_input_streams_.contains(blob_path)) {
+    open_input_streams_.clear();
+  }
   std::unique_ptr<fstream> &blob_file = open_input_streams_.lookup_or_add_cb_as(blob_path, [&]() {
     return std::make_unique<fstream>(blob_path, std::ios::in | std::ios::binary);
   });
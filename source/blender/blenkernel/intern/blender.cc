@@ -42,6 +42,8 @@
 
 #include "DEG_depsgraph.hh"
 
+#include "NOD_geometry_nodes_result_cache.hh"
+
 #include "RE_pipeline.h"
 #include "RE_texture.h"
 
@@ -74,6 +76,7 @@ void BKE_blender_free()
   IMB_exit();
   BKE_cachefiles_exit();
   DEG_free_node_types();
+  blender::nodes::GeoNodeResultCache::get().clear();
 
   BKE_brush_system_exit();
   RE_texture_rng_exit();
@@ -26,10 +26,13 @@
 
 #include "DNA_scene_types.h"
 
+#include "BLI_listbase.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_utildefines.h"
 
+#include "PIL_time.h"
+
 #include "BKE_appdir.h"
 #include "BKE_blender_undo.h" /* own include */
 #include "BKE_blendfile.h"
@@ -44,6 +47,10 @@
 
 #include "DEG_depsgraph.hh"
 
+#include "CLG_log.h"
+
+static CLG_LogRef LOG = {"bke.blender_undo"};
+
 /* -------------------------------------------------------------------- */
 /** \name Global Undo
  * \{ */
@@ -131,8 +138,28 @@ MemFileUndoData *BKE_memfile_undo_encode(Main *bmain, MemFileUndoData *mfu_prev)
     if (prevfile) {
       BLO_memfile_clear_future(prevfile);
     }
+    const double time_start = PIL_check_seconds_timer();
     /* success = */ /* UNUSED */ BLO_write_file_mem(bmain, prevfile, &mfu->memfile, fileflags);
     mfu->undo_size = mfu->memfile.size;
+
+    if (CLOG_CHECK(&LOG, 1)) {
+      /* Chunks that are not owned by this step are shared with the previous one. */
+      size_t shared_size = 0;
+      int chunks_num = 0;
+      LISTBASE_FOREACH (MemFileChunk *, chunk, &mfu->memfile.chunks) {
+        if (chunk->is_identical) {
+          shared_size += chunk->size;
+        }
+        chunks_num++;
+      }
+      CLOG_INFO(&LOG,
+                1,
+                "Memfile step written in %.3f ms: %d chunks, %zu bytes new, %zu bytes shared",
+                (PIL_check_seconds_timer() - time_start) * 1000.0,
+                chunks_num,
+                mfu->memfile.size,
+                shared_size);
+    }
   }
 
   bmain->is_memfile_undo_written = true;
@@ -15,11 +15,13 @@
 #include "DNA_pointcloud_types.h"
 
 #include "BLI_bit_vector.hh"
+#include "BLI_function_ref.hh"
 #include "BLI_linklist.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_vector.h"
 #include "BLI_span.hh"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -35,6 +37,7 @@
 using blender::BitSpan;
 using blender::BitVector;
 using blender::float3;
+using blender::FunctionRef;
 using blender::IndexRange;
 using blender::Span;
 using blender::VArray;
@@ -46,8 +49,23 @@ using blender::VArray;
 struct BVHCacheItem {
   bool is_filled;
   BVHTree *tree;
+  /**
+   * A tree that was built before the positions changed, see #bvhcache_tag_positions_changed.
+   * Its structure is still valid, so it is refit to the new positions when the tree is requested
+   * again, which is much cheaper than building a new tree.
+   */
+  BVHTree *outdated_tree;
+  /**
+   * Cost of the tree when it was built (see #BLI_bvhtree_get_sah_cost), zero when unknown.
+   * Refitting can make the tree much less efficient when elements move a lot relative to each
+   * other, it is rebuilt when its cost grew too much compared to this.
+   */
+  float build_cost;
 };
 
+/** Rebuild refit trees whose cost grew by more than this factor since they were built. */
+#define BVHTREE_REFIT_MAX_COST_FACTOR 2.0f
+
 struct BVHCache {
   BVHCacheItem items[BVHTREE_MAX_ITEM];
   ThreadMutex mutex;
@@ -148,12 +166,87 @@ void bvhcache_free(BVHCache *bvh_cache)
   for (int index = 0; index < BVHTREE_MAX_ITEM; index++) {
     BVHCacheItem *item = &bvh_cache->items[index];
     BLI_bvhtree_free(item->tree);
+    BLI_bvhtree_free(item->outdated_tree);
     item->tree = nullptr;
+    item->outdated_tree = nullptr;
   }
   BLI_mutex_end(&bvh_cache->mutex);
   MEM_freeN(bvh_cache);
 }
 
+static bool bvhcache_type_supports_refit(const BVHCacheType type)
+{
+  /* Trees of the other types only contain some of the elements, or use edit-mode data. */
+  return ELEM(type, BVHTREE_FROM_VERTS, BVHTREE_FROM_EDGES, BVHTREE_FROM_LOOPTRI);
+}
+
+void bvhcache_tag_positions_changed(BVHCache *bvh_cache)
+{
+  for (int index = 0; index < BVHTREE_MAX_ITEM; index++) {
+    BVHCacheItem *item = &bvh_cache->items[index];
+    if (!item->is_filled) {
+      continue;
+    }
+    BLI_bvhtree_free(item->outdated_tree);
+    item->outdated_tree = nullptr;
+    if (bvhcache_type_supports_refit(BVHCacheType(index))) {
+      if (item->build_cost == 0.0f && item->tree != nullptr) {
+        /* The tree wasn't refit yet, so this is the cost of the built tree. */
+        item->build_cost = BLI_bvhtree_get_sah_cost(item->tree);
+      }
+      item->outdated_tree = item->tree;
+    }
+    else {
+      BLI_bvhtree_free(item->tree);
+      item->build_cost = 0.0f;
+    }
+    item->tree = nullptr;
+    item->is_filled = false;
+  }
+}
+
+/**
+ * Take the outdated tree of the given type from the cache and update its bounds to the new
+ * positions. Null is returned when there is no tree that can be reused. Must be called with the
+ * cache locked.
+ */
+static BVHTree *bvhcache_refit_outdated_tree(BVHCache *bvh_cache,
+                                             const BVHCacheType type,
+                                             const int tree_type,
+                                             const int elems_num,
+                                             const FunctionRef<void(BVHTree *, int)> fn)
+{
+  BVHCacheItem *item = &bvh_cache->items[type];
+  BVHTree *tree = item->outdated_tree;
+  if (tree == nullptr) {
+    return nullptr;
+  }
+  item->outdated_tree = nullptr;
+  if (BLI_bvhtree_get_tree_type(tree) != tree_type || BLI_bvhtree_get_len(tree) != elems_num) {
+    BLI_bvhtree_free(tree);
+    item->build_cost = 0.0f;
+    return nullptr;
+  }
+  /* Leaves are updated in parallel because every leaf is only written once. */
+  blender::threading::isolate_task([&]() {
+    blender::threading::parallel_for(IndexRange(elems_num), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        fn(tree, i);
+      }
+    });
+  });
+  BLI_bvhtree_update_tree(tree);
+  if (item->build_cost > 0.0f &&
+      BLI_bvhtree_get_sah_cost(tree) > item->build_cost * BVHTREE_REFIT_MAX_COST_FACTOR)
+  {
+    /* The elements moved too much relative to each other, a new tree is faster to query. */
+    BLI_bvhtree_free(tree);
+    item->build_cost = 0.0f;
+    return nullptr;
+  }
+  return tree;
+}
+
 /**
  * BVH-tree balancing inside a mutex lock must be run in isolation. Balancing
  * is multithreaded, and we do not want the current thread to start another task
@@ -1159,6 +1252,45 @@ BVHTree *BKE_bvhtree_from_mesh_get(BVHTreeFromMesh *data,
     return data->tree;
   }
 
+  if (lock_started) {
+    data->tree = nullptr;
+    switch (bvh_cache_type) {
+      case BVHTREE_FROM_VERTS:
+        data->tree = bvhcache_refit_outdated_tree(
+            *bvh_cache_p, bvh_cache_type, tree_type, mesh->totvert, [&](BVHTree *tree, int i) {
+              BLI_bvhtree_update_node(tree, i, positions[i], nullptr, 1);
+            });
+        break;
+      case BVHTREE_FROM_EDGES:
+        data->tree = bvhcache_refit_outdated_tree(
+            *bvh_cache_p, bvh_cache_type, tree_type, edges.size(), [&](BVHTree *tree, int i) {
+              float co[2][3];
+              copy_v3_v3(co[0], positions[edges[i][0]]);
+              copy_v3_v3(co[1], positions[edges[i][1]]);
+              BLI_bvhtree_update_node(tree, i, co[0], nullptr, 2);
+            });
+        break;
+      case BVHTREE_FROM_LOOPTRI:
+        data->tree = bvhcache_refit_outdated_tree(
+            *bvh_cache_p, bvh_cache_type, tree_type, looptris.size(), [&](BVHTree *tree, int i) {
+              float co[3][3];
+              copy_v3_v3(co[0], positions[corner_verts[looptris[i].tri[0]]]);
+              copy_v3_v3(co[1], positions[corner_verts[looptris[i].tri[1]]]);
+              copy_v3_v3(co[2], positions[corner_verts[looptris[i].tri[2]]]);
+              BLI_bvhtree_update_node(tree, i, co[0], nullptr, 3);
+            });
+        break;
+      default:
+        break;
+    }
+    if (data->tree) {
+      data->cached = true;
+      bvhcache_insert(*bvh_cache_p, data->tree, bvh_cache_type);
+      bvhcache_unlock(*bvh_cache_p, lock_started);
+      return data->tree;
+    }
+  }
+
   /* Create BVHTree. */
 
   switch (bvh_cache_type) {
@@ -184,28 +184,31 @@ static void fill_mesh_positions(const int main_point_num,
                                 const Span<float> radii,
                                 MutableSpan<float3> mesh_positions)
 {
+  /* Only the rotation and scale are stored in a matrix, the translation is added separately to
+   * avoid the cost of building and applying a full 4x4 transform for every point. */
   if (profile_point_num == 1) {
     for (const int i_ring : IndexRange(main_point_num)) {
-      float4x4 point_matrix = math::from_orthonormal_axes<float4x4>(
-          main_positions[i_ring], normals[i_ring], tangents[i_ring]);
+      float3x3 point_matrix = math::from_orthonormal_axes<float3x3>(normals[i_ring],
+                                                                    tangents[i_ring]);
       if (!radii.is_empty()) {
         point_matrix = math::scale(point_matrix, float3(radii[i_ring]));
       }
-      mesh_positions[i_ring] = math::transform_point(point_matrix, profile_positions.first());
+      mesh_positions[i_ring] = main_positions[i_ring] + point_matrix * profile_positions.first();
     }
   }
   else {
     for (const int i_ring : IndexRange(main_point_num)) {
-      float4x4 point_matrix = math::from_orthonormal_axes<float4x4>(
-          main_positions[i_ring], normals[i_ring], tangents[i_ring]);
+      float3x3 point_matrix = math::from_orthonormal_axes<float3x3>(normals[i_ring],
+                                                                    tangents[i_ring]);
       if (!radii.is_empty()) {
         point_matrix = math::scale(point_matrix, float3(radii[i_ring]));
       }
 
+      const float3 ring_position = main_positions[i_ring];
       const int ring_vert_start = i_ring * profile_point_num;
       for (const int i_profile : IndexRange(profile_point_num)) {
-        mesh_positions[ring_vert_start + i_profile] = math::transform_point(
-            point_matrix, profile_positions[i_profile]);
+        mesh_positions[ring_vert_start + i_profile] = ring_position +
+                                                      point_matrix * profile_positions[i_profile];
       }
     }
   }
@@ -268,52 +271,50 @@ static ResultOffsets calculate_result_offsets(const CurvesInfo &info, const bool
         result.loop.reinitialize(result.total + 1);
         result.face.reinitialize(result.total + 1);
 
-        int mesh_index = 0;
-        int vert_offset = 0;
-        int edge_offset = 0;
-        int loop_offset = 0;
-        int face_offset = 0;
-        for (const int i_main : main_offsets.index_range()) {
-          const bool main_cyclic = info.main_cyclic[i_main];
-          const int main_point_num = main_offsets[i_main].size();
-          const int main_segment_num = segments_num_no_duplicate_edge(main_point_num, main_cyclic);
-          for (const int i_profile : profile_offsets.index_range()) {
-            result.vert[mesh_index] = vert_offset;
-            result.edge[mesh_index] = edge_offset;
-            result.loop[mesh_index] = loop_offset;
-            result.face[mesh_index] = face_offset;
-
-            const bool profile_cyclic = info.profile_cyclic[i_profile];
-            const int profile_point_num = profile_offsets[i_profile].size();
-            const int profile_segment_num = curves::segments_num(profile_point_num,
-                                                                 profile_cyclic);
-
-            const bool has_caps = fill_caps && !main_cyclic && profile_cyclic &&
-                                  profile_point_num > 2;
-            const int tube_face_num = main_segment_num * profile_segment_num;
-
-            vert_offset += main_point_num * profile_point_num;
-
-            /* Add the ring edges, with one ring for every curve vertex, and the edge loops
-             * that run along the length of the curve, starting on the first profile. */
-            edge_offset += main_point_num * profile_segment_num +
-                           main_segment_num * profile_point_num;
-
-            /* Add two cap N-gons for every ending. */
-            face_offset += tube_face_num + (has_caps ? 2 : 0);
-
-            /* All faces on the tube are quads, and all cap faces are N-gons with an edge for each
-             * profile edge. */
-            loop_offset += tube_face_num * 4 + (has_caps ? profile_segment_num * 2 : 0);
-
-            mesh_index++;
+        /* Count the elements of every combination in parallel, then accumulate the counts to
+         * offsets. This matters with many main curves, like when converting hair. */
+        const int profiles_num = profile_offsets.size();
+        const int64_t grain_size = std::max<int64_t>(1, 1024 / std::max(profiles_num, 1));
+        threading::parallel_for(main_offsets.index_range(), grain_size, [&](IndexRange range) {
+          for (const int i_main : range) {
+            const bool main_cyclic = info.main_cyclic[i_main];
+            const int main_point_num = main_offsets[i_main].size();
+            const int main_segment_num = segments_num_no_duplicate_edge(main_point_num,
+                                                                        main_cyclic);
+            for (const int i_profile : profile_offsets.index_range()) {
+              const int mesh_index = i_main * profiles_num + i_profile;
+
+              const bool profile_cyclic = info.profile_cyclic[i_profile];
+              const int profile_point_num = profile_offsets[i_profile].size();
+              const int profile_segment_num = curves::segments_num(profile_point_num,
+                                                                   profile_cyclic);
+
+              const bool has_caps = fill_caps && !main_cyclic && profile_cyclic &&
+                                    profile_point_num > 2;
+              const int tube_face_num = main_segment_num * profile_segment_num;
+
+              result.vert[mesh_index] = main_point_num * profile_point_num;
+
+              /* Add the ring edges, with one ring for every curve vertex, and the edge loops
+               * that run along the length of the curve, starting on the first profile. */
+              result.edge[mesh_index] = main_point_num * profile_segment_num +
+                                        main_segment_num * profile_point_num;
+
+              /* Add two cap N-gons for every ending. */
+              result.face[mesh_index] = tube_face_num + (has_caps ? 2 : 0);
+
+              /* All faces on the tube are quads, and all cap faces are N-gons with an edge for
+               * each profile edge. */
+              result.loop[mesh_index] = tube_face_num * 4 +
+                                        (has_caps ? profile_segment_num * 2 : 0);
+            }
           }
-        }
+        });
 
-        result.vert.last() = vert_offset;
-        result.edge.last() = edge_offset;
-        result.loop.last() = loop_offset;
-        result.face.last() = face_offset;
+        offset_indices::accumulate_counts_to_offsets(result.vert);
+        offset_indices::accumulate_counts_to_offsets(result.edge);
+        offset_indices::accumulate_counts_to_offsets(result.loop);
+        offset_indices::accumulate_counts_to_offsets(result.face);
       },
       [&]() {
         result.main_indices.reinitialize(result.total);
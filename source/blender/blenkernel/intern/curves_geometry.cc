@@ -647,6 +647,74 @@ void CurvesGeometry::ensure_nurbs_basis_cache() const
   });
 }
 
+static void calculate_evaluated_positions(const CurvesGeometry &curves,
+                                          const IndexMask &curves_mask,
+                                          MutableSpan<float3> evaluated_positions)
+{
+  const OffsetIndices<int> points_by_curve = curves.points_by_curve();
+  const OffsetIndices<int> evaluated_points_by_curve = curves.evaluated_points_by_curve();
+  const Span<float3> positions = curves.positions();
+
+  auto evaluate_catmull = [&](const IndexMask &selection) {
+    const VArray<bool> cyclic = curves.cyclic();
+    const VArray<int> resolution = curves.resolution();
+    selection.foreach_index(GrainSize(128), [&](const int curve_index) {
+      const IndexRange points = points_by_curve[curve_index];
+      const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+      curves::catmull_rom::interpolate_to_evaluated(positions.slice(points),
+                                                    cyclic[curve_index],
+                                                    resolution[curve_index],
+                                                    evaluated_positions.slice(evaluated_points));
+    });
+  };
+  auto evaluate_poly = [&](const IndexMask &selection) {
+    array_utils::copy_group_to_group(
+        points_by_curve, evaluated_points_by_curve, selection, positions, evaluated_positions);
+  };
+  auto evaluate_bezier = [&](const IndexMask &selection) {
+    const Span<float3> handle_positions_left = curves.handle_positions_left();
+    const Span<float3> handle_positions_right = curves.handle_positions_right();
+    if (handle_positions_left.is_empty() || handle_positions_right.is_empty()) {
+      curves::fill_points(evaluated_points_by_curve, selection, float3(0), evaluated_positions);
+      return;
+    }
+    const Span<int> all_bezier_offsets =
+        curves.runtime->evaluated_offsets_cache.data().all_bezier_offsets;
+    selection.foreach_index(GrainSize(128), [&](const int curve_index) {
+      const IndexRange points = points_by_curve[curve_index];
+      const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+      const IndexRange offsets = curves::per_curve_point_offsets_range(points, curve_index);
+      curves::bezier::calculate_evaluated_positions(positions.slice(points),
+                                                    handle_positions_left.slice(points),
+                                                    handle_positions_right.slice(points),
+                                                    all_bezier_offsets.slice(offsets),
+                                                    evaluated_positions.slice(evaluated_points));
+    });
+  };
+  auto evaluate_nurbs = [&](const IndexMask &selection) {
+    const VArray<int8_t> nurbs_orders = curves.nurbs_orders();
+    const Span<float> nurbs_weights = curves.nurbs_weights();
+    const Span<curves::nurbs::BasisCache> nurbs_basis_cache =
+        curves.runtime->nurbs_basis_cache.data();
+    selection.foreach_index(GrainSize(128), [&](const int curve_index) {
+      const IndexRange points = points_by_curve[curve_index];
+      const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+      curves::nurbs::interpolate_to_evaluated(nurbs_basis_cache[curve_index],
+                                              nurbs_orders[curve_index],
+                                              nurbs_weights.slice_safe(points),
+                                              positions.slice(points),
+                                              evaluated_positions.slice(evaluated_points));
+    });
+  };
+  curves::foreach_curve_by_type(curves.curve_types(),
+                                curves.curve_type_counts(),
+                                curves_mask,
+                                evaluate_catmull,
+                                evaluate_poly,
+                                evaluate_bezier,
+                                evaluate_nurbs);
+}
+
 Span<float3> CurvesGeometry::evaluated_positions() const
 {
   const bke::CurvesGeometryRuntime &runtime = *this->runtime;
@@ -658,126 +726,68 @@ Span<float3> CurvesGeometry::evaluated_positions() const
   this->ensure_nurbs_basis_cache();
   runtime.evaluated_position_cache.ensure([&](Vector<float3> &r_data) {
     r_data.resize(this->evaluated_points_num());
-    MutableSpan<float3> evaluated_positions = r_data;
+    calculate_evaluated_positions(*this, this->curves_range(), r_data);
+  });
+  return runtime.evaluated_position_cache.data();
+}
 
-    const OffsetIndices<int> points_by_curve = this->points_by_curve();
-    const OffsetIndices<int> evaluated_points_by_curve = this->evaluated_points_by_curve();
-    const Span<float3> positions = this->positions();
+static void calculate_evaluated_tangents(const CurvesGeometry &curves,
+                                         const IndexMask &curves_mask,
+                                         const Span<float3> evaluated_positions,
+                                         MutableSpan<float3> tangents)
+{
+  const OffsetIndices<int> evaluated_points_by_curve = curves.evaluated_points_by_curve();
+  const VArray<bool> cyclic = curves.cyclic();
 
-    auto evaluate_catmull = [&](const IndexMask &selection) {
-      const VArray<bool> cyclic = this->cyclic();
-      const VArray<int> resolution = this->resolution();
-      selection.foreach_index(GrainSize(128), [&](const int curve_index) {
-        const IndexRange points = points_by_curve[curve_index];
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        curves::catmull_rom::interpolate_to_evaluated(positions.slice(points),
-                                                      cyclic[curve_index],
-                                                      resolution[curve_index],
-                                                      evaluated_positions.slice(evaluated_points));
-      });
-    };
-    auto evaluate_poly = [&](const IndexMask &selection) {
-      array_utils::copy_group_to_group(
-          points_by_curve, evaluated_points_by_curve, selection, positions, evaluated_positions);
-    };
-    auto evaluate_bezier = [&](const IndexMask &selection) {
-      const Span<float3> handle_positions_left = this->handle_positions_left();
-      const Span<float3> handle_positions_right = this->handle_positions_right();
-      if (handle_positions_left.is_empty() || handle_positions_right.is_empty()) {
-        curves::fill_points(evaluated_points_by_curve, selection, float3(0), evaluated_positions);
+  curves_mask.foreach_index(GrainSize(128), [&](const int curve_index) {
+    const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+    curves::poly::calculate_tangents(evaluated_positions.slice(evaluated_points),
+                                     cyclic[curve_index],
+                                     tangents.slice(evaluated_points));
+  });
+
+  /* Correct the first and last tangents of non-cyclic Bezier curves so that they align with
+   * the inner handles. This is a separate loop to avoid the cost when Bezier type curves are
+   * not used. */
+  IndexMaskMemory memory;
+  const IndexMask bezier_mask = curves.indices_for_curve_type(
+      CURVE_TYPE_BEZIER, curves_mask, memory);
+  if (!bezier_mask.is_empty()) {
+    const OffsetIndices<int> points_by_curve = curves.points_by_curve();
+    const Span<float3> positions = curves.positions();
+    const Span<float3> handles_left = curves.handle_positions_left();
+    const Span<float3> handles_right = curves.handle_positions_right();
+
+    bezier_mask.foreach_index(GrainSize(1024), [&](const int curve_index) {
+      if (cyclic[curve_index]) {
         return;
       }
-      const Span<int> all_bezier_offsets =
-          runtime.evaluated_offsets_cache.data().all_bezier_offsets;
-      selection.foreach_index(GrainSize(128), [&](const int curve_index) {
-        const IndexRange points = points_by_curve[curve_index];
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        const IndexRange offsets = curves::per_curve_point_offsets_range(points, curve_index);
-        curves::bezier::calculate_evaluated_positions(positions.slice(points),
-                                                      handle_positions_left.slice(points),
-                                                      handle_positions_right.slice(points),
-                                                      all_bezier_offsets.slice(offsets),
-                                                      evaluated_positions.slice(evaluated_points));
-      });
-    };
-    auto evaluate_nurbs = [&](const IndexMask &selection) {
-      this->ensure_nurbs_basis_cache();
-      const VArray<int8_t> nurbs_orders = this->nurbs_orders();
-      const Span<float> nurbs_weights = this->nurbs_weights();
-      const Span<curves::nurbs::BasisCache> nurbs_basis_cache = runtime.nurbs_basis_cache.data();
-      selection.foreach_index(GrainSize(128), [&](const int curve_index) {
-        const IndexRange points = points_by_curve[curve_index];
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        curves::nurbs::interpolate_to_evaluated(nurbs_basis_cache[curve_index],
-                                                nurbs_orders[curve_index],
-                                                nurbs_weights.slice_safe(points),
-                                                positions.slice(points),
-                                                evaluated_positions.slice(evaluated_points));
-      });
-    };
-    curves::foreach_curve_by_type(this->curve_types(),
-                                  this->curve_type_counts(),
-                                  this->curves_range(),
-                                  evaluate_catmull,
-                                  evaluate_poly,
-                                  evaluate_bezier,
-                                  evaluate_nurbs);
-  });
-  return runtime.evaluated_position_cache.data();
+      const IndexRange points = points_by_curve[curve_index];
+      const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+
+      const float epsilon = 1e-6f;
+      if (!math::almost_equal_relative(
+              handles_right[points.first()], positions[points.first()], epsilon))
+      {
+        tangents[evaluated_points.first()] = math::normalize(handles_right[points.first()] -
+                                                             positions[points.first()]);
+      }
+      if (!math::almost_equal_relative(
+              handles_left[points.last()], positions[points.last()], epsilon)) {
+        tangents[evaluated_points.last()] = math::normalize(positions[points.last()] -
+                                                            handles_left[points.last()]);
+      }
+    });
+  }
 }
 
 Span<float3> CurvesGeometry::evaluated_tangents() const
 {
   const bke::CurvesGeometryRuntime &runtime = *this->runtime;
   runtime.evaluated_tangent_cache.ensure([&](Vector<float3> &r_data) {
-    const OffsetIndices<int> evaluated_points_by_curve = this->evaluated_points_by_curve();
     const Span<float3> evaluated_positions = this->evaluated_positions();
-    const VArray<bool> cyclic = this->cyclic();
-
     r_data.resize(this->evaluated_points_num());
-    MutableSpan<float3> tangents = r_data;
-
-    threading::parallel_for(this->curves_range(), 128, [&](IndexRange curves_range) {
-      for (const int curve_index : curves_range) {
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        curves::poly::calculate_tangents(evaluated_positions.slice(evaluated_points),
-                                         cyclic[curve_index],
-                                         tangents.slice(evaluated_points));
-      }
-    });
-
-    /* Correct the first and last tangents of non-cyclic Bezier curves so that they align with
-     * the inner handles. This is a separate loop to avoid the cost when Bezier type curves are
-     * not used. */
-    IndexMaskMemory memory;
-    const IndexMask bezier_mask = this->indices_for_curve_type(CURVE_TYPE_BEZIER, memory);
-    if (!bezier_mask.is_empty()) {
-      const OffsetIndices<int> points_by_curve = this->points_by_curve();
-      const Span<float3> positions = this->positions();
-      const Span<float3> handles_left = this->handle_positions_left();
-      const Span<float3> handles_right = this->handle_positions_right();
-
-      bezier_mask.foreach_index(GrainSize(1024), [&](const int curve_index) {
-        if (cyclic[curve_index]) {
-          return;
-        }
-        const IndexRange points = points_by_curve[curve_index];
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-
-        const float epsilon = 1e-6f;
-        if (!math::almost_equal_relative(
-                handles_right[points.first()], positions[points.first()], epsilon))
-        {
-          tangents[evaluated_points.first()] = math::normalize(handles_right[points.first()] -
-                                                               positions[points.first()]);
-        }
-        if (!math::almost_equal_relative(
-                handles_left[points.last()], positions[points.last()], epsilon)) {
-          tangents[evaluated_points.last()] = math::normalize(positions[points.last()] -
-                                                              handles_left[points.last()]);
-        }
-      });
-    }
+    calculate_evaluated_tangents(*this, this->curves_range(), evaluated_positions, r_data);
   });
   return runtime.evaluated_tangent_cache.data();
 }
@@ -828,80 +838,88 @@ static void evaluate_generic_data_for_curve(
   }
 }
 
-Span<float3> CurvesGeometry::evaluated_normals() const
+static void calculate_evaluated_normals(const CurvesGeometry &curves,
+                                        const IndexMask &curves_mask,
+                                        const Span<float3> evaluated_tangents,
+                                        MutableSpan<float3> evaluated_normals)
 {
-  const bke::CurvesGeometryRuntime &runtime = *this->runtime;
-  this->ensure_nurbs_basis_cache();
-  runtime.evaluated_normal_cache.ensure([&](Vector<float3> &r_data) {
-    const OffsetIndices<int> points_by_curve = this->points_by_curve();
-    const OffsetIndices<int> evaluated_points_by_curve = this->evaluated_points_by_curve();
-    const VArray<int8_t> types = this->curve_types();
-    const VArray<bool> cyclic = this->cyclic();
-    const VArray<int8_t> normal_mode = this->normal_mode();
-    const VArray<int> resolution = this->resolution();
-    const VArray<int8_t> nurbs_orders = this->nurbs_orders();
-    const Span<float> nurbs_weights = this->nurbs_weights();
-    const Span<int> all_bezier_offsets = runtime.evaluated_offsets_cache.data().all_bezier_offsets;
-    const Span<curves::nurbs::BasisCache> nurbs_basis_cache = runtime.nurbs_basis_cache.data();
-
-    const Span<float3> evaluated_tangents = this->evaluated_tangents();
-    const VArray<float> tilt = this->tilt();
-    VArraySpan<float> tilt_span;
-    const bool use_tilt = !(tilt.is_single() && tilt.get_internal_single() == 0.0f);
-    if (use_tilt) {
-      tilt_span = tilt;
-    }
+  const OffsetIndices<int> points_by_curve = curves.points_by_curve();
+  const OffsetIndices<int> evaluated_points_by_curve = curves.evaluated_points_by_curve();
+  const VArray<int8_t> types = curves.curve_types();
+  const VArray<bool> cyclic = curves.cyclic();
+  const VArray<int8_t> normal_mode = curves.normal_mode();
+  const VArray<int> resolution = curves.resolution();
+  const VArray<int8_t> nurbs_orders = curves.nurbs_orders();
+  const Span<float> nurbs_weights = curves.nurbs_weights();
+  const Span<int> all_bezier_offsets =
+      curves.runtime->evaluated_offsets_cache.data().all_bezier_offsets;
+  const Span<curves::nurbs::BasisCache> nurbs_basis_cache =
+      curves.runtime->nurbs_basis_cache.data();
+
+  const VArray<float> tilt = curves.tilt();
+  VArraySpan<float> tilt_span;
+  const bool use_tilt = !(tilt.is_single() && tilt.get_internal_single() == 0.0f);
+  if (use_tilt) {
+    tilt_span = tilt;
+  }
 
-    r_data.resize(this->evaluated_points_num());
-    MutableSpan<float3> evaluated_normals = r_data;
+  curves_mask.foreach_segment(GrainSize(128), [&](const IndexMaskSegment segment) {
+    /* Reuse a buffer for the evaluated tilts. */
+    Vector<float> evaluated_tilts;
 
-    threading::parallel_for(this->curves_range(), 128, [&](IndexRange curves_range) {
-      /* Reuse a buffer for the evaluated tilts. */
-      Vector<float> evaluated_tilts;
+    for (const int curve_index : segment) {
+      const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
+      switch (normal_mode[curve_index]) {
+        case NORMAL_MODE_Z_UP:
+          curves::poly::calculate_normals_z_up(evaluated_tangents.slice(evaluated_points),
+                                               evaluated_normals.slice(evaluated_points));
+          break;
+        case NORMAL_MODE_MINIMUM_TWIST:
+          curves::poly::calculate_normals_minimum(evaluated_tangents.slice(evaluated_points),
+                                                  cyclic[curve_index],
+                                                  evaluated_normals.slice(evaluated_points));
+          break;
+      }
 
-      for (const int curve_index : curves_range) {
-        const IndexRange evaluated_points = evaluated_points_by_curve[curve_index];
-        switch (normal_mode[curve_index]) {
-          case NORMAL_MODE_Z_UP:
-            curves::poly::calculate_normals_z_up(evaluated_tangents.slice(evaluated_points),
-                                                 evaluated_normals.slice(evaluated_points));
-            break;
-          case NORMAL_MODE_MINIMUM_TWIST:
-            curves::poly::calculate_normals_minimum(evaluated_tangents.slice(evaluated_points),
-                                                    cyclic[curve_index],
-                                                    evaluated_normals.slice(evaluated_points));
-            break;
+      /* If the "tilt" attribute exists, rotate the normals around the tangents by the
+       * evaluated angles. We can avoid copying the tilts to evaluate them for poly curves. */
+      if (use_tilt) {
+        const IndexRange points = points_by_curve[curve_index];
+        if (types[curve_index] == CURVE_TYPE_POLY) {
+          rotate_directions_around_axes(evaluated_normals.slice(evaluated_points),
+                                        evaluated_tangents.slice(evaluated_points),
+                                        tilt_span.slice(points));
         }
-
-        /* If the "tilt" attribute exists, rotate the normals around the tangents by the
-         * evaluated angles. We can avoid copying the tilts to evaluate them for poly curves. */
-        if (use_tilt) {
-          const IndexRange points = points_by_curve[curve_index];
-          if (types[curve_index] == CURVE_TYPE_POLY) {
-            rotate_directions_around_axes(evaluated_normals.slice(evaluated_points),
-                                          evaluated_tangents.slice(evaluated_points),
-                                          tilt_span.slice(points));
-          }
-          else {
-            evaluated_tilts.reinitialize(evaluated_points.size());
-            evaluate_generic_data_for_curve(curve_index,
-                                            points,
-                                            types,
-                                            cyclic,
-                                            resolution,
-                                            all_bezier_offsets,
-                                            nurbs_basis_cache,
-                                            nurbs_orders,
-                                            nurbs_weights,
-                                            tilt_span.slice(points),
-                                            evaluated_tilts.as_mutable_span());
-            rotate_directions_around_axes(evaluated_normals.slice(evaluated_points),
-                                          evaluated_tangents.slice(evaluated_points),
-                                          evaluated_tilts.as_span());
-          }
+        else {
+          evaluated_tilts.reinitialize(evaluated_points.size());
+          evaluate_generic_data_for_curve(curve_index,
+                                          points,
+                                          types,
+                                          cyclic,
+                                          resolution,
+                                          all_bezier_offsets,
+                                          nurbs_basis_cache,
+                                          nurbs_orders,
+                                          nurbs_weights,
+                                          tilt_span.slice(points),
+                                          evaluated_tilts.as_mutable_span());
+          rotate_directions_around_axes(evaluated_normals.slice(evaluated_points),
+                                        evaluated_tangents.slice(evaluated_points),
+                                        evaluated_tilts.as_span());
         }
       }
-    });
+    }
+  });
+}
+
+Span<float3> CurvesGeometry::evaluated_normals() const
+{
+  const bke::CurvesGeometryRuntime &runtime = *this->runtime;
+  this->ensure_nurbs_basis_cache();
+  runtime.evaluated_normal_cache.ensure([&](Vector<float3> &r_data) {
+    const Span<float3> evaluated_tangents = this->evaluated_tangents();
+    r_data.resize(this->evaluated_points_num());
+    calculate_evaluated_normals(*this, this->curves_range(), evaluated_tangents, r_data);
   });
   return this->runtime->evaluated_normal_cache.data();
 }
@@ -1027,6 +1045,47 @@ void CurvesGeometry::tag_positions_changed()
   this->runtime->evaluated_length_cache.tag_dirty();
   this->runtime->bounds_cache.tag_dirty();
 }
+void CurvesGeometry::tag_positions_changed(const IndexMask &changed_curves)
+{
+  bke::CurvesGeometryRuntime &runtime = *this->runtime;
+  /* Without existing evaluated data there is nothing to update, and when most curves are
+   * affected, recomputing everything lazily is just as fast. */
+  if (changed_curves.size() > this->curves_num() / 2 || changed_curves.is_empty() ||
+      !runtime.evaluated_tangent_cache.is_cached())
+  {
+    if (!changed_curves.is_empty()) {
+      this->tag_positions_changed();
+    }
+    return;
+  }
+
+  /* Update the cached data of the changed curves only, see #SharedCache::update. */
+  this->ensure_nurbs_basis_cache();
+  if (!this->is_single_type(CURVE_TYPE_POLY)) {
+    if (!runtime.evaluated_position_cache.is_cached()) {
+      this->tag_positions_changed();
+      return;
+    }
+    runtime.evaluated_position_cache.update([&](Vector<float3> &r_data) {
+      calculate_evaluated_positions(*this, changed_curves, r_data);
+    });
+  }
+  const Span<float3> evaluated_positions = this->evaluated_positions();
+  runtime.evaluated_tangent_cache.update([&](Vector<float3> &r_data) {
+    calculate_evaluated_tangents(*this, changed_curves, evaluated_positions, r_data);
+  });
+  if (runtime.evaluated_normal_cache.is_cached()) {
+    const Span<float3> evaluated_tangents = runtime.evaluated_tangent_cache.data();
+    runtime.evaluated_normal_cache.update([&](Vector<float3> &r_data) {
+      calculate_evaluated_normals(*this, changed_curves, evaluated_tangents, r_data);
+    });
+  }
+  else {
+    runtime.evaluated_normal_cache.tag_dirty();
+  }
+  runtime.evaluated_length_cache.tag_dirty();
+  runtime.bounds_cache.tag_dirty();
+}
 void CurvesGeometry::tag_topology_changed()
 {
   this->tag_positions_changed();
@@ -1048,15 +1107,6 @@ static void translate_positions(MutableSpan<float3> positions, const float3 &tra
   });
 }
 
-static void transform_positions(MutableSpan<float3> positions, const float4x4 &matrix)
-{
-  threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
-    for (float3 &position : positions.slice(range)) {
-      position = math::transform_point(matrix, position);
-    }
-  });
-}
-
 void CurvesGeometry::calculate_bezier_auto_handles()
 {
   if (!this->has_curve_with_type(CURVE_TYPE_BEZIER)) {
@@ -1118,12 +1168,12 @@ void CurvesGeometry::translate(const float3 &translation)
 
 void CurvesGeometry::transform(const float4x4 &matrix)
 {
-  transform_positions(this->positions_for_write(), matrix);
+  math::transform_points(matrix, this->positions_for_write());
   if (!this->handle_positions_left().is_empty()) {
-    transform_positions(this->handle_positions_left_for_write(), matrix);
+    math::transform_points(matrix, this->handle_positions_left_for_write());
   }
   if (!this->handle_positions_right().is_empty()) {
-    transform_positions(this->handle_positions_right_for_write(), matrix);
+    math::transform_points(matrix, this->handle_positions_right_for_write());
   }
   this->tag_positions_changed();
 }
@@ -70,7 +70,8 @@ using blender::Span;
 using blender::StringRef;
 using blender::Vector;
 
-/* number of layers to add when growing a CustomData object */
+/* Minimum number of layers to add when growing a CustomData object. Larger layer arrays grow
+ * proportionally to their size, see #customData_reserve_layers. */
 #define CUSTOMDATA_GROW 5
 
 /* ensure typemap size is ok */
@@ -2138,6 +2139,7 @@ static CustomDataLayer *customData_add_layer__internal(
     const ImplicitSharingInfo *sharing_info_to_assign,
     int totelem,
     const char *name);
+static void customData_reserve_layers(CustomData *data, int layers_num);
 
 void CustomData_update_typemap(CustomData *data)
 {
@@ -2202,6 +2204,16 @@ static bool customdata_merge_internal(const CustomData *source,
   int current_type_layer_count = 0;
   int max_current_type_layer_count = -1;
 
+  /* Grow the layers array once for all layers that may be added, instead of growing it
+   * repeatedly while adding them one by one. */
+  int layers_to_add_num = 0;
+  for (const CustomDataLayer &src_layer : Span(source->layers, source->totlayer)) {
+    if (!(src_layer.flag & CD_FLAG_NOCOPY) && (mask & CD_TYPE_AS_MASK(src_layer.type))) {
+      layers_to_add_num++;
+    }
+  }
+  customData_reserve_layers(dest, dest->totlayer + layers_to_add_num);
+
   for (int i = 0; i < source->totlayer; i++) {
     const CustomDataLayer &src_layer = source->layers[i];
     const eCustomDataType type = eCustomDataType(src_layer.type);
@@ -2873,6 +2885,20 @@ static void customData_resize(CustomData *data, const int grow_amount)
   data->maxlayer += grow_amount;
 }
 
+/**
+ * Make sure there is space for at least \a layers_num layers. The array grows by at least half
+ * of its size, so that adding many layers one by one does not reallocate it every few layers.
+ */
+static void customData_reserve_layers(CustomData *data, const int layers_num)
+{
+  if (layers_num <= data->maxlayer) {
+    return;
+  }
+  const int min_grow_amount = std::max(CUSTOMDATA_GROW, data->maxlayer / 2);
+  const int new_maxlayer = std::max(layers_num, data->maxlayer + min_grow_amount);
+  customData_resize(data, new_maxlayer - data->maxlayer);
+}
+
 static CustomDataLayer *customData_add_layer__internal(
     CustomData *data,
     const eCustomDataType type,
@@ -2894,9 +2920,7 @@ static CustomDataLayer *customData_add_layer__internal(
   }
 
   int index = data->totlayer;
-  if (index >= data->maxlayer) {
-    customData_resize(data, CUSTOMDATA_GROW);
-  }
+  customData_reserve_layers(data, index + 1);
 
   data->totlayer++;
 
@@ -3148,8 +3172,10 @@ bool CustomData_free_layer(CustomData *data,
     }
   }
 
-  if (data->totlayer <= data->maxlayer - CUSTOMDATA_GROW) {
-    customData_resize(data, -CUSTOMDATA_GROW);
+  /* Only shrink when most of the array is unused, so that removing and adding layers
+   * alternately does not reallocate the array every time. */
+  if (data->maxlayer > CUSTOMDATA_GROW && data->totlayer * 4 <= data->maxlayer) {
+    customData_resize(data, std::max(data->totlayer * 2, CUSTOMDATA_GROW) - data->maxlayer);
   }
 
   customData_update_offsets(data);
@@ -4490,7 +4516,9 @@ bool CustomData_layer_validate(CustomDataLayer *layer, const uint totitems, cons
   }
 
   BLI_assert((totitems == 0) || layer->data);
-  BLI_assert(MEM_allocN_len(layer->data) >= totitems * typeInfo->size);
+  /* Data used directly from a memory-mapped file isn't allocated with guarded-alloc. */
+  BLI_assert(BLO_read_data_is_memory_mapped(layer->sharing_info) ||
+             MEM_allocN_len(layer->data) >= totitems * typeInfo->size);
 
   if (typeInfo->validate != nullptr) {
     return typeInfo->validate(layer->data, totitems, do_fixes);
@@ -5205,6 +5233,26 @@ static void blend_read_paint_mask(BlendDataReader *reader,
   }
 }
 
+/**
+ * Layers of trivial types can be used directly from the file data, see
+ * #BLO_read_shared_data_address. Their alignment must not exceed the 4 bytes guaranteed by the
+ * file format.
+ */
+static bool layer_data_can_be_read_shared(const eCustomDataType type)
+{
+  return ELEM(type,
+              CD_PROP_FLOAT,
+              CD_PROP_FLOAT2,
+              CD_PROP_FLOAT3,
+              CD_PROP_INT8,
+              CD_PROP_INT32,
+              CD_PROP_INT32_2D,
+              CD_PROP_BOOL,
+              CD_PROP_COLOR,
+              CD_PROP_BYTE_COLOR,
+              CD_PROP_QUATERNION);
+}
+
 void CustomData_blend_read(BlendDataReader *reader, CustomData *data, const int count)
 {
   BLO_read_data_address(reader, &data->layers);
@@ -5228,8 +5276,13 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, const int
     layer->sharing_info = nullptr;
 
     if (CustomData_verify_versions(data, i)) {
-      BLO_read_data_address(reader, &layer->data);
-      if (layer->data != nullptr) {
+      if (layer_data_can_be_read_shared(eCustomDataType(layer->type))) {
+        layer->sharing_info = BLO_read_shared_data_address(reader, &layer->data);
+      }
+      else {
+        BLO_read_data_address(reader, &layer->data);
+      }
+      if (layer->data != nullptr && layer->sharing_info == nullptr) {
         /* Make layer data shareable. */
         layer->sharing_info = make_implicit_sharing_info_for_layer(
             eCustomDataType(layer->type), layer->data, count);
@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <algorithm>
+
 #include "BLI_listbase.h"
 #include "BLI_task.hh"
 
@@ -168,13 +170,20 @@ static void adapt_mesh_domain_corner_to_point_impl(const Mesh &mesh,
                                                    MutableSpan<T> r_values)
 {
   BLI_assert(r_values.size() == mesh.totvert);
-  const Span<int> corner_verts = mesh.corner_verts();
-
-  attribute_math::DefaultMixer<T> mixer(r_values);
-  for (const int corner : IndexRange(mesh.totloop)) {
-    mixer.mix_in(corner_verts[corner], old_values[corner]);
-  }
-  mixer.finalize();
+  const GroupedSpan<int> vert_to_corner_map = mesh.vert_to_corner_map();
+
+  /* Gather the values of every vertex from the cached topology map, so that the vertices can be
+   * processed in parallel. The corners of every vertex are sorted, so the mixing order does not
+   * change compared to iterating over all corners. */
+  threading::parallel_for(r_values.index_range(), 2048, [&](const IndexRange range) {
+    attribute_math::DefaultMixer<T> mixer(r_values.slice(range));
+    for (const int vert : range) {
+      for (const int corner : vert_to_corner_map[vert]) {
+        mixer.mix_in(vert - range.start(), old_values[corner]);
+      }
+    }
+    mixer.finalize();
+  });
 }
 
 /* A vertex is selected if all connected face corners were selected and it is not loose. */
@@ -184,29 +193,17 @@ void adapt_mesh_domain_corner_to_point_impl(const Mesh &mesh,
                                             MutableSpan<bool> r_values)
 {
   BLI_assert(r_values.size() == mesh.totvert);
-  const Span<int> corner_verts = mesh.corner_verts();
-
-  r_values.fill(true);
-  for (const int corner : IndexRange(mesh.totloop)) {
-    const int point_index = corner_verts[corner];
-
-    if (!old_values[corner]) {
-      r_values[point_index] = false;
+  const GroupedSpan<int> vert_to_corner_map = mesh.vert_to_corner_map();
+
+  threading::parallel_for(r_values.index_range(), 2048, [&](const IndexRange range) {
+    for (const int vert : range) {
+      const Span<int> corners = vert_to_corner_map[vert];
+      r_values[vert] = !corners.is_empty() &&
+                       std::all_of(corners.begin(), corners.end(), [&](const int corner) {
+                         return old_values[corner];
+                       });
     }
-  }
-
-  /* Deselect loose vertices without corners that are still selected from the 'true' default. */
-  const LooseVertCache &loose_verts = mesh.verts_no_face();
-  if (loose_verts.count > 0) {
-    const BitSpan bits = loose_verts.is_loose_bits;
-    threading::parallel_for(bits.index_range(), 2048, [&](const IndexRange range) {
-      for (const int vert_index : range) {
-        if (bits[vert_index]) {
-          r_values[vert_index] = false;
-        }
-      }
-    });
-  }
+  });
 }
 
 static GVArray adapt_mesh_domain_corner_to_point(const Mesh &mesh, const GVArray &varray)
@@ -361,19 +358,17 @@ void adapt_mesh_domain_face_to_point_impl(const Mesh &mesh,
                                           MutableSpan<T> r_values)
 {
   BLI_assert(r_values.size() == mesh.totvert);
-  const OffsetIndices faces = mesh.faces();
-  const Span<int> corner_verts = mesh.corner_verts();
-
-  attribute_math::DefaultMixer<T> mixer(r_values);
+  const GroupedSpan<int> vert_to_face_map = mesh.vert_to_face_map();
 
-  for (const int face_index : faces.index_range()) {
-    const T value = old_values[face_index];
-    for (const int vert : corner_verts.slice(faces[face_index])) {
-      mixer.mix_in(vert, value);
+  threading::parallel_for(r_values.index_range(), 2048, [&](const IndexRange range) {
+    attribute_math::DefaultMixer<T> mixer(r_values.slice(range));
+    for (const int vert : range) {
+      for (const int face : vert_to_face_map[vert]) {
+        mixer.mix_in(vert - range.start(), old_values[face]);
+      }
     }
-  }
-
-  mixer.finalize();
+    mixer.finalize();
+  });
 }
 
 /* A vertex is selected if any of the connected faces were selected. */
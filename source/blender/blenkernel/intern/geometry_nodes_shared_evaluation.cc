@@ -0,0 +1,142 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bke
+ */
+
+#include "BLI_string.h"
+
+#include "DNA_mesh_types.h"
+#include "DNA_object_types.h"
+
+#include "BKE_geometry_nodes_shared_evaluation.hh"
+#include "BKE_idprop.h"
+#include "BKE_mesh.hh"
+
+namespace blender::bke {
+
+GeometryNodesSharedEvaluations::Evaluation::~Evaluation()
+{
+  if (this->properties) {
+    IDP_FreeProperty(this->properties);
+  }
+}
+
+static bool custom_data_is_shared(const CustomData &a, const CustomData &b)
+{
+  if (a.totlayer != b.totlayer) {
+    return false;
+  }
+  for (const int i : IndexRange(a.totlayer)) {
+    const CustomDataLayer &layer_a = a.layers[i];
+    const CustomDataLayer &layer_b = b.layers[i];
+    if (layer_a.type != layer_b.type || layer_a.data != layer_b.data ||
+        !STREQ(layer_a.name, layer_b.name))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool strings_equal(const char *a, const char *b)
+{
+  return STREQ(a ? a : "", b ? b : "");
+}
+
+/**
+ * Meshes of different objects that use the same original mesh are different copies, but their
+ * arrays are implicitly shared, so comparing the array pointers is enough.
+ */
+static bool meshes_are_shared(const Mesh &a, const Mesh &b)
+{
+  if (&a == &b) {
+    return true;
+  }
+  if (a.totvert != b.totvert || a.totedge != b.totedge || a.faces_num != b.faces_num ||
+      a.totloop != b.totloop)
+  {
+    return false;
+  }
+  if (a.face_offset_indices != b.face_offset_indices) {
+    return false;
+  }
+  if (a.totcol != b.totcol || !std::equal(a.mat, a.mat + a.totcol, b.mat)) {
+    return false;
+  }
+  if (!strings_equal(a.active_color_attribute, b.active_color_attribute) ||
+      !strings_equal(a.default_color_attribute, b.default_color_attribute))
+  {
+    return false;
+  }
+  const bDeformGroup *group_a = static_cast<const bDeformGroup *>(a.vertex_group_names.first);
+  const bDeformGroup *group_b = static_cast<const bDeformGroup *>(b.vertex_group_names.first);
+  for (; group_a && group_b; group_a = group_a->next, group_b = group_b->next) {
+    if (!STREQ(group_a->name, group_b->name)) {
+      return false;
+    }
+  }
+  if (group_a || group_b) {
+    return false;
+  }
+  return custom_data_is_shared(a.vert_data, b.vert_data) &&
+         custom_data_is_shared(a.edge_data, b.edge_data) &&
+         custom_data_is_shared(a.face_data, b.face_data) &&
+         custom_data_is_shared(a.loop_data, b.loop_data);
+}
+
+static bool can_compare_geometry(const GeometrySet &geometry)
+{
+  for (const GeometryComponent *component : geometry.get_components()) {
+    if (component->type() != GeometryComponent::Type::Mesh) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool geometries_are_shared(const GeometrySet &a, const GeometrySet &b)
+{
+  const Mesh *mesh_a = a.get_mesh();
+  const Mesh *mesh_b = b.get_mesh();
+  if (mesh_a == nullptr || mesh_b == nullptr) {
+    return mesh_a == mesh_b;
+  }
+  return meshes_are_shared(*mesh_a, *mesh_b);
+}
+
+std::shared_ptr<GeometryNodesSharedEvaluations::Evaluation> GeometryNodesSharedEvaluations::
+    lookup_or_add(const bNodeTree &tree,
+                  const IDProperty *properties,
+                  const GeometrySet &input_geometry)
+{
+  if (!can_compare_geometry(input_geometry)) {
+    return nullptr;
+  }
+  std::lock_guard lock{mutex_};
+  Vector<std::shared_ptr<Evaluation>> &evaluations = evaluations_by_tree_.lookup_or_add_default(
+      &tree);
+  for (const std::shared_ptr<Evaluation> &evaluation : evaluations) {
+    if (IDP_EqualsProperties(evaluation->properties, properties) &&
+        geometries_are_shared(evaluation->input_geometry, input_geometry))
+    {
+      return evaluation;
+    }
+  }
+  auto evaluation = std::make_shared<Evaluation>();
+  evaluation->properties = properties ? IDP_CopyProperty(properties) : nullptr;
+  evaluation->input_geometry = input_geometry;
+  evaluations.append(evaluation);
+  return evaluation;
+}
+
+void GeometryNodesSharedEvaluations::clear()
+{
+  Map<const bNodeTree *, Vector<std::shared_ptr<Evaluation>>> evaluations;
+  std::lock_guard lock{mutex_};
+  evaluations = std::move(evaluations_by_tree_);
+}
+
+}  // namespace blender::bke
@@ -305,6 +305,24 @@ bool GeometrySet::owns_direct_data() const
   return true;
 }
 
+int64_t GeometrySet::attributes_memory_estimate() const
+{
+  int64_t memory = 0;
+  for (const GeometryComponent *component : this->get_components()) {
+    const std::optional<AttributeAccessor> attributes = component->attributes();
+    if (!attributes) {
+      continue;
+    }
+    attributes->for_all([&](const AttributeIDRef & /*attribute_id*/,
+                            const AttributeMetaData &meta_data) {
+      const CPPType &type = *custom_data_type_to_cpp_type(meta_data.data_type);
+      memory += int64_t(attributes->domain_size(meta_data.domain)) * type.size();
+      return true;
+    });
+  }
+  return memory;
+}
+
 const Mesh *GeometrySet::get_mesh() const
 {
   const MeshComponent *component = this->get_component<MeshComponent>();
@@ -13,6 +13,7 @@
 #include "BLI_linklist.h"
 #include "BLI_listbase.h"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #include "DNA_image_types.h"
 #include "DNA_userdef_types.h"
@@ -569,11 +570,58 @@ void BKE_image_free_anim_gputextures(Main *bmain)
   }
 }
 
+/**
+ * When the available video memory drops below this fraction of the total, GPU textures of images
+ * that were not used recently are freed, least recently used first. This avoids running out of
+ * memory when switching between many large images well before #UserDef.textimeout is reached.
+ */
+#define GPU_TEXTURE_MIN_FREE_MEMORY_FACTOR 0.1f
+
+static void image_free_gputextures_low_memory(Main *bmain, const int ctime)
+{
+  static int lasttime = 0;
+  if (ctime == lasttime || G.is_rendering || !GPU_mem_stats_supported()) {
+    return;
+  }
+  lasttime = ctime;
+
+  int total_mem_kb = 0, free_mem_kb = 0;
+  GPU_mem_stats_get(&total_mem_kb, &free_mem_kb);
+  const int min_free_mem_kb = int(total_mem_kb * GPU_TEXTURE_MIN_FREE_MEMORY_FACTOR);
+  if (free_mem_kb >= min_free_mem_kb) {
+    return;
+  }
+
+  /* Images used within the last second are likely drawn every frame, freeing them would only
+   * cause them to be uploaded again. */
+  blender::Vector<Image *> images;
+  LISTBASE_FOREACH (Image *, ima, &bmain->images) {
+    if ((ima->flag & IMA_NOCOLLECT) == 0 && ima->lastused < ctime &&
+        BKE_image_has_opengl_texture(ima))
+    {
+      images.append(ima);
+    }
+  }
+  std::sort(images.begin(), images.end(), [](const Image *a, const Image *b) {
+    return a->lastused < b->lastused;
+  });
+
+  for (Image *ima : images) {
+    BKE_image_free_gputextures(ima);
+    GPU_mem_stats_get(&total_mem_kb, &free_mem_kb);
+    if (free_mem_kb >= min_free_mem_kb) {
+      break;
+    }
+  }
+}
+
 void BKE_image_free_old_gputextures(Main *bmain)
 {
   static int lasttime = 0;
   int ctime = int(PIL_check_seconds_timer());
 
+  image_free_gputextures_low_memory(bmain, ctime);
+
   /*
    * Run garbage collector once for every collecting period of time
    * if textimeout is 0, that's the option to NOT run the collector
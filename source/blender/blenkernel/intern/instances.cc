@@ -92,11 +92,27 @@ Instances &Instances::operator=(Instances &&other)
   return *this;
 }
 
+/**
+ * Like #Vector::resize, but without over-allocating when growing. Vectors grow to at least double
+ * their capacity, which wastes a lot of memory when appending many instances to existing ones,
+ * since every transform takes 64 bytes.
+ */
+template<typename T> static void vector_resize_exact(Vector<T> &vector, const int64_t new_size)
+{
+  if (new_size > vector.capacity() && !vector.is_empty()) {
+    Vector<T> new_vector;
+    new_vector.reserve(new_size);
+    new_vector.extend(vector.as_span());
+    vector = std::move(new_vector);
+  }
+  vector.resize(new_size);
+}
+
 void Instances::resize(int capacity)
 {
   const int old_size = this->instances_num();
-  reference_handles_.resize(capacity);
-  transforms_.resize(capacity);
+  vector_resize_exact(reference_handles_, capacity);
+  vector_resize_exact(transforms_, capacity);
   CustomData_realloc(&attributes_, old_size, capacity, CD_SET_DEFAULT);
 }
 
@@ -17,6 +17,7 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -922,6 +923,11 @@ static void key_evaluate_relative(const int start,
         poin += start * poinsize;
         reffrom += key->elemsize * start; /* key elemsize yes! */
         from += key->elemsize * start;
+        if (weights) {
+          /* Weights are only used for meshes and lattices, with one weight per element. */
+          BLI_assert(step == 1);
+          weights += start;
+        }
 
         for (b = start; b < end; b += step) {
 
@@ -1388,8 +1394,28 @@ static void do_mesh_key(Object *ob, Key *key, char *out, const int tot)
     WeightsArrayCache cache = {0, nullptr};
     float **per_keyblock_weights;
     per_keyblock_weights = keyblock_get_per_block_weights(ob, key, &cache);
-    key_evaluate_relative(
-        0, tot, tot, (char *)out, key, actkb, per_keyblock_weights, KEY_MODE_DUMMY);
+    const Mesh *mesh = (const Mesh *)key->from;
+    /* Vertices are evaluated independently, so large meshes are split into ranges that are
+     * evaluated in parallel. In edit mode the active shape is copied from the #BMesh for every
+     * call, and a reference key with a different size is resampled, so those cases use a single
+     * range. */
+    if (mesh && mesh->edit_mesh == nullptr && key->refkey && key->refkey->totelem == tot) {
+      blender::threading::parallel_for(
+          blender::IndexRange(tot), 4096, [&](const blender::IndexRange range) {
+            key_evaluate_relative(range.first(),
+                                  range.one_after_last(),
+                                  tot,
+                                  (char *)out,
+                                  key,
+                                  actkb,
+                                  per_keyblock_weights,
+                                  KEY_MODE_DUMMY);
+          });
+    }
+    else {
+      key_evaluate_relative(
+          0, tot, tot, (char *)out, key, actkb, per_keyblock_weights, KEY_MODE_DUMMY);
+    }
     keyblock_free_per_block_weights(key, per_keyblock_weights, &cache);
   }
   else {
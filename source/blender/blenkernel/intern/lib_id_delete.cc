@@ -230,7 +230,8 @@ static size_t id_delete(Main *bmain,
    * and has already properly unlinked its other IDs usages.
    * UI users are always cleared in BKE_libblock_remap_locked() call, so we can always skip it. */
   const int free_flag = LIB_ID_FREE_NO_UI_USER |
-                        (do_tagged_deletion ? LIB_ID_FREE_NO_MAIN | LIB_ID_FREE_NO_USER_REFCOUNT :
+                        (do_tagged_deletion ? LIB_ID_FREE_NO_MAIN | LIB_ID_FREE_NO_USER_REFCOUNT |
+                                                  LIB_ID_FREE_NO_DEG_TAG :
                                               0);
   const int remapping_flags = (ID_REMAP_FLAG_NEVER_NULL_USAGE | ID_REMAP_FORCE_NEVER_NULL_USAGE |
                                ID_REMAP_FORCE_INTERNAL_RUNTIME_POINTERS | extra_remapping_flags);
@@ -317,8 +318,8 @@ static size_t id_delete(Main *bmain,
     BKE_id_remapper_free(id_remapper);
     BLI_linklist_free(cleanup_ids, nullptr);
 
-    BKE_layer_collection_resync_allow();
-    BKE_main_collection_sync_remap(bmain);
+    /* Keep view layers un-synced until all IDs are freed, so that they are synced only once
+     * at the end. With many objects, syncing all view layers is expensive. */
 
     /* Now we can safely mark that ID as not being in Main database anymore. */
     /* NOTE: This needs to be done in a separate loop than above, otherwise some user-counts of
@@ -332,6 +333,17 @@ static size_t id_delete(Main *bmain,
        * remapping code, depending on order in which these are handled). */
       id->us = ID_FAKE_USERS(id);
     }
+
+    /* Freeing batch-deleted IDs does not tag the depsgraphs, tag each deleted ID type only once
+     * instead. */
+    uint64_t id_types_tagged = 0;
+    LISTBASE_FOREACH (ID *, id, &tagged_deleted_ids) {
+      const uint64_t id_type_filter = BKE_idtype_idcode_to_idfilter(GS(id->name));
+      if ((id_types_tagged & id_type_filter) == 0) {
+        DEG_id_type_tag(bmain, GS(id->name));
+        id_types_tagged |= id_type_filter;
+      }
+    }
   }
   else {
     /* First tag all data-blocks directly from target lib.
@@ -372,8 +384,10 @@ static size_t id_delete(Main *bmain,
 
   /* ViewLayer resync needs to be delayed during Scene freeing, since internal relationships
    * between the Scene's master collection and its view_layers become invalid
-   * (due to remapping). */
-  BKE_layer_collection_resync_forbid();
+   * (due to remapping). Batch deletion already forbids it above. */
+  if (!do_tagged_deletion) {
+    BKE_layer_collection_resync_forbid();
+  }
 
   /* In usual reversed order, such that all usage of a given ID, even 'never nullptr' ones,
    * have been already cleared when we reach it
@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include <algorithm>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -54,6 +55,7 @@
 #include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "PIL_time.h"
 
@@ -4367,6 +4369,10 @@ void BKE_lib_override_library_main_operations_create(Main *bmain,
   create_pool_data.report_flags = RNA_OVERRIDE_MATCH_RESULT_INIT;
   TaskPool *task_pool = BLI_task_pool_create(&create_pool_data, TASK_PRIORITY_HIGH);
 
+  /* IDs to diff, with the number of their override properties as a rough estimate of the cost of
+   * diffing them. */
+  blender::Vector<std::pair<ID *, int>> ids_to_diff;
+
   FOREACH_MAIN_ID_BEGIN (bmain, id) {
     if (!ID_IS_LINKED(id) && ID_IS_OVERRIDE_LIBRARY_REAL(id) &&
         (force_auto || (id->tag & LIB_TAG_LIBOVERRIDE_AUTOREFRESH)))
@@ -4383,8 +4389,7 @@ void BKE_lib_override_library_main_operations_create(Main *bmain,
       /* Only check overrides if we do have the real reference data available, and not some empty
        * 'placeholder' for missing data (broken links). */
       if ((id->override_library->reference->tag & LIB_TAG_MISSING) == 0) {
-        BLI_task_pool_push(
-            task_pool, lib_override_library_operations_create_cb, id, false, nullptr);
+        ids_to_diff.append({id, BLI_listbase_count(&id->override_library->properties)});
       }
       else {
         BKE_lib_override_library_properties_tag(
@@ -4401,6 +4406,18 @@ void BKE_lib_override_library_main_operations_create(Main *bmain,
   }
   FOREACH_MAIN_ID_END;
 
+  /* Push the most expensive IDs first, so that a few heavy IDs (e.g. character rigs) pushed last
+   * don't end up being diffed on their own while all other threads are idle. */
+  std::stable_sort(ids_to_diff.begin(),
+                   ids_to_diff.end(),
+                   [](const std::pair<ID *, int> &a, const std::pair<ID *, int> &b) {
+                     return a.second > b.second;
+                   });
+  for (const std::pair<ID *, int> &item : ids_to_diff) {
+    BLI_task_pool_push(
+        task_pool, lib_override_library_operations_create_cb, item.first, false, nullptr);
+  }
+
   BLI_task_pool_work_and_wait(task_pool);
 
   BLI_task_pool_free(task_pool);
@@ -30,6 +30,8 @@
 #include "IMB_imbuf.h"
 #include "IMB_imbuf_types.h"
 
+#include "NOD_geometry_nodes_result_cache.hh"
+
 Main *BKE_main_new()
 {
   Main *bmain = static_cast<Main *>(MEM_callocN(sizeof(Main), "new main"));
@@ -48,6 +50,10 @@ void BKE_main_free(Main *mainvar)
     BKE_main_free(mainvar->next);
   }
 
+  /* Cached node results reference evaluated data of this main, this covers loading files and
+   * undo, which both free the previous main. */
+  blender::nodes::GeoNodeResultCache::get().clear();
+
   /* Include this check here as the path may be manipulated after creation. */
   BLI_assert_msg(!(mainvar->filepath[0] == '/' && mainvar->filepath[1] == '/'),
                  "'.blend' relative \"//\" must not be used in Main!");
@@ -28,6 +28,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_displist.h"
@@ -43,7 +44,8 @@
 
 #include "BLI_strict_flags.h"
 
-/* experimental (faster) normal calculation (see #103021) */
+/* experimental (faster) normal calculation (see #103021): let the mesh calculate vertex normals
+ * from the faces, instead of sampling the field gradient. */
 #define USE_ACCUM_NORMAL
 
 #define MBALL_ARRAY_LEN_INIT 4096
@@ -441,10 +443,6 @@ static float metaball(PROCESS *process, float x, float y, float z)
  */
 static void make_face(PROCESS *process, int i1, int i2, int i3, int i4)
 {
-#ifdef USE_ACCUM_NORMAL
-  float n[3];
-#endif
-
   if (UNLIKELY(process->totindex == process->curindex)) {
     process->totindex = process->totindex ? (process->totindex * 2) : MBALL_ARRAY_LEN_INIT;
     process->indices = static_cast<int(*)[4]>(
@@ -459,32 +457,8 @@ static void make_face(PROCESS *process, int i1, int i2, int i3, int i4)
   cur[2] = i3;
   cur[3] = i4;
 
-#ifdef USE_ACCUM_NORMAL
-  if (i4 == i3) {
-    normal_tri_v3(n, process->co[i1], process->co[i2], process->co[i3]);
-    accumulate_vertex_normals_v3(process->no[i1],
-                                 process->no[i2],
-                                 process->no[i3],
-                                 nullptr,
-                                 n,
-                                 process->co[i1],
-                                 process->co[i2],
-                                 process->co[i3],
-                                 nullptr);
-  }
-  else {
-    normal_quad_v3(n, process->co[i1], process->co[i2], process->co[i3], process->co[i4]);
-    accumulate_vertex_normals_v3(process->no[i1],
-                                 process->no[i2],
-                                 process->no[i3],
-                                 process->no[i4],
-                                 n,
-                                 process->co[i1],
-                                 process->co[i2],
-                                 process->co[i3],
-                                 process->co[i4]);
-  }
-#endif
+  /* With #USE_ACCUM_NORMAL, the vertex normals are not accumulated here, the mesh computes them
+   * in parallel from the final faces instead, using the same corner angle weighting. */
 }
 
 /* Frees allocated memory */
@@ -945,7 +919,11 @@ static int getedge(EDGELIST *table[], int i1, int j1, int k1, int i2, int j2, in
 static void addtovertices(PROCESS *process, const float v[3], const float no[3])
 {
   process->co.append(v);
+#ifdef USE_ACCUM_NORMAL
+  UNUSED_VARS(no);
+#else
   process->no.append(no);
+#endif
 }
 
 #ifndef USE_ACCUM_NORMAL
@@ -1427,7 +1405,9 @@ Mesh *BKE_mball_polygonize(Depsgraph *depsgraph, Scene *scene, Object *ob)
   process.delta = process.size * 0.001f;
 
   process.co.reserve(MBALL_ARRAY_LEN_INIT);
+#ifndef USE_ACCUM_NORMAL
   process.no.reserve(MBALL_ARRAY_LEN_INIT);
+#endif
   process.pgn_elements = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, "Metaball memarena");
 
   /* initialize all mainb (MetaElems) */
@@ -1458,40 +1438,45 @@ Mesh *BKE_mball_polygonize(Depsgraph *depsgraph, Scene *scene, Object *ob)
 
   freepolygonize(&process);
 
-  int corners_num = 0;
-  for (uint i = 0; i < process.curindex; i++) {
-    const int *indices = process.indices[i];
-    const int count = indices[2] != indices[3] ? 4 : 3;
-    corners_num += count;
-  }
+  const int faces_num = int(process.curindex);
+  blender::Array<int> face_offsets_data(faces_num + 1);
+  blender::threading::parallel_for(
+      blender::IndexRange(faces_num), 4096, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          const int *indices = process.indices[i];
+          face_offsets_data[i] = indices[2] != indices[3] ? 4 : 3;
+        }
+      });
+  const blender::OffsetIndices<int> face_offsets =
+      blender::offset_indices::accumulate_counts_to_offsets(face_offsets_data);
 
-  Mesh *mesh = BKE_mesh_new_nomain(int(process.co.size()), 0, int(process.curindex), corners_num);
+  Mesh *mesh = BKE_mesh_new_nomain(
+      int(process.co.size()), 0, faces_num, face_offsets.total_size());
   mesh->vert_positions_for_write().copy_from(process.co);
-  blender::MutableSpan<int> face_offsets = mesh->face_offsets_for_write();
+  mesh->face_offsets_for_write().copy_from(face_offsets_data);
   blender::MutableSpan<int> corner_verts = mesh->corner_verts_for_write();
 
-  int loop_offset = 0;
-  for (int i = 0; i < mesh->faces_num; i++) {
-    const int *indices = process.indices[i];
-
-    const int count = indices[2] != indices[3] ? 4 : 3;
-    face_offsets[i] = loop_offset;
-
-    corner_verts[loop_offset] = indices[0];
-    corner_verts[loop_offset + 1] = indices[1];
-    corner_verts[loop_offset + 2] = indices[2];
-    if (count == 4) {
-      corner_verts[loop_offset + 3] = indices[3];
-    }
-
-    loop_offset += count;
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(faces_num), 4096, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          const int *indices = process.indices[i];
+          const blender::IndexRange face = face_offsets[i];
+          for (const int64_t j : blender::IndexRange(face.size())) {
+            corner_verts[face[j]] = indices[j];
+          }
+        }
+      });
   MEM_freeN(process.indices);
 
-  for (int i = 0; i < mesh->totvert; i++) {
-    normalize_v3(process.no[i]);
-  }
+#ifndef USE_ACCUM_NORMAL
+  blender::threading::parallel_for(
+      process.no.index_range(), 4096, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          normalize_v3(process.no[i]);
+        }
+      });
   blender::bke::mesh_vert_normals_assign(*mesh, std::move(process.no));
+#endif
 
   BKE_mesh_calc_edges(mesh, false, false);
 
@@ -91,18 +91,24 @@ static void add_face_edges_to_hash_maps(Mesh *mesh,
   });
 }
 
-static void serialize_and_initialize_deduplicated_edges(MutableSpan<EdgeMap> edge_maps,
-                                                        MutableSpan<int2> new_edges)
+/**
+ * All edges are distributed in the hash tables. To be able to serialize them into a single array
+ * in parallel, compute the first edge index of each map.
+ */
+static Array<int> calc_edge_index_offsets(const Span<EdgeMap> edge_maps)
 {
-  /* All edges are distributed in the hash tables now. They have to be serialized into a single
-   * array below. To be able to parallelize this, we have to compute edge index offsets for each
-   * map. */
   Array<int> edge_index_offsets(edge_maps.size());
   edge_index_offsets[0] = 0;
   for (const int i : IndexRange(edge_maps.size() - 1)) {
     edge_index_offsets[i + 1] = edge_index_offsets[i] + edge_maps[i].size();
   }
+  return edge_index_offsets;
+}
 
+static void serialize_and_initialize_deduplicated_edges(MutableSpan<EdgeMap> edge_maps,
+                                                        const Span<int> edge_index_offsets,
+                                                        MutableSpan<int2> new_edges)
+{
   threading::parallel_for_each(edge_maps, [&](EdgeMap &edge_map) {
     const int task_index = &edge_map - edge_maps.data();
 
@@ -159,6 +165,23 @@ static void update_edge_indices_in_face_loops(const OffsetIndices<int> faces,
   });
 }
 
+static void select_new_edges_in_hash_maps(const Span<EdgeMap> edge_maps,
+                                          const Span<int> edge_index_offsets,
+                                          MutableSpan<bool> select_edge)
+{
+  threading::parallel_for_each(edge_maps, [&](const EdgeMap &edge_map) {
+    const int task_index = &edge_map - edge_maps.data();
+
+    int new_edge_index = edge_index_offsets[task_index];
+    for (EdgeMap::Item item : edge_map.items()) {
+      if (item.value.original_edge == nullptr) {
+        select_edge[new_edge_index] = true;
+      }
+      new_edge_index++;
+    }
+  });
+}
+
 static int get_parallel_maps_count(const Mesh *mesh)
 {
   /* Don't use parallelization when the mesh is small. */
@@ -207,9 +230,12 @@ void BKE_mesh_calc_edges(Mesh *mesh, bool keep_existing_edges, const bool select
   /* Create new edges. */
   MutableAttributeAccessor attributes = mesh->attributes_for_write();
   attributes.add<int>(".corner_edge", ATTR_DOMAIN_CORNER, AttributeInitConstruct());
+  /* Every edge is written below, so the array doesn't have to be zeroed. */
   MutableSpan<int2> new_edges{
-      static_cast<int2 *>(MEM_calloc_arrayN(new_totedge, sizeof(int2), __func__)), new_totedge};
-  calc_edges::serialize_and_initialize_deduplicated_edges(edge_maps, new_edges);
+      static_cast<int2 *>(MEM_malloc_arrayN(new_totedge, sizeof(int2), __func__)), new_totedge};
+  const Array<int> edge_index_offsets = calc_edge_index_offsets(edge_maps);
+  calc_edges::serialize_and_initialize_deduplicated_edges(
+      edge_maps, edge_index_offsets, new_edges);
   calc_edges::update_edge_indices_in_face_loops(mesh->faces(),
                                                 mesh->corner_verts(),
                                                 edge_maps,
@@ -227,15 +253,7 @@ void BKE_mesh_calc_edges(Mesh *mesh, bool keep_existing_edges, const bool select
     SpanAttributeWriter<bool> select_edge = attributes.lookup_or_add_for_write_span<bool>(
         ".select_edge", ATTR_DOMAIN_EDGE);
     if (select_edge) {
-      int new_edge_index = 0;
-      for (const EdgeMap &edge_map : edge_maps) {
-        for (EdgeMap::Item item : edge_map.items()) {
-          if (item.value.original_edge == nullptr) {
-            select_edge.span[new_edge_index] = true;
-          }
-          new_edge_index++;
-        }
-      }
+      calc_edges::select_new_edges_in_hash_maps(edge_maps, edge_index_offsets, select_edge.span);
       select_edge.finish();
     }
   }
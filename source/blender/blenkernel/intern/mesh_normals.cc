@@ -162,6 +162,30 @@ void normals_calc_faces(const Span<float3> positions,
   });
 }
 
+static float3 normal_calc_vert(const Span<float3> positions,
+                               const OffsetIndices<int> faces,
+                               const Span<int> corner_verts,
+                               const Span<int> vert_faces,
+                               const Span<float3> face_normals,
+                               const int vert)
+{
+  if (vert_faces.is_empty()) {
+    return math::normalize(positions[vert]);
+  }
+
+  float3 vert_normal(0);
+  for (const int face : vert_faces) {
+    const int2 adjacent_verts = face_find_adjecent_verts(faces[face], corner_verts, vert);
+    const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
+    const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
+    const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
+
+    vert_normal += face_normals[face] * factor;
+  }
+
+  return math::normalize(vert_normal);
+}
+
 void normals_calc_verts(const Span<float3> vert_positions,
                         const OffsetIndices<int> faces,
                         const Span<int> corner_verts,
@@ -172,23 +196,8 @@ void normals_calc_verts(const Span<float3> vert_positions,
   const Span<float3> positions = vert_positions;
   threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
     for (const int vert : range) {
-      const Span<int> vert_faces = vert_to_face_map[vert];
-      if (vert_faces.is_empty()) {
-        vert_normals[vert] = math::normalize(positions[vert]);
-        continue;
-      }
-
-      float3 vert_normal(0);
-      for (const int face : vert_faces) {
-        const int2 adjacent_verts = face_find_adjecent_verts(faces[face], corner_verts, vert);
-        const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
-        const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
-        const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
-
-        vert_normal += face_normals[face] * factor;
-      }
-
-      vert_normals[vert] = math::normalize(vert_normal);
+      vert_normals[vert] = normal_calc_vert(
+          positions, faces, corner_verts, vert_to_face_map[vert], face_normals, vert);
     }
   });
 }
@@ -197,6 +206,63 @@ void normals_calc_verts(const Span<float3> vert_positions,
 
 }  // namespace blender::bke::mesh
 
+namespace blender::bke {
+
+void mesh_tag_positions_changed_partial(Mesh &mesh, const IndexMask &changed_verts)
+{
+  MeshRuntime &runtime = *mesh.runtime;
+  /* Updating only part of the normals is slower than recomputing them when most vertices
+   * changed. Vertex normals also depend on the face normals, so those have to be available. */
+  if (changed_verts.size() > mesh.totvert / 4 || runtime.face_normals_cache.is_dirty()) {
+    BKE_mesh_tag_positions_changed(&mesh);
+    return;
+  }
+
+  const Span<float3> positions = mesh.vert_positions();
+  const OffsetIndices faces = mesh.faces();
+  const Span<int> corner_verts = mesh.corner_verts();
+  const GroupedSpan<int> vert_to_face = mesh.vert_to_face_map();
+
+  Array<bool> face_changed(faces.size(), false);
+  changed_verts.foreach_index(GrainSize(4096), [&](const int vert) {
+    for (const int face : vert_to_face[vert]) {
+      face_changed[face] = true;
+    }
+  });
+  IndexMaskMemory memory;
+  const IndexMask changed_faces = IndexMask::from_bools(face_changed, memory);
+
+  runtime.face_normals_cache.update([&](Vector<float3> &r_data) {
+    changed_faces.foreach_index(GrainSize(1024), [&](const int face) {
+      r_data[face] = mesh::normal_calc_ngon(positions, corner_verts.slice(faces[face]));
+    });
+  });
+
+  if (!runtime.vert_normals_cache.is_dirty()) {
+    /* The normals of all vertices of the changed faces depend on the changed positions. */
+    Array<bool> vert_changed(mesh.totvert, false);
+    changed_verts.to_bools(vert_changed);
+    changed_faces.foreach_index(GrainSize(4096), [&](const int face) {
+      for (const int vert : corner_verts.slice(faces[face])) {
+        vert_changed[vert] = true;
+      }
+    });
+    const IndexMask verts_to_update = IndexMask::from_bools(vert_changed, memory);
+    const Span<float3> face_normals = runtime.face_normals_cache.data();
+    runtime.vert_normals_cache.update([&](Vector<float3> &r_data) {
+      verts_to_update.foreach_index(GrainSize(1024), [&](const int vert) {
+        r_data[vert] = mesh::normal_calc_vert(
+            positions, faces, corner_verts, vert_to_face[vert], face_normals, vert);
+      });
+    });
+  }
+
+  runtime.corner_normals_cache.tag_dirty();
+  BKE_mesh_tag_positions_changed_no_normals(&mesh);
+}
+
+}  // namespace blender::bke
+
 /* -------------------------------------------------------------------- */
 /** \name Mesh Normal Calculation
  * \{ */
@@ -64,6 +64,13 @@ static void free_bvh_cache(MeshRuntime &mesh_runtime)
   }
 }
 
+static void tag_bvh_cache_positions_changed(MeshRuntime &mesh_runtime)
+{
+  if (mesh_runtime.bvh_cache) {
+    bvhcache_tag_positions_changed(mesh_runtime.bvh_cache);
+  }
+}
+
 static void free_batch_cache(MeshRuntime &mesh_runtime)
 {
   if (mesh_runtime.batch_cache) {
@@ -390,7 +397,7 @@ void BKE_mesh_tag_positions_changed(Mesh *mesh)
 
 void BKE_mesh_tag_positions_changed_no_normals(Mesh *mesh)
 {
-  free_bvh_cache(*mesh->runtime);
+  tag_bvh_cache_positions_changed(*mesh->runtime);
   mesh->runtime->looptris_cache.tag_dirty();
   mesh->runtime->bounds_cache.tag_dirty();
 }
@@ -398,7 +405,7 @@ void BKE_mesh_tag_positions_changed_no_normals(Mesh *mesh)
 void BKE_mesh_tag_positions_changed_uniformly(Mesh *mesh)
 {
   /* The normals and triangulation didn't change, since all verts moved by the same amount. */
-  free_bvh_cache(*mesh->runtime);
+  tag_bvh_cache_positions_changed(*mesh->runtime);
   mesh->runtime->bounds_cache.tag_dirty();
 }
 
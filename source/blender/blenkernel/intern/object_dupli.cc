@@ -104,6 +104,12 @@ struct DupliContext {
   Object *root_object;
   /** Immediate parent object in the context. */
   Object *object;
+  /**
+   * Hashes of the names of #root_object and #object, used for the random id of every instance.
+   * Computing them once avoids hashing strings for each of possibly millions of instances.
+   */
+  uint root_object_name_hash;
+  uint object_name_hash;
   float space_mat[4][4];
   /**
    * Index of the top-level instance that contains this context or -1 when unused.
@@ -166,6 +172,8 @@ static void init_context(DupliContext *r_ctx,
 
   r_ctx->root_object = ob;
   r_ctx->object = ob;
+  r_ctx->root_object_name_hash = BLI_hash_string(ob->id.name + 2);
+  r_ctx->object_name_hash = r_ctx->root_object_name_hash;
   r_ctx->obedit = OBEDIT_FROM_OBACT(ob);
   r_ctx->instance_stack = &instance_stack;
   r_ctx->dupli_gen_type_stack = &dupli_gen_type_stack;
@@ -207,6 +215,9 @@ static bool copy_dupli_context(DupliContext *r_ctx,
   }
 
   r_ctx->object = ob;
+  if (ob != ctx->object) {
+    r_ctx->object_name_hash = BLI_hash_string(ob->id.name + 2);
+  }
   r_ctx->instance_stack = ctx->instance_stack;
   if (mat) {
     mul_m4_m4m4(r_ctx->space_mat, (float(*)[4])ctx->space_mat, mat);
@@ -301,7 +312,8 @@ static DupliObject *make_dupli(const DupliContext *ctx,
   /* Random number per instance.
    * The root object in the scene, persistent ID up to the instance object, and the instance object
    * name together result in a unique random number. */
-  dob->random_id = BLI_hash_string(dob->ob->id.name + 2);
+  dob->random_id = (ob == ctx->object) ? ctx->object_name_hash :
+                                         BLI_hash_string(dob->ob->id.name + 2);
 
   if (dob->persistent_id[0] != INT_MAX) {
     for (i = 0; i < MAX_DUPLI_RECUR; i++) {
@@ -313,7 +325,7 @@ static DupliObject *make_dupli(const DupliContext *ctx,
   }
 
   if (ctx->root_object != ob) {
-    dob->random_id ^= BLI_hash_int(BLI_hash_string(ctx->root_object->id.name + 2));
+    dob->random_id ^= BLI_hash_int(ctx->root_object_name_hash);
   }
 
   return dob;
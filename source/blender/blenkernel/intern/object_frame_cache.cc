@@ -0,0 +1,141 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bke
+ */
+
+#include "BLI_hash.hh"
+
+#include "DNA_mesh_types.h"
+#include "DNA_object_types.h"
+
+#include "BKE_customdata.hh"
+#include "BKE_geometry_set.hh"
+#include "BKE_lib_id.h"
+#include "BKE_mesh.h"
+#include "BKE_object_frame_cache.hh"
+
+namespace blender::bke {
+
+uint64_t ObjectFrameCache::Key::hash() const
+{
+  return get_default_hash_2(object_session_uuid, ctime);
+}
+
+ObjectFrameCache::Entry::~Entry()
+{
+  BKE_id_free(nullptr, mesh_eval);
+  if (mesh_deform_eval) {
+    BKE_id_free(nullptr, mesh_deform_eval);
+  }
+}
+
+ObjectFrameCache::~ObjectFrameCache()
+{
+  this->clear();
+}
+
+static size_t customdata_memory_estimate(const CustomData &data, const int elements_num)
+{
+  size_t memory = 0;
+  for (const CustomDataLayer &layer : Span(data.layers, data.totlayer)) {
+    memory += size_t(CustomData_sizeof(eCustomDataType(layer.type))) * size_t(elements_num);
+  }
+  return memory;
+}
+
+/**
+ * The cached arrays are typically shared with the ones used by the current evaluated state, count
+ * them anyway since they stay alive because of the cache once the next frame is evaluated.
+ */
+static size_t mesh_memory_estimate(const Mesh &mesh)
+{
+  return customdata_memory_estimate(mesh.vert_data, mesh.totvert) +
+         customdata_memory_estimate(mesh.edge_data, mesh.totedge) +
+         customdata_memory_estimate(mesh.face_data, mesh.faces_num) +
+         customdata_memory_estimate(mesh.loop_data, mesh.totloop) +
+         size_t(mesh.faces_num + 1) * sizeof(int);
+}
+
+bool ObjectFrameCache::lookup(const Object &object,
+                              const float ctime,
+                              const CustomData_MeshMasks &data_mask,
+                              const bool need_mapping,
+                              Mesh **r_mesh_eval,
+                              Mesh **r_mesh_deform_eval,
+                              GeometrySet **r_geometry_set)
+{
+  std::lock_guard lock{mutex_};
+  const std::unique_ptr<Entry> *entry_ptr = entries_.lookup_ptr({object.id.session_uuid, ctime});
+  if (entry_ptr == nullptr) {
+    return false;
+  }
+  const Entry &entry = **entry_ptr;
+  if (!CustomData_MeshMasks_are_matching(&entry.data_mask, &data_mask)) {
+    return false;
+  }
+  if (need_mapping && !entry.need_mapping) {
+    return false;
+  }
+  *r_mesh_eval = BKE_mesh_copy_for_eval(entry.mesh_eval);
+  *r_mesh_deform_eval = entry.mesh_deform_eval ? BKE_mesh_copy_for_eval(entry.mesh_deform_eval) :
+                                                 nullptr;
+  *r_geometry_set = new GeometrySet(*entry.geometry_set);
+  return true;
+}
+
+void ObjectFrameCache::add(const Object &object,
+                           const float ctime,
+                           const CustomData_MeshMasks &data_mask,
+                           const bool need_mapping,
+                           const Mesh &mesh_eval,
+                           const Mesh *mesh_deform_eval,
+                           const GeometrySet &geometry_set)
+{
+  const size_t memory = mesh_memory_estimate(mesh_eval) +
+                        (mesh_deform_eval ? mesh_memory_estimate(*mesh_deform_eval) : 0);
+  if (memory > memory_limit) {
+    return;
+  }
+
+  std::unique_ptr<Entry> entry = std::make_unique<Entry>();
+  entry->data_mask = data_mask;
+  entry->need_mapping = need_mapping;
+  entry->mesh_eval = BKE_mesh_copy_for_eval(&mesh_eval);
+  entry->mesh_deform_eval = mesh_deform_eval ? BKE_mesh_copy_for_eval(mesh_deform_eval) : nullptr;
+  entry->geometry_set = std::make_unique<GeometrySet>(geometry_set);
+  entry->memory = memory;
+
+  const Key key{object.id.session_uuid, ctime};
+
+  std::lock_guard lock{mutex_};
+  if (std::unique_ptr<Entry> *old_entry = entries_.lookup_ptr(key)) {
+    /* Replace an entry with less data, the key order doesn't change. */
+    memory_ -= (*old_entry)->memory;
+    *old_entry = std::move(entry);
+  }
+  else {
+    entries_.add_new(key, std::move(entry));
+    order_.push_back(key);
+  }
+  memory_ += memory;
+
+  /* Free the oldest frames until the cache fits into the limit again. */
+  while (memory_ > memory_limit) {
+    const Key oldest_key = order_.front();
+    order_.pop_front();
+    memory_ -= entries_.pop(oldest_key)->memory;
+  }
+}
+
+void ObjectFrameCache::clear()
+{
+  std::lock_guard lock{mutex_};
+  entries_.clear();
+  order_.clear();
+  memory_ = 0;
+}
+
+}  // namespace blender::bke
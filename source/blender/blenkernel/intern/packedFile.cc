@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include <algorithm>
 #include <cstdio>
 #include <fcntl.h>
 #include <sys/stat.h>
@@ -26,7 +27,11 @@
 #include "DNA_volume_types.h"
 
 #include "BLI_blenlib.h"
+#include "BLI_hash_mm2a.h"
+#include "BLI_implicit_sharing.hh"
+#include "BLI_map.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_image.h"
 #include "BKE_image_format.h"
@@ -144,12 +149,99 @@ int BKE_packedfile_count_all(Main *bmain)
   return count;
 }
 
+void BKE_packedfile_share_identical_data(Main *bmain)
+{
+  using namespace blender;
+
+  struct PackedFileItem {
+    PackedFile *pf;
+    bool is_new;
+  };
+  /* Group by size first, so that only the data of candidates for sharing has to be hashed. */
+  Map<int, Vector<PackedFileItem>> items_by_size;
+  auto add_packed_file = [&](ID *id, PackedFile *pf) {
+    if (pf != nullptr) {
+      items_by_size.lookup_or_add_default(pf->size).append({pf, (id->tag & LIB_TAG_NEW) != 0});
+    }
+  };
+
+  LISTBASE_FOREACH (Image *, ima, &bmain->images) {
+    LISTBASE_FOREACH (ImagePackedFile *, imapf, &ima->packedfiles) {
+      add_packed_file(&ima->id, imapf->packedfile);
+    }
+  }
+  LISTBASE_FOREACH (VFont *, vfont, &bmain->fonts) {
+    add_packed_file(&vfont->id, vfont->packedfile);
+  }
+  LISTBASE_FOREACH (bSound *, sound, &bmain->sounds) {
+    add_packed_file(&sound->id, sound->packedfile);
+  }
+  LISTBASE_FOREACH (Volume *, volume, &bmain->volumes) {
+    add_packed_file(&volume->id, volume->packedfile);
+  }
+  LISTBASE_FOREACH (Library *, lib, &bmain->libraries) {
+    add_packed_file(&lib->id, lib->packedfile);
+  }
+
+  for (MutableSpan<PackedFileItem> items : items_by_size.values()) {
+    if (items.size() < 2) {
+      continue;
+    }
+    /* Existing packed files are the ones to share from, since run-time data (sound handles,
+     * fonts, ...) may already reference their data. Only data of new packed files is replaced. */
+    std::stable_partition(
+        items.begin(), items.end(), [](const PackedFileItem &item) { return !item.is_new; });
+    if (!items.last().is_new) {
+      continue;
+    }
+
+    Map<uint32_t, Vector<PackedFile *>> sources_by_hash;
+    for (const PackedFileItem &item : items) {
+      PackedFile *pf = item.pf;
+      const uint32_t hash = BLI_hash_mm2(
+          static_cast<const uchar *>(pf->data), size_t(pf->size), 0);
+      Vector<PackedFile *> &sources = sources_by_hash.lookup_or_add_default(hash);
+
+      PackedFile *source = nullptr;
+      for (PackedFile *pf_test : sources) {
+        if (pf_test->data == pf->data || memcmp(pf_test->data, pf->data, size_t(pf->size)) == 0)
+        {
+          source = pf_test;
+          break;
+        }
+      }
+      if (source == nullptr) {
+        sources.append(pf);
+        continue;
+      }
+      if (source->data == pf->data || !item.is_new) {
+        continue;
+      }
+
+      BKE_packedfile_ensure_sharing_info(source);
+      if (pf->sharing_info) {
+        implicit_sharing::free_shared_data(&pf->data, &pf->sharing_info);
+      }
+      else {
+        MEM_freeN(pf->data);
+      }
+      implicit_sharing::copy_shared_pointer(
+          source->data, source->sharing_info, &pf->data, &pf->sharing_info);
+    }
+  }
+}
+
 void BKE_packedfile_free(PackedFile *pf)
 {
   if (pf) {
     BLI_assert(pf->data != nullptr);
 
-    MEM_SAFE_FREE(pf->data);
+    if (pf->sharing_info) {
+      blender::implicit_sharing::free_shared_data(&pf->data, &pf->sharing_info);
+    }
+    else {
+      MEM_SAFE_FREE(pf->data);
+    }
     MEM_freeN(pf);
   }
   else {
@@ -164,12 +256,23 @@ PackedFile *BKE_packedfile_duplicate(const PackedFile *pf_src)
 
   PackedFile *pf_dst;
 
+  /* Share the data instead of copying it, packed data is never modified in place.
+   * Creating the sharing info does not change the packed file's content, hence the cast. */
+  BKE_packedfile_ensure_sharing_info(const_cast<PackedFile *>(pf_src));
+
   pf_dst = static_cast<PackedFile *>(MEM_dupallocN(pf_src));
-  pf_dst->data = MEM_dupallocN(pf_src->data);
+  pf_dst->sharing_info->add_user();
 
   return pf_dst;
 }
 
+void BKE_packedfile_ensure_sharing_info(PackedFile *pf)
+{
+  if (pf->sharing_info == nullptr) {
+    pf->sharing_info = blender::implicit_sharing::info_for_mem_free(pf->data);
+  }
+}
+
 PackedFile *BKE_packedfile_new_from_memory(void *mem, int memlen)
 {
   BLI_assert(mem != nullptr);
@@ -884,7 +987,10 @@ void BKE_packedfile_blend_write(BlendWriter *writer, PackedFile *pf)
   if (pf == nullptr) {
     return;
   }
-  BLO_write_struct(writer, PackedFile, pf);
+  /* The sharing info is run-time data, it must not be written. */
+  PackedFile pf_copy = *pf;
+  pf_copy.sharing_info = nullptr;
+  BLO_write_struct_at_address(writer, PackedFile, pf, &pf_copy);
   BLO_write_raw(writer, pf->size, pf->data);
 }
 
@@ -896,6 +1002,12 @@ void BKE_packedfile_blend_read(BlendDataReader *reader, PackedFile **pf_p)
     return;
   }
 
+  if (pf->sharing_info != nullptr) {
+    /* Packed file restored from the previous main on undo (see #blo_make_packed_pointer_map),
+     * its shared data is still valid and owned through its sharing info. */
+    return;
+  }
+
   BLO_read_packed_address(reader, &pf->data);
   if (pf->data == nullptr) {
     /* We cannot allow a PackedFile with a nullptr data field,
@@ -2650,21 +2650,36 @@ void psys_find_parents(ParticleSimulationData *sim, const bool use_render_params
 
   BLI_kdtree_3d_balance(tree);
 
-  for (; p < totchild; p++, cpa++) {
+  /* Gather the coordinates of the remaining children first, so that their parents can be found
+   * with a single batched query. */
+  const int children_num = totchild - p;
+  float(*child_orcos)[3] = static_cast<float(*)[3]>(
+      MEM_malloc_arrayN(children_num, sizeof(float[3]), __func__));
+  int *child_parents = static_cast<int *>(
+      MEM_malloc_arrayN(children_num, sizeof(int), __func__));
+
+  for (int i = 0; i < children_num; i++) {
     psys_particle_on_emitter(sim->psmd,
                              from,
-                             cpa->num,
+                             cpa[i].num,
                              DMCACHE_ISCHILD,
-                             cpa->fuv,
-                             cpa->foffset,
+                             cpa[i].fuv,
+                             cpa[i].foffset,
                              co,
                              nullptr,
                              nullptr,
                              nullptr,
-                             orco);
-    cpa->parent = BLI_kdtree_3d_find_nearest(tree, orco, nullptr);
+                             child_orcos[i]);
+  }
+
+  BLI_kdtree_3d_find_nearest_batch(tree, child_orcos, children_num, child_parents, nullptr);
+
+  for (int i = 0; i < children_num; i++) {
+    cpa[i].parent = child_parents[i];
   }
 
+  MEM_freeN(child_orcos);
+  MEM_freeN(child_parents);
   BLI_kdtree_3d_free(tree);
 }
 
@@ -2767,6 +2782,7 @@ static bool psys_thread_context_init_path(ParticleThreadContext *ctx,
   if ((part->child_flag & PART_CHILD_USE_TWIST_CURVE) && part->twistcurve) {
     ctx->twistcurve = BKE_curvemapping_copy(part->twistcurve);
     BKE_curvemapping_changed_all(ctx->twistcurve);
+    psys_twist_integral_init(ctx);
   }
   else {
     ctx->twistcurve = nullptr;
@@ -6,6 +6,10 @@
  * \ingroup bke
  */
 
+#include <algorithm>
+
+#include "MEM_guardedalloc.h"
+
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
@@ -743,6 +747,51 @@ static float BKE_curvemapping_integrate_clamped(const CurveMapping *curve,
   return integral;
 }
 
+void psys_twist_integral_init(ParticleThreadContext *ctx)
+{
+  const int num_segments = ctx->segments;
+  if (ctx->twistcurve == nullptr || num_segments <= 0) {
+    return;
+  }
+  /* Use the exact same steps as #BKE_curvemapping_integrate_clamped over the range [0, 1], so
+   * that looking up the integral gives the same result as integrating the curve. Accumulating
+   * the step can give one more sample than the number of segments. */
+  const float step = 1.0f / num_segments;
+  ctx->twist_integral_x = static_cast<float *>(
+      MEM_malloc_arrayN(num_segments + 2, sizeof(float), __func__));
+  ctx->twist_integral = static_cast<float *>(
+      MEM_malloc_arrayN(num_segments + 2, sizeof(float), __func__));
+  float integral = 0.0f;
+  float x = 0.0f;
+  int len = 0;
+  while (x < 1.0f && len < num_segments + 2) {
+    float y = BKE_curvemapping_evaluateF(ctx->twistcurve, 0, x);
+    y = clamp_f(y, 0.0f, 1.0f);
+    integral += y * step;
+    ctx->twist_integral_x[len] = x;
+    ctx->twist_integral[len] = integral;
+    len++;
+    x += step;
+  }
+  ctx->twist_integral_len = (x < 1.0f) ? 0 : len;
+}
+
+/** Look up the twist curve integral from 0 to \a time, or return false if it is not cached. */
+static bool twist_integral_lookup(const ParticleThreadContext *thread_ctx,
+                                  const float time,
+                                  float *r_integral)
+{
+  if (thread_ctx == nullptr || thread_ctx->twist_integral_len == 0 || time > 1.0f) {
+    return false;
+  }
+  /* Number of samples before the given time. */
+  const float *x_begin = thread_ctx->twist_integral_x;
+  const float *x_end = x_begin + thread_ctx->twist_integral_len;
+  const int samples_num = int(std::lower_bound(x_begin, x_end, time) - x_begin);
+  *r_integral = (samples_num == 0) ? 0.0f : thread_ctx->twist_integral[samples_num - 1];
+  return true;
+}
+
 static void do_twist(const ParticleChildModifierContext *modifier_ctx,
                      ParticleKey *state,
                      const float time)
@@ -780,8 +829,12 @@ static void do_twist(const ParticleChildModifierContext *modifier_ctx,
     angle *= (ptex->twist - 0.5f) * 2.0f;
   }
   if (twist_curve != nullptr) {
-    const int num_segments = twist_num_segments(modifier_ctx);
-    angle *= BKE_curvemapping_integrate_clamped(twist_curve, 0.0f, time, 1.0f / num_segments);
+    float integral;
+    if (!twist_integral_lookup(thread_ctx, time, &integral)) {
+      const int num_segments = twist_num_segments(modifier_ctx);
+      integral = BKE_curvemapping_integrate_clamped(twist_curve, 0.0f, time, 1.0f / num_segments);
+    }
+    angle *= integral;
   }
   else {
     angle *= time;
@@ -557,6 +557,8 @@ void psys_thread_context_free(ParticleThreadContext *ctx)
   if (ctx->twistcurve != nullptr) {
     BKE_curvemapping_free(ctx->twistcurve);
   }
+  MEM_SAFE_FREE(ctx->twist_integral_x);
+  MEM_SAFE_FREE(ctx->twist_integral);
 }
 
 static void init_particle_texture(ParticleSimulationData *sim, ParticleData *pa, int p)
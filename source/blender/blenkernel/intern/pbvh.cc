@@ -365,12 +365,40 @@ static void build_mesh_leaf_node(PBVH *pbvh, PBVHNode *node)
   BKE_pbvh_node_mark_rebuild_draw(node);
 }
 
+/**
+ * Accumulate a bounding box over the primitives of a node. The upper levels of the tree cover
+ * most primitives, so they are processed in parallel.
+ */
+template<typename ExpandFn>
+static BB calc_prims_bb(const PBVH *pbvh,
+                        const int offset,
+                        const int count,
+                        const ExpandFn &expand)
+{
+  BB init;
+  BB_reset(&init);
+  return blender::threading::parallel_reduce(
+      blender::IndexRange(offset, count),
+      8192,
+      init,
+      [&](const blender::IndexRange range, BB bb) {
+        for (const int i : range) {
+          expand(bb, pbvh->prim_indices[i]);
+        }
+        return bb;
+      },
+      [](const BB &a, const BB &b) {
+        BB bb = a;
+        BB_expand_with_bb(&bb, &b);
+        return bb;
+      });
+}
+
 static void update_vb(PBVH *pbvh, PBVHNode *node, const Span<BBC> prim_bbc, int offset, int count)
 {
-  BB_reset(&node->vb);
-  for (int i = offset + count - 1; i >= offset; i--) {
-    BB_expand_with_bb(&node->vb, (BB *)(&prim_bbc[pbvh->prim_indices[i]]));
-  }
+  node->vb = calc_prims_bb(pbvh, offset, count, [&](BB &bb, const int prim) {
+    BB_expand_with_bb(&bb, (const BB *)(&prim_bbc[prim]));
+  });
   node->orig_vb = node->vb;
 }
 
@@ -573,11 +601,10 @@ static void build_sub(PBVH *pbvh,
   if (!below_leaf_limit) {
     /* Find axis with widest range of primitive centroids */
     if (!cb) {
+      cb_backing = calc_prims_bb(pbvh, offset, count, [&](BB &bb, const int prim) {
+        BB_expand(&bb, prim_bbc[prim].bcentroid);
+      });
       cb = &cb_backing;
-      BB_reset(cb);
-      for (int i = offset + count - 1; i >= offset; i--) {
-        BB_expand(cb, prim_bbc[pbvh->prim_indices[i]].bcentroid);
-      }
     }
     const int axis = BB_widest_axis(cb);
 
@@ -14,6 +14,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_DerivedMesh.hh"
@@ -935,54 +936,83 @@ static void short_edge_queue_edge_add(EdgeQueueContext *eq_ctx, BMEdge *e)
   }
 }
 
-static void long_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+static bool edge_queue_face_in_range(const EdgeQueue *q, BMFace *f)
 {
 #ifdef USE_EDGEQUEUE_FRONTFACE
-  if (eq_ctx->q->use_view_normal) {
-    if (dot_v3v3(f->no, eq_ctx->q->view_normal) < 0.0f) {
-      return;
+  if (q->use_view_normal) {
+    if (dot_v3v3(f->no, q->view_normal) < 0.0f) {
+      return false;
     }
   }
 #endif
 
-  if (eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f)) {
-    /* Check each edge of the face. */
-    BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
-    BMLoop *l_iter = l_first;
-    do {
+  return q->edge_queue_tri_in_range(q, f);
+}
+
+static void long_edge_queue_face_edges_add(EdgeQueueContext *eq_ctx, BMFace *f)
+{
+  /* Check each edge of the face. */
+  BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
+  BMLoop *l_iter = l_first;
+  do {
 #ifdef USE_EDGEQUEUE_EVEN_SUBDIV
-      const float len_sq = BM_edge_calc_length_squared(l_iter->e);
-      if (len_sq > eq_ctx->q->limit_len_squared) {
-        long_edge_queue_edge_add_recursive(
-            eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->q->limit_len);
-      }
+    const float len_sq = BM_edge_calc_length_squared(l_iter->e);
+    if (len_sq > eq_ctx->q->limit_len_squared) {
+      long_edge_queue_edge_add_recursive(
+          eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->q->limit_len);
+    }
 #else
-      long_edge_queue_edge_add(eq_ctx, l_iter->e);
+    long_edge_queue_edge_add(eq_ctx, l_iter->e);
 #endif
-    } while ((l_iter = l_iter->next) != l_first);
-  }
+  } while ((l_iter = l_iter->next) != l_first);
 }
 
-static void short_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+static void long_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
 {
-#ifdef USE_EDGEQUEUE_FRONTFACE
-  if (eq_ctx->q->use_view_normal) {
-    if (dot_v3v3(f->no, eq_ctx->q->view_normal) < 0.0f) {
-      return;
-    }
+  if (edge_queue_face_in_range(eq_ctx->q, f)) {
+    long_edge_queue_face_edges_add(eq_ctx, f);
   }
-#endif
+}
 
-  if (eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f)) {
-    BMLoop *l_iter;
-    BMLoop *l_first;
+static void short_edge_queue_face_edges_add(EdgeQueueContext *eq_ctx, BMFace *f)
+{
+  BMLoop *l_iter;
+  BMLoop *l_first;
 
-    /* Check each edge of the face. */
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      short_edge_queue_edge_add(eq_ctx, l_iter->e);
-    } while ((l_iter = l_iter->next) != l_first);
+  /* Check each edge of the face. */
+  l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+  do {
+    short_edge_queue_edge_add(eq_ctx, l_iter->e);
+  } while ((l_iter = l_iter->next) != l_first);
+}
+
+/**
+ * Gather the faces within the queue's range, for each leaf node marked for topology update.
+ * The range tests only read the mesh and are the costly part of filling the queues, so the
+ * nodes are tested in parallel; the queues themselves are filled serially afterwards.
+ */
+static Array<Vector<BMFace *>> edge_queue_faces_in_range(const EdgeQueue *q, PBVH *pbvh)
+{
+  Vector<PBVHNode *> nodes;
+  for (PBVHNode &node : pbvh->nodes) {
+    if ((node.flag & PBVH_Leaf) && (node.flag & PBVH_UpdateTopology) &&
+        !(node.flag & PBVH_FullyHidden))
+    {
+      nodes.append(&node);
+    }
   }
+
+  Array<Vector<BMFace *>> node_faces(nodes.size());
+  blender::threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      for (BMFace *f : nodes[i]->bm_faces) {
+        if (edge_queue_face_in_range(q, f)) {
+          node_faces[i].append(f);
+        }
+      }
+    }
+  });
+  return node_faces;
 }
 
 /**
@@ -1031,14 +1061,9 @@ static void long_edge_queue_create(EdgeQueueContext *eq_ctx,
   pbvh_bmesh_edge_tag_verify(pbvh);
 #endif
 
-  for (PBVHNode &node : pbvh->nodes) {
-    /* Check leaf nodes marked for topology update. */
-    if ((node.flag & PBVH_Leaf) && (node.flag & PBVH_UpdateTopology) &&
-        !(node.flag & PBVH_FullyHidden))
-    {
-      for (BMFace *f : node.bm_faces) {
-        long_edge_queue_face_add(eq_ctx, f);
-      }
+  for (const Vector<BMFace *> &faces : edge_queue_faces_in_range(eq_ctx->q, pbvh)) {
+    for (BMFace *f : faces) {
+      long_edge_queue_face_edges_add(eq_ctx, f);
     }
   }
 }
@@ -1085,14 +1110,9 @@ static void short_edge_queue_create(EdgeQueueContext *eq_ctx,
     eq_ctx->q->edge_queue_tri_in_range = edge_queue_tri_in_sphere;
   }
 
-  for (PBVHNode &node : pbvh->nodes) {
-    /* Check leaf nodes marked for topology update */
-    if ((node.flag & PBVH_Leaf) && (node.flag & PBVH_UpdateTopology) &&
-        !(node.flag & PBVH_FullyHidden))
-    {
-      for (BMFace *f : node.bm_faces) {
-        short_edge_queue_face_add(eq_ctx, f);
-      }
+  for (const Vector<BMFace *> &faces : edge_queue_faces_in_range(eq_ctx->q, pbvh)) {
+    for (BMFace *f : faces) {
+      short_edge_queue_face_edges_add(eq_ctx, f);
     }
   }
 }
@@ -39,6 +39,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -84,6 +85,8 @@
 #  include "LzmaLib.h"
 #endif
 
+#include <zstd.h>
+
 #define PTCACHE_DATA_FROM(data, type, from) \
   if (data[type]) { \
     memcpy(data[type], from, ptcache_data_size[type]); \
@@ -1542,6 +1545,10 @@ static int ptcache_file_compressed_read(PTCacheFile *pf, uchar *result, uint len
         r = LzmaUncompress(result, &leno, in, &leni, props, sizeOfIt);
       }
 #endif
+      if (compressed == PTCACHE_COMPRESS_ZSTD) {
+        const size_t result_len = ZSTD_decompress(result, len, in, in_len);
+        r = (ZSTD_isError(result_len) || result_len != len) ? -1 : 0;
+      }
       MEM_freeN(in);
     }
   }
@@ -1553,28 +1560,34 @@ static int ptcache_file_compressed_read(PTCacheFile *pf, uchar *result, uint len
 
   return r;
 }
-static int ptcache_file_compressed_write(
-    PTCacheFile *pf, uchar *in, uint in_len, uchar *out, int mode)
+/** Result of compressing a block of cache data, see #ptcache_data_compress. */
+struct PTCacheCompressedData {
+  /** #PTCACHE_COMPRESS_NO when the data is written uncompressed. */
+  uchar compressed = PTCACHE_COMPRESS_NO;
+  size_t out_len = 0;
+  uchar props[16] = {0};
+  size_t props_len = 5;
+};
+
+/**
+ * Compress \a in into \a out, which must have space for `LZO_OUT_LEN(in_len)` bytes. The file is
+ * not accessed, so multiple blocks can be compressed in parallel before they are written.
+ */
+static int ptcache_data_compress(
+    const uchar *in, uint in_len, uchar *out, int mode, PTCacheCompressedData *r_data)
 {
   int r = 0;
-  uchar compressed = 0;
-  size_t out_len = 0;
-  uchar *props = static_cast<uchar *>(MEM_callocN(sizeof(char[16]), "tmp"));
-  size_t sizeOfIt = 5;
+  size_t out_len = LZO_OUT_LEN(in_len);
 
-  (void)mode; /* unused when building w/o compression */
+  r_data->compressed = PTCACHE_COMPRESS_NO;
 
 #ifdef WITH_LZO
-  out_len = LZO_OUT_LEN(in_len);
   if (mode == PTCACHE_COMPRESS_LZO) {
     LZO_HEAP_ALLOC(wrkmem, LZO1X_MEM_COMPRESS);
 
     r = lzo1x_1_compress(in, (lzo_uint)in_len, out, (lzo_uint *)&out_len, wrkmem);
-    if (!(r == LZO_E_OK) || (out_len >= in_len)) {
-      compressed = 0;
-    }
-    else {
-      compressed = 1;
+    if ((r == LZO_E_OK) && (out_len < in_len)) {
+      r_data->compressed = PTCACHE_COMPRESS_LZO;
     }
   }
 #endif
@@ -1585,8 +1598,8 @@ static int ptcache_file_compressed_write(
                      &out_len,
                      in,
                      in_len, /* Assume `sizeof(char) == 1`. */
-                     props,
-                     &sizeOfIt,
+                     r_data->props,
+                     &r_data->props_len,
                      5,
                      1 << 24,
                      3,
@@ -1595,33 +1608,56 @@ static int ptcache_file_compressed_write(
                      32,
                      2);
 
-    if (!(r == SZ_OK) || (out_len >= in_len)) {
-      compressed = 0;
-    }
-    else {
-      compressed = 2;
+    if ((r == SZ_OK) && (out_len < in_len)) {
+      r_data->compressed = PTCACHE_COMPRESS_LZMA;
     }
   }
 #endif
+  if (mode == PTCACHE_COMPRESS_ZSTD) {
+    BLI_assert(ZSTD_compressBound(in_len) <= out_len);
+    out_len = ZSTD_compress(out, out_len, in, in_len, ZSTD_CLEVEL_DEFAULT);
+    if (ZSTD_isError(out_len)) {
+      r = -1;
+    }
+    else if (out_len < in_len) {
+      r_data->compressed = PTCACHE_COMPRESS_ZSTD;
+    }
+  }
 
-  ptcache_file_write(pf, &compressed, 1, sizeof(uchar));
-  if (compressed) {
-    uint size = out_len;
+  r_data->out_len = out_len;
+
+  return r;
+}
+
+static void ptcache_file_compressed_data_write(PTCacheFile *pf,
+                                               const uchar *in,
+                                               uint in_len,
+                                               const uchar *out,
+                                               const PTCacheCompressedData &data)
+{
+  ptcache_file_write(pf, &data.compressed, 1, sizeof(uchar));
+  if (data.compressed) {
+    uint size = data.out_len;
     ptcache_file_write(pf, &size, 1, sizeof(uint));
-    ptcache_file_write(pf, out, out_len, sizeof(uchar));
+    ptcache_file_write(pf, out, data.out_len, sizeof(uchar));
   }
   else {
     ptcache_file_write(pf, in, in_len, sizeof(uchar));
   }
 
-  if (compressed == 2) {
-    uint size = sizeOfIt;
-    ptcache_file_write(pf, &sizeOfIt, 1, sizeof(uint));
-    ptcache_file_write(pf, props, size, sizeof(uchar));
+  if (data.compressed == PTCACHE_COMPRESS_LZMA) {
+    uint size = data.props_len;
+    ptcache_file_write(pf, &data.props_len, 1, sizeof(uint));
+    ptcache_file_write(pf, data.props, size, sizeof(uchar));
   }
+}
 
-  MEM_freeN(props);
-
+static int ptcache_file_compressed_write(
+    PTCacheFile *pf, uchar *in, uint in_len, uchar *out, int mode)
+{
+  PTCacheCompressedData data;
+  const int r = ptcache_data_compress(in, in_len, out, mode, &data);
+  ptcache_file_compressed_data_write(pf, in, in_len, out, data);
   return r;
 }
 static int ptcache_file_read(PTCacheFile *pf, void *f, uint tot, uint size)
@@ -2060,13 +2096,30 @@ static int ptcache_mem_frame_to_disk(PTCacheID *pid, PTCacheMem *pm)
 
   if (!error) {
     if (pid->cache->compression) {
+      /* Compress all data arrays in parallel, they are written in order afterwards. */
+      uchar *out[BPHYS_TOT_DATA] = {nullptr};
+      PTCacheCompressedData compressed[BPHYS_TOT_DATA];
+      blender::threading::parallel_for(
+          blender::IndexRange(BPHYS_TOT_DATA), 1, [&](const blender::IndexRange range) {
+            for (const int data_i : range) {
+              if (pm->data[data_i]) {
+                uint in_len = pm->totpoint * ptcache_data_size[data_i];
+                out[data_i] = (uchar *)MEM_callocN(LZO_OUT_LEN(in_len) * 4,
+                                                   "pointcache_lzo_buffer");
+                ptcache_data_compress((uchar *)(pm->data[data_i]),
+                                      in_len,
+                                      out[data_i],
+                                      pid->cache->compression,
+                                      &compressed[data_i]);
+              }
+            }
+          });
       for (i = 0; i < BPHYS_TOT_DATA; i++) {
         if (pm->data[i]) {
           uint in_len = pm->totpoint * ptcache_data_size[i];
-          uchar *out = (uchar *)MEM_callocN(LZO_OUT_LEN(in_len) * 4, "pointcache_lzo_buffer");
-          ptcache_file_compressed_write(
-              pf, (uchar *)(pm->data[i]), in_len, out, pid->cache->compression);
-          MEM_freeN(out);
+          ptcache_file_compressed_data_write(
+              pf, (uchar *)(pm->data[i]), in_len, out[i], compressed[i]);
+          MEM_freeN(out[i]);
         }
       }
     }
@@ -2110,6 +2110,12 @@ static void rigidbody_free_substep_data(ListBase *substep_targets)
 }
 static void rigidbody_update_simulation_post_step(Depsgraph *depsgraph, RigidBodyWorld *rbw)
 {
+  if ((G.moving & G_TRANSFORM_OBJ) == 0) {
+    /* Only objects that are being transformed need to be reset, avoid iterating over all
+     * objects of the world and looking up their bases otherwise. */
+    return;
+  }
+
   const Scene *scene = DEG_get_input_scene(depsgraph);
   ViewLayer *view_layer = DEG_get_input_view_layer(depsgraph);
   BKE_view_layer_synced_ensure(scene, view_layer);
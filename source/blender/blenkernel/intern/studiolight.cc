@@ -33,10 +33,18 @@
 
 #include "MEM_guardedalloc.h"
 
+#include <atomic>
 #include <cstring>
+#include <mutex>
 
 /* Statics */
 static ListBase studiolights;
+/**
+ * Scanning the studio-light folders is deferred until the studio-lights are first accessed,
+ * since background instances often never need them.
+ */
+static std::atomic<bool> studiolights_need_init = false;
+static std::mutex studiolights_init_mutex;
 static int last_studiolight_id = 0;
 #define STUDIOLIGHT_RADIANCE_CUBEMAP_SIZE 96
 #define STUDIOLIGHT_IRRADIANCE_EQUIRECT_HEIGHT 32
@@ -1432,7 +1440,7 @@ void BKE_studiolight_default(SolidLight lights[4], float light_ambient[3])
   lights[3].vec[2] = -0.542269f;
 }
 
-void BKE_studiolight_init()
+static void studiolight_init_list()
 {
   /* Add default studio light */
   StudioLight *sl = studiolight_create(
@@ -1473,8 +1481,26 @@ void BKE_studiolight_init()
   BKE_studiolight_default(sl->light, sl->light_ambient);
 }
 
+static void studiolight_ensure_list()
+{
+  if (!studiolights_need_init) {
+    return;
+  }
+  std::lock_guard lock(studiolights_init_mutex);
+  if (studiolights_need_init) {
+    studiolight_init_list();
+    studiolights_need_init = false;
+  }
+}
+
+void BKE_studiolight_init()
+{
+  studiolights_need_init = true;
+}
+
 void BKE_studiolight_free()
 {
+  studiolights_need_init = false;
   while (StudioLight *sl = static_cast<StudioLight *>(BLI_pophead(&studiolights))) {
     studiolight_free(sl);
   }
@@ -1482,6 +1508,8 @@ void BKE_studiolight_free()
 
 StudioLight *BKE_studiolight_find_default(int flag)
 {
+  studiolight_ensure_list();
+
   const char *default_name = "";
 
   if (flag & STUDIOLIGHT_TYPE_WORLD) {
@@ -1507,6 +1535,8 @@ StudioLight *BKE_studiolight_find_default(int flag)
 
 StudioLight *BKE_studiolight_find(const char *name, int flag)
 {
+  studiolight_ensure_list();
+
   LISTBASE_FOREACH (StudioLight *, sl, &studiolights) {
     if (STREQLEN(sl->name, name, FILE_MAXFILE)) {
       if (sl->flag & flag) {
@@ -1523,6 +1553,8 @@ StudioLight *BKE_studiolight_find(const char *name, int flag)
 
 StudioLight *BKE_studiolight_findindex(int index, int flag)
 {
+  studiolight_ensure_list();
+
   LISTBASE_FOREACH (StudioLight *, sl, &studiolights) {
     if (sl->index == index) {
       return sl;
@@ -1534,6 +1566,7 @@ StudioLight *BKE_studiolight_findindex(int index, int flag)
 
 ListBase *BKE_studiolight_listbase()
 {
+  studiolight_ensure_list();
   return &studiolights;
 }
 
@@ -1610,6 +1643,7 @@ void BKE_studiolight_remove(StudioLight *sl)
 
 StudioLight *BKE_studiolight_load(const char *filepath, int type)
 {
+  studiolight_ensure_list();
   StudioLight *sl = studiolight_add_file(filepath, type | STUDIOLIGHT_USER_DEFINED);
   return sl;
 }
@@ -1632,6 +1666,7 @@ StudioLight *BKE_studiolight_create(const char *filepath,
 
   studiolight_write_solid_light(sl);
 
+  studiolight_ensure_list();
   BLI_addtail(&studiolights, sl);
   return sl;
 }
@@ -11,6 +11,8 @@
 #include "DNA_mesh_types.h"
 #include "DNA_meshdata_types.h"
 
+#include "BLI_array_utils.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_math_vector.h"
 #include "BLI_task.h"
 #include "BLI_timeit.hh"
@@ -89,16 +91,14 @@ static void set_coarse_positions(Subdiv *subdiv,
         evaluator, reinterpret_cast<const float *>(positions.data()), 0, positions.size());
     return;
   }
-  Array<float3> used_vert_positions(positions.size() - verts_no_face.count);
   const BitSpan bits = verts_no_face.is_loose_bits;
-  int used_vert_count = 0;
-  for (const int vert : positions.index_range()) {
-    if (bits[vert]) {
-      continue;
-    }
-    used_vert_positions[used_vert_count] = positions[vert];
-    used_vert_count++;
-  }
+  IndexMaskMemory memory;
+  const IndexMask used_verts = IndexMask::from_predicate(
+      positions.index_range(), GrainSize(4096), memory, [&](const int vert) {
+        return !bits[vert];
+      });
+  Array<float3> used_vert_positions(used_verts.size());
+  array_utils::gather(positions, used_verts, used_vert_positions.as_mutable_span());
   evaluator->setCoarsePositions(evaluator,
                                 reinterpret_cast<const float *>(used_vert_positions.data()),
                                 0,
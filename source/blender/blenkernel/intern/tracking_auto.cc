@@ -712,6 +712,19 @@ bool BKE_autotrack_context_step(AutoTrackContext *context)
     return false;
   }
 
+  /* Acquire the frames which are used by this step once, so that the tracking threads share them
+   * instead of waiting for each other on the movie clip cache lock. */
+  const int frame_delta = context->is_backwards ? -1 : 1;
+  for (int i = 0; i < context->num_autotrack_markers; ++i) {
+    const libmv_Marker &libmv_marker = context->autotrack_markers[i].libmv_marker;
+    tracking_image_accessor_prefetch_frame(
+        context->image_accessor, libmv_marker.clip, libmv_marker.frame);
+    tracking_image_accessor_prefetch_frame(
+        context->image_accessor, libmv_marker.clip, libmv_marker.frame + frame_delta);
+    tracking_image_accessor_prefetch_frame(
+        context->image_accessor, libmv_marker.clip, libmv_marker.reference_frame);
+  }
+
   AutoTrackTLS tls;
   BLI_listbase_clear(&tls.results);
 
@@ -725,6 +738,8 @@ bool BKE_autotrack_context_step(AutoTrackContext *context)
   BLI_task_parallel_range(
       0, context->num_autotrack_markers, context, autotrack_context_step_cb, &settings);
 
+  tracking_image_accessor_release_prefetched_frames(context->image_accessor);
+
   /* Prepare next tracking step by updating the AutoTrack context with new markers and moving
    * tracked markers as an input for the next iteration. */
   context->num_autotrack_markers = 0;
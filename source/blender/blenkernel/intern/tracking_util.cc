@@ -593,9 +593,7 @@ MovieTrackingMarker *tracking_get_keyframed_marker(MovieTrackingTrack *track,
 /** \name Frame Accessor
  * \{ */
 
-static ImBuf *accessor_get_preprocessed_ibuf(TrackingImageAccessor *accessor,
-                                             int clip_index,
-                                             int frame)
+static ImBuf *accessor_get_clip_ibuf(TrackingImageAccessor *accessor, int clip_index, int frame)
 {
   MovieClip *clip;
   MovieClipUser user;
@@ -614,6 +612,24 @@ static ImBuf *accessor_get_preprocessed_ibuf(TrackingImageAccessor *accessor,
   return ibuf;
 }
 
+static ImBuf *accessor_get_preprocessed_ibuf(TrackingImageAccessor *accessor,
+                                             int clip_index,
+                                             int frame)
+{
+  /* Prefer frames acquired ahead of the tracking step, avoiding the movie clip cache lock. */
+  for (int i = 0; i < accessor->num_prefetched_frames; i++) {
+    const TrackingImageAccessorFrame &prefetched = accessor->prefetched_frames[i];
+    if (prefetched.clip_index == clip_index && prefetched.frame == frame) {
+      if (prefetched.ibuf != nullptr) {
+        IMB_refImBuf(prefetched.ibuf);
+      }
+      return prefetched.ibuf;
+    }
+  }
+
+  return accessor_get_clip_ibuf(accessor, clip_index, frame);
+}
+
 static ImBuf *make_grayscale_ibuf_copy(ImBuf *ibuf)
 {
   ImBuf *grayscale = IMB_allocImBuf(ibuf->x, ibuf->y, 32, 0);
@@ -907,10 +923,45 @@ TrackingImageAccessor *tracking_image_accessor_new(MovieClip *clips[MAX_ACCESSOR
 
 void tracking_image_accessor_destroy(TrackingImageAccessor *accessor)
 {
+  tracking_image_accessor_release_prefetched_frames(accessor);
   libmv_FrameAccessorDestroy(accessor->libmv_accessor);
   BLI_spin_end(&accessor->cache_lock);
   MEM_freeN(accessor->tracks);
   MEM_freeN(accessor);
 }
 
+void tracking_image_accessor_prefetch_frame(TrackingImageAccessor *accessor,
+                                            int clip_index,
+                                            int frame)
+{
+  for (int i = 0; i < accessor->num_prefetched_frames; i++) {
+    const TrackingImageAccessorFrame &prefetched = accessor->prefetched_frames[i];
+    if (prefetched.clip_index == clip_index && prefetched.frame == frame) {
+      return;
+    }
+  }
+
+  if (accessor->num_prefetched_frames == MAX_ACCESSOR_PREFETCHED_FRAMES) {
+    /* Frames which don't fit are acquired from the movie clip cache when needed. */
+    return;
+  }
+
+  TrackingImageAccessorFrame &prefetched =
+      accessor->prefetched_frames[accessor->num_prefetched_frames];
+  prefetched.clip_index = clip_index;
+  prefetched.frame = frame;
+  prefetched.ibuf = accessor_get_clip_ibuf(accessor, clip_index, frame);
+  accessor->num_prefetched_frames++;
+}
+
+void tracking_image_accessor_release_prefetched_frames(TrackingImageAccessor *accessor)
+{
+  for (int i = 0; i < accessor->num_prefetched_frames; i++) {
+    if (accessor->prefetched_frames[i].ibuf != nullptr) {
+      IMB_freeImBuf(accessor->prefetched_frames[i].ibuf);
+    }
+  }
+  accessor->num_prefetched_frames = 0;
+}
+
 /** \} */
@@ -220,6 +220,24 @@ static struct VolumeFileCache {
     update_for_remove_user(entry);
   }
 
+  /**
+   * Remove the tree user and take ownership of the entry's grid if it isn't shared with any other
+   * user. Returns null and does nothing if the grid is shared.
+   */
+  openvdb::GridBase::Ptr remove_unique_tree_user(Entry &entry)
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (entry.num_tree_users != 1 || entry.num_metadata_users != 0 || !entry.is_loaded ||
+        entry.grid.use_count() != 1 || !entry.grid->isTreeUnique())
+    {
+      return nullptr;
+    }
+    openvdb::GridBase::Ptr grid = std::move(entry.grid);
+    entry.num_tree_users--;
+    update_for_remove_user(entry);
+    return grid;
+  }
+
   void change_to_tree_user(Entry &entry)
   {
     std::lock_guard<std::mutex> lock(mutex);
@@ -389,12 +407,25 @@ struct VolumeGrid {
     /* Make a deep copy of the grid and remove any reference to a grid in the
      * file cache. Load file grid into memory first if needed. */
     load(volume_name, filepath);
-    /* TODO: avoid deep copy if we are the only user. */
-    local_grid = grid()->deepCopyGrid();
     if (entry) {
-      GLOBAL_CACHE.remove_user(*entry, is_loaded);
+      /* Avoid the deep copy if we are the only user of the file grid. */
+      openvdb::GridBase::Ptr unique_grid = (simplify_level == 0) ?
+                                               GLOBAL_CACHE.remove_unique_tree_user(*entry) :
+                                               nullptr;
+      if (unique_grid) {
+        local_grid = std::move(unique_grid);
+      }
+      else {
+        local_grid = grid()->deepCopyGrid();
+        GLOBAL_CACHE.remove_user(*entry, is_loaded);
+      }
       entry = nullptr;
     }
+    else if (local_grid.use_count() != 1 || !local_grid->isTreeUnique()) {
+      /* The grid or its tree is shared with other volumes (e.g. after copying the volume), only
+       * copy it in that case. */
+      local_grid = local_grid->deepCopyGrid();
+    }
     is_loaded = true;
   }
 
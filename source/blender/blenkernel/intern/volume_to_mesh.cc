@@ -5,7 +5,9 @@
 #include <vector>
 
 #include "BLI_math_vector_types.hh"
+#include "BLI_offset_indices.hh"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_mesh_types.h"
@@ -103,10 +105,13 @@ struct VolumeToMeshOp {
         grid, this->verts, this->tris, this->quads, this->threshold, this->adaptivity);
 
     /* Better align generated mesh with volume (see #85312). */
-    openvdb::Vec3s offset = grid.voxelSize() / 2.0f;
-    for (openvdb::Vec3s &position : this->verts) {
-      position += offset;
-    }
+    const openvdb::Vec3s offset = grid.voxelSize() / 2.0f;
+    MutableSpan<openvdb::Vec3s> verts = this->verts;
+    threading::parallel_for(verts.index_range(), 4096, [&](const IndexRange range) {
+      for (openvdb::Vec3s &position : verts.slice(range)) {
+        position += offset;
+      }
+    });
   }
 };
 
@@ -124,24 +129,30 @@ void fill_mesh_from_openvdb_data(const Span<openvdb::Vec3s> vdb_verts,
   vert_positions.slice(vert_offset, vdb_verts.size()).copy_from(vdb_verts.cast<float3>());
 
   /* Write triangles. */
-  for (const int i : vdb_tris.index_range()) {
-    face_offsets[face_offset + i] = loop_offset + 3 * i;
-    for (int j = 0; j < 3; j++) {
-      /* Reverse vertex order to get correct normals. */
-      corner_verts[loop_offset + 3 * i + j] = vert_offset + vdb_tris[i][2 - j];
+  offset_indices::fill_constant_group_size(
+      3, loop_offset, face_offsets.slice(face_offset, vdb_tris.size()));
+  threading::parallel_for(vdb_tris.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      for (int j = 0; j < 3; j++) {
+        /* Reverse vertex order to get correct normals. */
+        corner_verts[loop_offset + 3 * i + j] = vert_offset + vdb_tris[i][2 - j];
+      }
     }
-  }
+  });
 
   /* Write quads. */
   const int quad_offset = face_offset + vdb_tris.size();
   const int quad_loop_offset = loop_offset + vdb_tris.size() * 3;
-  for (const int i : vdb_quads.index_range()) {
-    face_offsets[quad_offset + i] = quad_loop_offset + 4 * i;
-    for (int j = 0; j < 4; j++) {
-      /* Reverse vertex order to get correct normals. */
-      corner_verts[quad_loop_offset + 4 * i + j] = vert_offset + vdb_quads[i][3 - j];
+  offset_indices::fill_constant_group_size(
+      4, quad_loop_offset, face_offsets.slice(quad_offset, vdb_quads.size()));
+  threading::parallel_for(vdb_quads.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      for (int j = 0; j < 4; j++) {
+        /* Reverse vertex order to get correct normals. */
+        corner_verts[quad_loop_offset + 4 * i + j] = vert_offset + vdb_quads[i][3 - j];
+      }
     }
-  }
+  });
 }
 
 bke::OpenVDBMeshData volume_to_mesh_data(const openvdb::GridBase &grid,
@@ -50,6 +50,10 @@ float do_clump(ParticleKey *state,
                bool use_clump_noise,
                float clump_noise_size,
                const struct CurveMapping *clumpcurve);
+/**
+ * Pre-compute the twist curve integral of the thread context, used by the twist child modifier.
+ */
+void psys_twist_integral_init(ParticleThreadContext *ctx);
 void do_child_modifiers(const ParticleChildModifierContext *modifier_ctx,
                         float mat[4][4],
                         ParticleKey *state,
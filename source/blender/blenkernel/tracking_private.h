@@ -18,6 +18,7 @@ extern "C" {
 #endif
 
 struct GHash;
+struct ImBuf;
 struct MovieTracking;
 struct MovieTrackingMarker;
 
@@ -155,6 +156,14 @@ float *tracking_track_get_mask_for_region(const int frame_width,
 struct libmv_FrameAccessor;
 
 #define MAX_ACCESSOR_CLIP 64
+#define MAX_ACCESSOR_PREFETCHED_FRAMES (2 * MAX_ACCESSOR_CLIP)
+
+typedef struct TrackingImageAccessorFrame {
+  int clip_index;
+  int frame;
+  struct ImBuf *ibuf;
+} TrackingImageAccessorFrame;
+
 typedef struct TrackingImageAccessor {
   struct MovieClip *clips[MAX_ACCESSOR_CLIP];
   int num_clips;
@@ -167,6 +176,11 @@ typedef struct TrackingImageAccessor {
 
   struct libmv_FrameAccessor *libmv_accessor;
   SpinLock cache_lock;
+
+  /* Original frames acquired ahead of a tracking step, shared by all tracks.
+   * Only modified while no tracking is happening, so reading them does not need locking. */
+  TrackingImageAccessorFrame prefetched_frames[MAX_ACCESSOR_PREFETCHED_FRAMES];
+  int num_prefetched_frames;
 } TrackingImageAccessor;
 
 /**
@@ -182,6 +196,20 @@ TrackingImageAccessor *tracking_image_accessor_new(MovieClip *clips[MAX_ACCESSOR
                                                    int num_tracks);
 void tracking_image_accessor_destroy(TrackingImageAccessor *accessor);
 
+/**
+ * Acquire the original image of the given clip frame, so that tracking threads get it without
+ * going through the movie clip cache, which is protected by a global lock.
+ *
+ * \note Must not be called while the accessor is used for tracking.
+ */
+void tracking_image_accessor_prefetch_frame(TrackingImageAccessor *accessor,
+                                            int clip_index,
+                                            int frame);
+/**
+ * Release all frames acquired by #tracking_image_accessor_prefetch_frame.
+ */
+void tracking_image_accessor_release_prefetched_frames(TrackingImageAccessor *accessor);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,271 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * A #ConcurrentMap is a hash map that allows lookups and insertions from multiple threads at the
+ * same time. It is mainly a wrapper for `tbb::concurrent_hash_map`. The wrapper is needed because
+ * we want to be able to build without tbb, in which case a single mutex protects a #Map.
+ *
+ * Elements are accessed through accessors, which lock the element for as long as they are alive.
+ * A #MutableAccessor gives exclusive access to the element, while any number of #ConstAccessor
+ * can access the same element at the same time. Accessors should be short lived, and no other
+ * element of the same map should be accessed while an accessor is held.
+ *
+ * When building with tbb, the hash and equality functions of the map are used, so existing
+ * #DefaultHash specializations work with this map too. Unlike #Map, the map does not use the
+ * probing strategies from `BLI_probing_strategies.hh`, because concurrent insertion requires
+ * buckets that can be locked individually.
+ *
+ * Iterating over the map while other threads modify it is not supported.
+ */
+
+#ifdef WITH_TBB
+/* Quiet top level deprecation message, unrelated to API usage here. */
+#  if defined(WIN32) && !defined(NOMINMAX)
+/* TBB includes Windows.h which will define min/max macros causing issues
+ * when we try to use std::min and std::max later on. */
+#    define NOMINMAX
+#    define TBB_MIN_MAX_CLEANUP
+#  endif
+#  include <tbb/concurrent_hash_map.h>
+#  ifdef WIN32
+/* We cannot keep this defined, since other parts of the code deal with this on their own, leading
+ * to multiple define warnings unless we un-define this, however we can only undefine this if we
+ * were the ones that made the definition earlier. */
+#    ifdef TBB_MIN_MAX_CLEANUP
+#      undef NOMINMAX
+#    endif
+#  endif
+#else
+#  include <memory>
+#  include <mutex>
+
+#  include "BLI_map.hh"
+#endif
+
+#include "BLI_hash.hh"
+#include "BLI_hash_tables.hh"
+#include "BLI_utility_mixins.hh"
+
+namespace blender {
+
+template<typename Key,
+         typename Value,
+         typename Hash = DefaultHash<Key>,
+         typename IsEqual = DefaultEquality<Key>>
+class ConcurrentMap : NonCopyable, NonMovable {
+ public:
+  using size_type = int64_t;
+
+#ifdef WITH_TBB
+
+ private:
+  /** Adapts the hash and equality functions to the interface expected by tbb. */
+  struct HashCompare {
+    size_t hash(const Key &key) const
+    {
+      return size_t(Hash{}(key));
+    }
+
+    bool equal(const Key &a, const Key &b) const
+    {
+      return IsEqual{}(a, b);
+    }
+  };
+
+  using TBBMap = tbb::concurrent_hash_map<Key, Value, HashCompare>;
+
+  TBBMap map_;
+
+ public:
+  using MutableAccessor = typename TBBMap::accessor;
+  using ConstAccessor = typename TBBMap::const_accessor;
+
+  ConcurrentMap() = default;
+
+  /**
+   * Find the element with the given key. Returns false if there is none.
+   */
+  bool lookup(MutableAccessor &accessor, const Key &key)
+  {
+    return map_.find(accessor, key);
+  }
+  bool lookup(ConstAccessor &accessor, const Key &key) const
+  {
+    return map_.find(accessor, key);
+  }
+
+  /**
+   * Find the element with the given key, or add it with a default constructed value if it does
+   * not exist yet. Returns true when the element has been added.
+   */
+  bool add(MutableAccessor &accessor, const Key &key)
+  {
+    return map_.insert(accessor, key);
+  }
+  bool add(ConstAccessor &accessor, const Key &key)
+  {
+    return map_.insert(accessor, key);
+  }
+
+  /**
+   * Remove the element with the given key. Returns false if there was none.
+   */
+  bool remove(const Key &key)
+  {
+    return map_.erase(key);
+  }
+
+  /**
+   * Get the number of elements in the map. This is only exact when no other thread modifies the
+   * map at the same time.
+   */
+  size_type size() const
+  {
+    return size_type(map_.size());
+  }
+
+  bool is_empty() const
+  {
+    return map_.empty();
+  }
+
+  /**
+   * Call \a fn with the key and value of every element. Must not be called while other threads
+   * modify the map.
+   */
+  template<typename Fn> void foreach_item(const Fn &fn) const
+  {
+    for (const typename TBBMap::value_type &item : map_) {
+      fn(item.first, item.second);
+    }
+  }
+
+#else /* WITH_TBB */
+
+ private:
+  using Item = std::pair<const Key, Value>;
+
+  mutable std::mutex mutex_;
+  /* The items are not embedded in the map, so that their addresses do not change when the map
+   * grows. */
+  Map<Key, std::unique_ptr<Item>, 4, DefaultProbingStrategy, Hash, IsEqual> map_;
+
+  /** Keeps the map locked while the accessed element is in use. */
+  template<typename ItemT> class AccessorBase : NonCopyable, NonMovable {
+   private:
+    std::unique_lock<std::mutex> lock_;
+    ItemT *item_ = nullptr;
+
+    friend ConcurrentMap;
+
+   public:
+    /** Stop accessing the element and unlock the map. */
+    void release()
+    {
+      item_ = nullptr;
+      if (lock_.owns_lock()) {
+        lock_.unlock();
+      }
+    }
+
+    ItemT *operator->() const
+    {
+      BLI_assert(item_ != nullptr);
+      return item_;
+    }
+
+    ItemT &operator*() const
+    {
+      BLI_assert(item_ != nullptr);
+      return *item_;
+    }
+  };
+
+ public:
+  using MutableAccessor = AccessorBase<Item>;
+  using ConstAccessor = AccessorBase<const Item>;
+
+  ConcurrentMap() = default;
+
+  bool lookup(MutableAccessor &accessor, const Key &key)
+  {
+    return this->lookup_impl(accessor, key);
+  }
+  bool lookup(ConstAccessor &accessor, const Key &key) const
+  {
+    return this->lookup_impl(accessor, key);
+  }
+
+  bool add(MutableAccessor &accessor, const Key &key)
+  {
+    return this->add_impl(accessor, key);
+  }
+  bool add(ConstAccessor &accessor, const Key &key)
+  {
+    return this->add_impl(accessor, key);
+  }
+
+  bool remove(const Key &key)
+  {
+    std::lock_guard lock{mutex_};
+    return map_.remove(key);
+  }
+
+  size_type size() const
+  {
+    std::lock_guard lock{mutex_};
+    return map_.size();
+  }
+
+  bool is_empty() const
+  {
+    return this->size() == 0;
+  }
+
+  template<typename Fn> void foreach_item(const Fn &fn) const
+  {
+    for (const std::unique_ptr<Item> &item : map_.values()) {
+      fn(item->first, item->second);
+    }
+  }
+
+ private:
+  template<typename Accessor> bool lookup_impl(Accessor &accessor, const Key &key) const
+  {
+    /* Release the previously accessed element first, like the tbb accessors do. */
+    accessor.release();
+    accessor.lock_ = std::unique_lock<std::mutex>(mutex_);
+    const std::unique_ptr<Item> *item = map_.lookup_ptr(key);
+    if (item == nullptr) {
+      accessor.item_ = nullptr;
+      accessor.lock_.unlock();
+      return false;
+    }
+    accessor.item_ = item->get();
+    return true;
+  }
+
+  template<typename Accessor> bool add_impl(Accessor &accessor, const Key &key)
+  {
+    /* Release the previously accessed element first, like the tbb accessors do. */
+    accessor.release();
+    accessor.lock_ = std::unique_lock<std::mutex>(mutex_);
+    bool added = false;
+    std::unique_ptr<Item> &item = map_.lookup_or_add_cb(key, [&]() {
+      added = true;
+      return std::make_unique<Item>(key, Value());
+    });
+    accessor.item_ = item.get();
+    return added;
+  }
+
+#endif /* WITH_TBB */
+};
+
+}  // namespace blender
@@ -187,10 +187,24 @@ class IndexMask : private IndexMaskData {
   static IndexMask from_bools(const IndexMask &universe,
                               const VArray<bool> &bools,
                               IndexMaskMemory &memory);
-  /** Construct a mask from the union of two other masks. */
+  /**
+   * Construct a mask from the union of two other masks.
+   *
+   * This and the other set operations below work on blocks of #max_segment_size indices at a
+   * time, copying segments directly when the result of a block is known from one mask alone and
+   * combining bit spans otherwise.
+   */
   static IndexMask from_union(const IndexMask &mask_a,
                               const IndexMask &mask_b,
                               IndexMaskMemory &memory);
+  /** Construct a mask from the indices that are in both masks. */
+  static IndexMask from_intersection(const IndexMask &mask_a,
+                                     const IndexMask &mask_b,
+                                     IndexMaskMemory &memory);
+  /** Construct a mask from the indices that are in the first mask but not in the second. */
+  static IndexMask from_difference(const IndexMask &mask_a,
+                                   const IndexMask &mask_b,
+                                   IndexMaskMemory &memory);
   /** Construct a mask from all the indices for which the predicate is true. */
   template<typename Fn>
   static IndexMask from_predicate(const IndexMask &universe,
@@ -247,6 +261,11 @@ class IndexMask : private IndexMaskData {
    */
   IndexMask slice(IndexRange range) const;
   IndexMask slice(int64_t start, int64_t size) const;
+  /**
+   * Get the part of the mask with the indices that are within the given range. Takes O(log n)
+   * time and reuses the memory from the source mask.
+   */
+  IndexMask slice_content(IndexRange range) const;
   /**
    * Same as above but can also add an offset to every index in the mask.
    * Takes O(log n + range.size()) time but with a very small constant factor.
@@ -220,6 +220,13 @@ float BLI_bvhtree_get_epsilon(const BVHTree *tree);
  * This function returns the bounding box of the BVH tree.
  */
 void BLI_bvhtree_get_bounding_box(const BVHTree *tree, float r_bb_min[3], float r_bb_max[3]);
+/**
+ * Surface area heuristic cost of the tree: the sum of the surface areas of all branch nodes,
+ * relative to the area of the root. Useful to detect when updating the tree with
+ * #BLI_bvhtree_update_tree made it much less efficient than rebuilding it would.
+ * Returns zero for trees without a root or with a degenerate root.
+ */
+float BLI_bvhtree_get_sah_cost(const BVHTree *tree);
 
 /**
  * Find nearest node to the given coordinates
@@ -41,6 +41,33 @@ int BLI_kdtree_nd_(find_nearest_n)(const KDTree *tree,
                                    KDTreeNearest *r_nearest,
                                    uint nearest_len_capacity) ATTR_NONNULL(1, 2, 3);
 
+/**
+ * Find the nearest point for every coordinate, using multiple threads.
+ *
+ * \param r_indices: Optional, the index of the nearest point for every coordinate,
+ * -1 when the tree is empty.
+ * \param r_nearest: Optional, the nearest point for every coordinate.
+ */
+void BLI_kdtree_nd_(find_nearest_batch)(const KDTree *tree,
+                                        const float (*co)[KD_DIMS],
+                                        uint co_len,
+                                        int *r_indices,
+                                        KDTreeNearest *r_nearest) ATTR_NONNULL(1, 2);
+
+/**
+ * Find the \a nearest_len_capacity nearest points for every coordinate, using multiple threads.
+ *
+ * \param r_nearest: The nearest points of coordinate `i` are written to the
+ * `nearest_len_capacity` elements starting at `i * nearest_len_capacity`.
+ * \param r_nearest_len: Optional, the number of points found for every coordinate.
+ */
+void BLI_kdtree_nd_(find_nearest_n_batch)(const KDTree *tree,
+                                          const float (*co)[KD_DIMS],
+                                          uint co_len,
+                                          KDTreeNearest *r_nearest,
+                                          uint nearest_len_capacity,
+                                          int *r_nearest_len) ATTR_NONNULL(1, 2, 4);
+
 int BLI_kdtree_nd_(range_search)(const KDTree *tree,
                                  const float co[KD_DIMS],
                                  KDTreeNearest **r_nearest,
@@ -12,6 +12,7 @@
 #include "BLI_math_matrix_types.hh"
 #include "BLI_math_rotation_types.hh"
 #include "BLI_math_vector.hh"
+#include "BLI_span.hh"
 
 namespace blender::math {
 
@@ -368,6 +369,13 @@ template<typename T>
 [[nodiscard]] VecBase<T, 3> transform_point(const MatBase<T, 4, 4> &mat,
                                             const VecBase<T, 3> &point);
 
+/**
+ * Transform an array of 3d points using a 4x4 matrix, in place or from \a src into \a dst.
+ * Large arrays are processed on multiple threads.
+ */
+void transform_points(const float4x4 &transform, MutableSpan<float3> points);
+void transform_points(Span<float3> src, const float4x4 &transform, MutableSpan<float3> dst);
+
 /**
  * Transform a 3d direction vector using a 3x3 matrix (rotation & scale).
  */
@@ -23,7 +23,10 @@ typedef struct BLI_mmap_file BLI_mmap_file;
 
 /* Prepares an opened file for memory-mapped IO.
  * May return NULL if the operation fails.
- * Note that this seeks to the end of the file to determine its length. */
+ * Note that this seeks to the end of the file to determine its length.
+ *
+ * On POSIX systems the mapping is private and writable: writing to it only creates copies of
+ * the affected pages (copy-on-write) and never modifies the file itself. */
 BLI_mmap_file *BLI_mmap_open(int fd) ATTR_MALLOC ATTR_WARN_UNUSED_RESULT;
 
 /* Reads length bytes from file at the given offset into dest.
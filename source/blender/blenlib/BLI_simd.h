@@ -30,3 +30,16 @@
 #else
 #  define BLI_HAVE_SSE2 0
 #endif
+
+/* Compile single functions for AVX2, for kernels that are selected at runtime with
+ * #BLI_cpu_support_avx2. The rest of Blender is built for the baseline instruction set. FMA is
+ * not enabled, the compiler could contract operations and change results between CPUs. Only
+ * supported by GCC and Clang on x86_64. */
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__)) && !defined(__ARM_NEON)
+#  include <immintrin.h>
+#  define BLI_HAVE_TARGET_AVX2 1
+#  define BLI_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#  define BLI_HAVE_TARGET_AVX2 0
+#  define BLI_TARGET_AVX2
+#endif
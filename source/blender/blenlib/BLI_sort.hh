@@ -14,6 +14,8 @@
 #  include <algorithm>
 #endif
 
+#include "BLI_span.hh"
+
 namespace blender {
 
 #ifdef WITH_TBB
@@ -31,4 +33,20 @@ void parallel_sort(RandomAccessIterator begin, RandomAccessIterator end, const C
 }
 #endif
 
+/**
+ * Compute the order of the elements when sorted by their keys, i.e. `keys[r_indices[0]]` is the
+ * smallest key afterwards. The sort is stable, equal keys keep their original relative order.
+ *
+ * This uses a least significant digit radix sort, which is faster than comparison based sorting
+ * for large arrays and is done in parallel. It is meant for sorting elements by computed keys,
+ * e.g. for spatial reordering of points along a space-filling curve.
+ *
+ * \note Negative floats are sorted before positive floats and negative zero before positive zero.
+ * NaN values are sorted to the end (or beginning, depending on their sign bit).
+ */
+void radix_sort_indices(Span<uint32_t> keys, MutableSpan<int> r_indices);
+void radix_sort_indices(Span<uint64_t> keys, MutableSpan<int> r_indices);
+void radix_sort_indices(Span<int> keys, MutableSpan<int> r_indices);
+void radix_sort_indices(Span<float> keys, MutableSpan<int> r_indices);
+
 }  // namespace blender
@@ -16,6 +16,11 @@ extern "C" {
 
 int BLI_cpu_support_sse2(void);
 int BLI_cpu_support_sse41(void);
+/**
+ * Check whether AVX2 and FMA instructions can be used, which requires support from both the CPU
+ * and the operating system. Always false on other architectures than x86_64.
+ */
+int BLI_cpu_support_avx2(void);
 void BLI_system_backtrace(FILE *fp);
 
 /** Get CPU brand, result is to be MEM_freeN()-ed. */
@@ -1071,6 +1071,37 @@ void BLI_bvhtree_get_bounding_box(const BVHTree *tree, float r_bb_min[3], float
   }
 }
 
+/**
+ * Surface area of the box spanned by the first three axes of the tree, which are the
+ * coordinate axes for all K-DOP types except 18.
+ */
+static float node_surface_area(const BVHTree *tree, const BVHNode *node)
+{
+  float extent[3];
+  for (axis_t i = 0; i < 3; i++) {
+    const axis_t axis = (axis_t)(tree->start_axis + i);
+    extent[i] = max_ff(node->bv[2 * axis + 1] - node->bv[2 * axis], 0.0f);
+  }
+  return extent[0] * extent[1] + extent[1] * extent[2] + extent[2] * extent[0];
+}
+
+float BLI_bvhtree_get_sah_cost(const BVHTree *tree)
+{
+  const BVHNode *root = tree->nodes[tree->leaf_num];
+  if (root == NULL) {
+    return 0.0f;
+  }
+  const float root_area = node_surface_area(tree, root);
+  if (!(root_area > 0.0f)) {
+    return 0.0f;
+  }
+  float area_sum = 0.0f;
+  for (int i = 0; i < tree->branch_num; i++) {
+    area_sum += node_surface_area(tree, tree->nodes[tree->leaf_num + i]);
+  }
+  return area_sum / root_area;
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
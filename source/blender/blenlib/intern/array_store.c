@@ -94,6 +94,7 @@
 
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
+#include "BLI_task.h"
 
 #include "BLI_strict_flags.h"
 
@@ -826,6 +827,60 @@ static void hash_array_from_data(const BArrayInfo *info,
   }
 }
 
+/**
+ * Number of elements hashed by each task of #hash_array_from_data_parallel,
+ * arrays with less elements are hashed on the calling thread.
+ */
+#  define BCHUNK_HASH_ARRAY_PARALLEL_BLOCK_LEN 16384
+
+typedef struct HashArrayFromDataTaskData {
+  const BArrayInfo *info;
+  const uchar *data_slice;
+  size_t data_slice_len;
+  hash_key *hash_array;
+} HashArrayFromDataTaskData;
+
+static void hash_array_from_data_task(void *__restrict userdata,
+                                      const int block_index,
+                                      const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const HashArrayFromDataTaskData *data = userdata;
+  const size_t i_start = (size_t)block_index * BCHUNK_HASH_ARRAY_PARALLEL_BLOCK_LEN;
+  const size_t data_start = i_start * data->info->chunk_stride;
+  const size_t data_len = MIN2(BCHUNK_HASH_ARRAY_PARALLEL_BLOCK_LEN * data->info->chunk_stride,
+                               data->data_slice_len - data_start);
+  hash_array_from_data(
+      data->info, &data->data_slice[data_start], data_len, &data->hash_array[i_start]);
+}
+
+/**
+ * Same as #hash_array_from_data, hashing large arrays on multiple threads.
+ * Each element is hashed independently, so this gives the same result.
+ */
+static void hash_array_from_data_parallel(const BArrayInfo *info,
+                                          const uchar *data_slice,
+                                          const size_t data_slice_len,
+                                          hash_key *hash_array)
+{
+  const size_t hash_array_len = data_slice_len / info->chunk_stride;
+  if (hash_array_len < BCHUNK_HASH_ARRAY_PARALLEL_BLOCK_LEN * 2) {
+    hash_array_from_data(info, data_slice, data_slice_len, hash_array);
+    return;
+  }
+
+  HashArrayFromDataTaskData data = {
+      .info = info,
+      .data_slice = data_slice,
+      .data_slice_len = data_slice_len,
+      .hash_array = hash_array,
+  };
+  const int blocks_num = (int)((hash_array_len + BCHUNK_HASH_ARRAY_PARALLEL_BLOCK_LEN - 1) /
+                               BCHUNK_HASH_ARRAY_PARALLEL_BLOCK_LEN);
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  BLI_task_parallel_range(0, blocks_num, &data, hash_array_from_data_task, &settings);
+}
+
 /**
  * Similar to hash_array_from_data,
  * but able to step into the next chunk if we run-out of data.
@@ -1256,7 +1311,7 @@ static BChunkList *bchunk_list_from_data_merge(const BArrayInfo *info,
     const size_t table_hash_array_len = (data_len - i_prev) / info->chunk_stride;
     hash_key *table_hash_array = MEM_mallocN(sizeof(*table_hash_array) * table_hash_array_len,
                                              __func__);
-    hash_array_from_data(info, &data[i_prev], data_len - i_prev, table_hash_array);
+    hash_array_from_data_parallel(info, &data[i_prev], data_len - i_prev, table_hash_array);
 
     hash_accum(table_hash_array, table_hash_array_len, info->accum_steps);
 #else
@@ -110,13 +110,8 @@ static void memory_close_mmap(FileReader *reader)
   MEM_freeN(mem);
 }
 
-FileReader *BLI_filereader_new_mmap(int filedes)
+static FileReader *memory_reader_new_mmap(BLI_mmap_file *mmap, const bool owns_mmap)
 {
-  BLI_mmap_file *mmap = BLI_mmap_open(filedes);
-  if (mmap == NULL) {
-    return NULL;
-  }
-
   MemoryReader *mem = MEM_callocN(sizeof(MemoryReader), __func__);
 
   mem->mmap = mmap;
@@ -124,7 +119,21 @@ FileReader *BLI_filereader_new_mmap(int filedes)
 
   mem->reader.read = memory_read_mmap;
   mem->reader.seek = memory_seek;
-  mem->reader.close = memory_close_mmap;
+  mem->reader.close = owns_mmap ? memory_close_mmap : memory_close_raw;
 
   return (FileReader *)mem;
 }
+
+FileReader *BLI_filereader_new_mmap(int filedes)
+{
+  BLI_mmap_file *mmap = BLI_mmap_open(filedes);
+  if (mmap == NULL) {
+    return NULL;
+  }
+  return memory_reader_new_mmap(mmap, true);
+}
+
+FileReader *BLI_filereader_new_mmap_file(BLI_mmap_file *mmap)
+{
+  return memory_reader_new_mmap(mmap, false);
+}
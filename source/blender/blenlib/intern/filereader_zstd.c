@@ -30,6 +30,13 @@ typedef struct {
     size_t *compressed_ofs;
     size_t *uncompressed_ofs;
 
+    /** Largest frame sizes, used to allocate the buffers below once. */
+    size_t compressed_size_max;
+    size_t uncompressed_size_max;
+
+    /** Reused buffer for reading the compressed frame data. */
+    char *compressed_buf;
+
     char *cached_content;
     int cached_frame;
   } seek;
@@ -113,6 +120,9 @@ static bool zstd_read_seek_table(ZstdReader *zstd)
     }
     zstd->seek.compressed_ofs[i] = compressed_ofs;
     zstd->seek.uncompressed_ofs[i] = uncompressed_ofs;
+    zstd->seek.compressed_size_max = max_zz(zstd->seek.compressed_size_max, compressed_size);
+    zstd->seek.uncompressed_size_max = max_zz(zstd->seek.uncompressed_size_max,
+                                              uncompressed_size);
     compressed_ofs += compressed_size;
     uncompressed_ofs += uncompressed_size;
   }
@@ -155,42 +165,54 @@ static int zstd_frame_from_pos(ZstdReader *zstd, size_t pos)
   return low;
 }
 
-/* Ensure that the currently loaded frame is the correct one. */
-static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
+/* Decompress the given frame into `r_data`, which must be large enough to hold it. */
+static bool zstd_decompress_frame(ZstdReader *zstd, int frame, char *r_data)
 {
-  if (zstd->seek.cached_frame == frame) {
-    /* Cached frame matches, so just return it. */
-    return zstd->seek.cached_content;
-  }
-
-  /* Cached frame doesn't match, so discard it and cache the wanted one instead. */
-  MEM_SAFE_FREE(zstd->seek.cached_content);
-
   size_t compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
   size_t uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
                              zstd->seek.uncompressed_ofs[frame];
 
-  char *uncompressed_data = MEM_mallocN(uncompressed_size, __func__);
-  char *compressed_data = MEM_mallocN(compressed_size, __func__);
+  /* The compressed buffer is shared by all frames to avoid an allocation on every frame switch.
+   */
+  if (zstd->seek.compressed_buf == NULL) {
+    zstd->seek.compressed_buf = MEM_mallocN(zstd->seek.compressed_size_max, __func__);
+  }
+
   if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
-      zstd->base->read(zstd->base, compressed_data, compressed_size) < compressed_size)
+      zstd->base->read(zstd->base, zstd->seek.compressed_buf, compressed_size) < compressed_size)
   {
-    MEM_freeN(compressed_data);
-    MEM_freeN(uncompressed_data);
-    return NULL;
+    return false;
   }
 
   size_t res = ZSTD_decompressDCtx(
-      zstd->ctx, uncompressed_data, uncompressed_size, compressed_data, compressed_size);
-  MEM_freeN(compressed_data);
+      zstd->ctx, r_data, uncompressed_size, zstd->seek.compressed_buf, compressed_size);
   if (ZSTD_isError(res) || res < uncompressed_size) {
-    MEM_freeN(uncompressed_data);
+    return false;
+  }
+  return true;
+}
+
+/* Ensure that the currently loaded frame is the correct one. */
+static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
+{
+  if (zstd->seek.cached_frame == frame) {
+    /* Cached frame matches, so just return it. */
+    return zstd->seek.cached_content;
+  }
+
+  /* Cached frame doesn't match, so replace it with the wanted one,
+   * reusing the buffer since all frames fit in it. */
+  if (zstd->seek.cached_content == NULL) {
+    zstd->seek.cached_content = MEM_mallocN(zstd->seek.uncompressed_size_max, __func__);
+  }
+
+  if (!zstd_decompress_frame(zstd, frame, zstd->seek.cached_content)) {
+    zstd->seek.cached_frame = -1;
     return NULL;
   }
 
   zstd->seek.cached_frame = frame;
-  zstd->seek.cached_content = uncompressed_data;
-  return uncompressed_data;
+  return zstd->seek.cached_content;
 }
 
 static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
@@ -205,6 +227,21 @@ static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
       break;
     }
 
+    size_t frame_start_offset = zstd->seek.uncompressed_ofs[frame];
+    size_t frame_end_offset_full = zstd->seek.uncompressed_ofs[frame + 1];
+    if (frame != zstd->seek.cached_frame && zstd->reader.offset == frame_start_offset &&
+        frame_end_offset_full <= end_offset)
+    {
+      /* The whole frame is requested, decompress it directly into the output buffer
+       * instead of going through the cache (common for large data-blocks). */
+      if (!zstd_decompress_frame(zstd, frame, (char *)buffer + read_len)) {
+        break;
+      }
+      read_len += frame_end_offset_full - frame_start_offset;
+      zstd->reader.offset = frame_end_offset_full;
+      continue;
+    }
+
     const char *framedata = zstd_ensure_cache(zstd, frame);
     if (framedata == NULL) {
       /* Error while reading the frame, so return as much as we can. */
@@ -214,7 +251,7 @@ static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
     size_t frame_end_offset = min_zz(zstd->seek.uncompressed_ofs[frame + 1], end_offset);
     size_t frame_read_len = frame_end_offset - zstd->reader.offset;
 
-    size_t offset_in_frame = zstd->reader.offset - zstd->seek.uncompressed_ofs[frame];
+    size_t offset_in_frame = zstd->reader.offset - frame_start_offset;
     memcpy((char *)buffer + read_len, framedata + offset_in_frame, frame_read_len);
     read_len += frame_read_len;
     zstd->reader.offset = frame_end_offset;
@@ -287,6 +324,9 @@ static void zstd_close(FileReader *reader)
     if (zstd->seek.cached_content) {
       MEM_freeN(zstd->seek.cached_content);
     }
+    if (zstd->seek.compressed_buf) {
+      MEM_freeN(zstd->seek.compressed_buf);
+    }
   }
   else {
     MEM_freeN((void *)zstd->in_buf.src);
@@ -120,6 +120,18 @@ IndexMask IndexMask::slice(const int64_t start, const int64_t size) const
   return sliced;
 }
 
+IndexMask IndexMask::slice_content(const IndexRange range) const
+{
+  if (this->is_empty() || range.is_empty()) {
+    return {};
+  }
+  const int64_t begin = binary_search::find_predicate_begin(
+      this->index_range(), [&](const int64_t i) { return (*this)[i] >= range.start(); });
+  const int64_t end = binary_search::find_predicate_begin(
+      this->index_range(), [&](const int64_t i) { return (*this)[i] >= range.one_after_last(); });
+  return this->slice(begin, end - begin);
+}
+
 IndexMask IndexMask::slice_and_offset(const IndexRange range,
                                       const int64_t offset,
                                       IndexMaskMemory &memory) const
@@ -572,20 +584,6 @@ IndexMask IndexMask::from_bools(const IndexMask &universe,
       universe, GrainSize(512), memory, [&](const int64_t index) { return bools[index]; });
 }
 
-IndexMask IndexMask::from_union(const IndexMask &mask_a,
-                                const IndexMask &mask_b,
-                                IndexMaskMemory &memory)
-
-{
-  const int64_t new_size = math::max(mask_a.min_array_size(), mask_b.min_array_size());
-  Array<bool> tmp(new_size, false);
-  mask_a.foreach_index_optimized<int64_t>(GrainSize(2048),
-                                          [&](const int64_t i) { tmp[i] = true; });
-  mask_b.foreach_index_optimized<int64_t>(GrainSize(2048),
-                                          [&](const int64_t i) { tmp[i] = true; });
-  return IndexMask::from_bools(tmp, memory);
-}
-
 template<typename T> void IndexMask::to_indices(MutableSpan<T> r_indices) const
 {
   BLI_assert(this->size() == r_indices.size());
@@ -701,6 +699,235 @@ IndexMask from_predicate_impl(
 }
 }  // namespace detail
 
+enum class SetOperation {
+  Union,
+  Intersection,
+  Difference,
+};
+
+/**
+ * Add the segments of the mask to #r_segments. Indices that are not statically allocated are
+ * copied, so that the result does not depend on the memory of the source mask.
+ */
+static void copy_segments(const IndexMask &mask,
+                          LinearAllocator<> &allocator,
+                          Vector<IndexMaskSegment, 16> &r_segments)
+{
+  const Span<int16_t> static_indices = get_static_indices_array();
+  mask.foreach_segment([&](const IndexMaskSegment segment) {
+    const Span<int16_t> indices = segment.base_span();
+    if (indices.data() >= static_indices.begin() && indices.data() < static_indices.end()) {
+      r_segments.append(segment);
+    }
+    else {
+      r_segments.append_as(segment.offset(), allocator.construct_array_copy(indices));
+    }
+  });
+}
+
+static void set_bits_in_block(const IndexMask &mask,
+                              const int64_t block_start,
+                              MutableBitSpan r_bits)
+{
+  mask.foreach_range(
+      [&](const IndexRange range) { r_bits.slice(range.shift(-block_start)).set_all(); });
+}
+
+/**
+ * Compute the result of the set operation for indices within a block of #max_segment_size
+ * indices. The parts of the masks are already sliced to the block.
+ */
+static void set_operation_in_block(const SetOperation operation,
+                                   const IndexRange block,
+                                   const IndexMask &mask_a,
+                                   const IndexMask &mask_b,
+                                   LinearAllocator<> &allocator,
+                                   Vector<IndexMaskSegment, 16> &r_segments)
+{
+  const bool a_is_full = mask_a.size() == block.size();
+  const bool b_is_full = mask_b.size() == block.size();
+  const Span<int16_t> static_indices = get_static_indices_array();
+
+  /* Handle the cases in which the result does not depend on the individual indices. */
+  switch (operation) {
+    case SetOperation::Union:
+      if (a_is_full || b_is_full) {
+        r_segments.append_as(block.start(), static_indices.take_front(block.size()));
+        return;
+      }
+      if (mask_a.is_empty() || mask_b.is_empty()) {
+        copy_segments(mask_a.is_empty() ? mask_b : mask_a, allocator, r_segments);
+        return;
+      }
+      break;
+    case SetOperation::Intersection:
+      if (mask_a.is_empty() || mask_b.is_empty()) {
+        return;
+      }
+      if (a_is_full || b_is_full) {
+        copy_segments(a_is_full ? mask_b : mask_a, allocator, r_segments);
+        return;
+      }
+      break;
+    case SetOperation::Difference:
+      if (mask_a.is_empty() || b_is_full) {
+        return;
+      }
+      if (mask_b.is_empty()) {
+        copy_segments(mask_a, allocator, r_segments);
+        return;
+      }
+      break;
+  }
+
+  constexpr size_t ints_num = size_t(max_segment_size / bits::BitsPerInt);
+  std::array<bits::BitInt, ints_num> bits_a{};
+  std::array<bits::BitInt, ints_num> bits_b{};
+  set_bits_in_block(mask_a, block.start(), MutableBitSpan(bits_a.data(), max_segment_size));
+  set_bits_in_block(mask_b, block.start(), MutableBitSpan(bits_b.data(), max_segment_size));
+
+  /* Simple loops over the integers that are vectorized by the compiler. */
+  switch (operation) {
+    case SetOperation::Union:
+      for (size_t i = 0; i < ints_num; i++) {
+        bits_a[i] |= bits_b[i];
+      }
+      break;
+    case SetOperation::Intersection:
+      for (size_t i = 0; i < ints_num; i++) {
+        bits_a[i] &= bits_b[i];
+      }
+      break;
+    case SetOperation::Difference:
+      for (size_t i = 0; i < ints_num; i++) {
+        bits_a[i] &= ~bits_b[i];
+      }
+      break;
+  }
+
+  const IndexMaskSegment block_segment(block.start(), static_indices.take_front(block.size()));
+  detail::segments_from_predicate_filter(
+      block_segment,
+      allocator,
+      [&](const IndexMaskSegment /*universe_segment*/, int16_t *r_true_indices) {
+        int64_t true_indices_num = 0;
+        for (size_t int_i = 0; int_i < ints_num; int_i++) {
+          bits::BitInt value = bits_a[int_i];
+          while (value != 0) {
+            const int64_t bit_i = int64_t(bitscan_forward_uint64(value));
+            r_true_indices[true_indices_num++] = int16_t(int64_t(int_i) * bits::BitsPerInt +
+                                                         bit_i);
+            value &= value - 1;
+          }
+        }
+        return true_indices_num;
+      },
+      r_segments);
+}
+
+static IndexRange range_from_first_last(const int64_t first, const int64_t last)
+{
+  return IndexRange(first, last - first + 1);
+}
+
+static IndexRange mask_bounds(const IndexMask &mask)
+{
+  return mask.is_empty() ? IndexRange() : range_from_first_last(mask.first(), mask.last());
+}
+
+static IndexMask from_set_operation(const SetOperation operation,
+                                    const IndexMask &mask_a,
+                                    const IndexMask &mask_b,
+                                    IndexMaskMemory &memory)
+{
+  /* Find the range of indices that can be in the result. */
+  std::optional<IndexRange> bounds;
+  switch (operation) {
+    case SetOperation::Union:
+      if (mask_a.is_empty() || mask_b.is_empty()) {
+        bounds = mask_bounds(mask_a.is_empty() ? mask_b : mask_a);
+      }
+      else {
+        bounds = range_from_first_last(std::min(mask_a.first(), mask_b.first()),
+                                       std::max(mask_a.last(), mask_b.last()));
+      }
+      break;
+    case SetOperation::Intersection:
+      if (!mask_a.is_empty() && !mask_b.is_empty()) {
+        const int64_t first = std::max(mask_a.first(), mask_b.first());
+        const int64_t last = std::min(mask_a.last(), mask_b.last());
+        if (first <= last) {
+          bounds = range_from_first_last(first, last);
+        }
+      }
+      break;
+    case SetOperation::Difference:
+      bounds = mask_bounds(mask_a);
+      break;
+  }
+  if (!bounds || bounds->is_empty()) {
+    return {};
+  }
+
+  /* Blocks are aligned to #max_segment_size so that each one can become a single segment. */
+  const int64_t first_block = bounds->first() >> max_segment_size_shift;
+  const int64_t last_block = bounds->last() >> max_segment_size_shift;
+  const IndexRange blocks = range_from_first_last(first_block, last_block);
+  auto process_block = [&](const int64_t block_i,
+                           LinearAllocator<> &allocator,
+                           Vector<IndexMaskSegment, 16> &r_segments) {
+    const IndexRange block = IndexRange(block_i << max_segment_size_shift, max_segment_size)
+                                 .intersect(*bounds);
+    set_operation_in_block(operation,
+                           block,
+                           mask_a.slice_content(block),
+                           mask_b.slice_content(block),
+                           allocator,
+                           r_segments);
+  };
+
+  Vector<IndexMaskSegment, 16> segments;
+  if (blocks.size() <= 4) {
+    for (const int64_t block_i : blocks) {
+      process_block(block_i, memory, segments);
+    }
+  }
+  else {
+    ParallelSegmentsCollector segments_collector;
+    threading::parallel_for(blocks, 4, [&](const IndexRange blocks_range) {
+      ParallelSegmentsCollector::LocalData &data = segments_collector.data_by_thread.local();
+      for (const int64_t block_i : blocks_range) {
+        process_block(block_i, data.allocator, data.segments);
+      }
+    });
+    segments_collector.reduce(memory, segments);
+  }
+
+  consolidate_segments(segments, memory);
+  return mask_from_segments(segments, memory);
+}
+
+IndexMask IndexMask::from_union(const IndexMask &mask_a,
+                                const IndexMask &mask_b,
+                                IndexMaskMemory &memory)
+{
+  return from_set_operation(SetOperation::Union, mask_a, mask_b, memory);
+}
+
+IndexMask IndexMask::from_intersection(const IndexMask &mask_a,
+                                       const IndexMask &mask_b,
+                                       IndexMaskMemory &memory)
+{
+  return from_set_operation(SetOperation::Intersection, mask_a, mask_b, memory);
+}
+
+IndexMask IndexMask::from_difference(const IndexMask &mask_a,
+                                     const IndexMask &mask_b,
+                                     IndexMaskMemory &memory)
+{
+  return from_set_operation(SetOperation::Difference, mask_a, mask_b, memory);
+}
+
 std::optional<RawMaskIterator> IndexMask::find(const int64_t query_index) const
 {
   if (this->is_empty()) {
@@ -10,6 +10,7 @@
 
 #include "BLI_kdtree_impl.h"
 #include "BLI_math_base.h"
+#include "BLI_task.h"
 #include "BLI_strict_flags.h"
 #include "BLI_utildefines.h"
 
@@ -138,19 +139,15 @@ void BLI_kdtree_nd_(insert)(KDTree *tree, int index, const float co[KD_DIMS])
 #endif
 }
 
-static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+/**
+ * Partially sort the nodes so that the median along the axis is in the middle,
+ * with smaller values before and larger values after it. Returns the median index.
+ */
+static uint kdtree_balance_partition(KDTreeNode *nodes, const uint nodes_len, const uint axis)
 {
-  KDTreeNode *node;
   float co;
   uint left, right, median, i, j;
 
-  if (nodes_len <= 0) {
-    return KD_NODE_UNSET;
-  }
-  else if (nodes_len == 1) {
-    return 0 + ofs;
-  }
-
   /* Quick-sort style sorting around median. */
   left = 0;
   right = nodes_len - 1;
@@ -183,6 +180,37 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
     }
   }
 
+  return median;
+}
+
+/**
+ * The index of the root node of a balanced sub-tree, known before it is balanced.
+ */
+static uint kdtree_balance_root(const uint nodes_len, const uint ofs)
+{
+  if (nodes_len == 0) {
+    return KD_NODE_UNSET;
+  }
+  if (nodes_len == 1) {
+    return ofs;
+  }
+  return nodes_len / 2 + ofs;
+}
+
+static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+{
+  KDTreeNode *node;
+  uint median;
+
+  if (nodes_len <= 0) {
+    return KD_NODE_UNSET;
+  }
+  else if (nodes_len == 1) {
+    return 0 + ofs;
+  }
+
+  median = kdtree_balance_partition(nodes, nodes_len, axis);
+
   /* Set node and sort sub-nodes. */
   node = &nodes[median];
   node->d = axis;
@@ -194,6 +222,62 @@ static uint kdtree_balance(KDTreeNode *nodes, uint nodes_len, uint axis, const u
   return median + ofs;
 }
 
+/**
+ * Sub-trees smaller than this are balanced on a single thread.
+ */
+#define KD_BALANCE_PARALLEL_THRESHOLD 8192
+
+typedef struct KDTreeBalanceTask {
+  KDTreeNode *nodes;
+  uint nodes_len;
+  uint axis;
+  uint ofs;
+} KDTreeBalanceTask;
+
+static void kdtree_balance_parallel_recursive(
+    TaskPool *pool, KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs);
+
+static void kdtree_balance_task_run(TaskPool *__restrict pool, void *taskdata)
+{
+  const KDTreeBalanceTask *task = (const KDTreeBalanceTask *)taskdata;
+  kdtree_balance_parallel_recursive(pool, task->nodes, task->nodes_len, task->axis, task->ofs);
+}
+
+/**
+ * Same as #kdtree_balance, but the right side of large sub-trees is balanced in a separate task.
+ * This works because the sub-trees are independent and the index of their root is known
+ * in advance.
+ */
+static void kdtree_balance_parallel_recursive(
+    TaskPool *pool, KDTreeNode *nodes, uint nodes_len, uint axis, const uint ofs)
+{
+  KDTreeNode *node;
+  KDTreeBalanceTask *task;
+  uint median;
+
+  if (nodes_len < KD_BALANCE_PARALLEL_THRESHOLD) {
+    kdtree_balance(nodes, nodes_len, axis, ofs);
+    return;
+  }
+
+  median = kdtree_balance_partition(nodes, nodes_len, axis);
+
+  node = &nodes[median];
+  node->d = axis;
+  axis = (axis + 1) % KD_DIMS;
+  node->left = kdtree_balance_root(median, ofs);
+  node->right = kdtree_balance_root(nodes_len - (median + 1), (median + 1) + ofs);
+
+  task = MEM_mallocN(sizeof(*task), __func__);
+  task->nodes = nodes + median + 1;
+  task->nodes_len = nodes_len - (median + 1);
+  task->axis = axis;
+  task->ofs = (median + 1) + ofs;
+  BLI_task_pool_push(pool, kdtree_balance_task_run, task, true, NULL);
+
+  kdtree_balance_parallel_recursive(pool, nodes, median, axis, ofs);
+}
+
 void BLI_kdtree_nd_(balance)(KDTree *tree)
 {
   if (tree->root != KD_NODE_ROOT_IS_INIT) {
@@ -203,7 +287,16 @@ void BLI_kdtree_nd_(balance)(KDTree *tree)
     }
   }
 
-  tree->root = kdtree_balance(tree->nodes, tree->nodes_len, 0, 0);
+  if (tree->nodes_len < KD_BALANCE_PARALLEL_THRESHOLD) {
+    tree->root = kdtree_balance(tree->nodes, tree->nodes_len, 0, 0);
+  }
+  else {
+    TaskPool *pool = BLI_task_pool_create(NULL, TASK_PRIORITY_HIGH);
+    kdtree_balance_parallel_recursive(pool, tree->nodes, tree->nodes_len, 0, 0);
+    BLI_task_pool_work_and_wait(pool);
+    BLI_task_pool_free(pool);
+    tree->root = kdtree_balance_root(tree->nodes_len, 0);
+  }
 
 #ifdef DEBUG
   tree->is_balanced = true;
@@ -593,6 +686,88 @@ int BLI_kdtree_nd_(find_nearest_n)(const KDTree *tree,
       tree, co, r_nearest, nearest_len_capacity, NULL, NULL);
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Batched Queries
+ * \{ */
+
+typedef struct KDTreeBatchQueryData {
+  const KDTree *tree;
+  const float (*co)[KD_DIMS];
+  uint nearest_len_capacity;
+  KDTreeNearest *r_nearest;
+  int *r_indices;
+  int *r_nearest_len;
+} KDTreeBatchQueryData;
+
+static void kdtree_find_nearest_batch_fn(void *__restrict userdata,
+                                         const int i,
+                                         const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const KDTreeBatchQueryData *data = (const KDTreeBatchQueryData *)userdata;
+  const int index = BLI_kdtree_nd_(find_nearest)(
+      data->tree, data->co[i], data->r_nearest ? &data->r_nearest[i] : NULL);
+  if (data->r_indices) {
+    data->r_indices[i] = index;
+  }
+}
+
+static void kdtree_find_nearest_n_batch_fn(void *__restrict userdata,
+                                           const int i,
+                                           const TaskParallelTLS *__restrict UNUSED(tls))
+{
+  const KDTreeBatchQueryData *data = (const KDTreeBatchQueryData *)userdata;
+  const int nearest_len = BLI_kdtree_nd_(find_nearest_n)(
+      data->tree,
+      data->co[i],
+      &data->r_nearest[(size_t)i * data->nearest_len_capacity],
+      data->nearest_len_capacity);
+  if (data->r_nearest_len) {
+    data->r_nearest_len[i] = nearest_len;
+  }
+}
+
+static void kdtree_batch_query(const uint co_len,
+                               KDTreeBatchQueryData *data,
+                               TaskParallelRangeFunc func)
+{
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.min_iter_per_thread = 256;
+  BLI_task_parallel_range(0, (int)co_len, data, func, &settings);
+}
+
+void BLI_kdtree_nd_(find_nearest_batch)(const KDTree *tree,
+                                        const float (*co)[KD_DIMS],
+                                        const uint co_len,
+                                        int *r_indices,
+                                        KDTreeNearest *r_nearest)
+{
+  KDTreeBatchQueryData data = {NULL};
+  data.tree = tree;
+  data.co = co;
+  data.r_indices = r_indices;
+  data.r_nearest = r_nearest;
+  kdtree_batch_query(co_len, &data, kdtree_find_nearest_batch_fn);
+}
+
+void BLI_kdtree_nd_(find_nearest_n_batch)(const KDTree *tree,
+                                          const float (*co)[KD_DIMS],
+                                          const uint co_len,
+                                          KDTreeNearest *r_nearest,
+                                          const uint nearest_len_capacity,
+                                          int *r_nearest_len)
+{
+  KDTreeBatchQueryData data = {NULL};
+  data.tree = tree;
+  data.co = co;
+  data.nearest_len_capacity = nearest_len_capacity;
+  data.r_nearest = r_nearest;
+  data.r_nearest_len = r_nearest_len;
+  kdtree_batch_query(co_len, &data, kdtree_find_nearest_n_batch_fn);
+}
+
+/** \} */
+
 static int nearest_cmp_dist(const void *a, const void *b)
 {
   const KDTreeNearest *kda = a;
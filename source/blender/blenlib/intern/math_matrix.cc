@@ -10,6 +10,8 @@
 
 #include "BLI_math_rotation.hh"
 #include "BLI_simd.h"
+#include "BLI_system.h"
+#include "BLI_task.hh"
 
 #include <Eigen/Core>
 #include <Eigen/Dense>
@@ -458,6 +460,97 @@ Quaternion to_quaternion_legacy(const float3x3 &mat)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Point Array Transform
+ * \{ */
+
+static void transform_points_impl(const Span<float3> src,
+                                  const float4x4 &transform,
+                                  MutableSpan<float3> dst)
+{
+#if BLI_HAVE_SSE2
+  const __m128 col0 = _mm_loadu_ps(transform[0]);
+  const __m128 col1 = _mm_loadu_ps(transform[1]);
+  const __m128 col2 = _mm_loadu_ps(transform[2]);
+  const __m128 col3 = _mm_loadu_ps(transform[3]);
+  for (const int64_t i : src.index_range()) {
+    const float3 &point = src[i];
+    const __m128 result = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(point.x), col0), _mm_mul_ps(_mm_set1_ps(point.y), col1)),
+        _mm_add_ps(_mm_mul_ps(_mm_set1_ps(point.z), col2), col3));
+    /* Store through a temporary, writing four floats could overwrite the next point when
+     * transforming in place. */
+    float4 result_v;
+    _mm_storeu_ps(result_v, result);
+    dst[i] = result_v.xyz();
+  }
+#else
+  for (const int64_t i : src.index_range()) {
+    dst[i] = transform_point(transform, src[i]);
+  }
+#endif
+}
+
+#if BLI_HAVE_TARGET_AVX2
+/**
+ * Same as #transform_points_impl, transforming two points at once with 256 bit registers. The
+ * operations are done in the same order and without fused multiply-add, so that the result does
+ * not depend on the CPU.
+ */
+BLI_TARGET_AVX2 static void transform_points_impl_avx2(const Span<float3> src,
+                                                       const float4x4 &transform,
+                                                       MutableSpan<float3> dst)
+{
+  const __m256 col0 = _mm256_set_m128(_mm_loadu_ps(transform[0]), _mm_loadu_ps(transform[0]));
+  const __m256 col1 = _mm256_set_m128(_mm_loadu_ps(transform[1]), _mm_loadu_ps(transform[1]));
+  const __m256 col2 = _mm256_set_m128(_mm_loadu_ps(transform[2]), _mm_loadu_ps(transform[2]));
+  const __m256 col3 = _mm256_set_m128(_mm_loadu_ps(transform[3]), _mm_loadu_ps(transform[3]));
+  const int64_t pairs_num = src.size() / 2;
+  for (const int64_t pair : IndexRange(pairs_num)) {
+    const float3 &a = src[pair * 2];
+    const float3 &b = src[pair * 2 + 1];
+    const __m256 x = _mm256_set_m128(_mm_set1_ps(b.x), _mm_set1_ps(a.x));
+    const __m256 y = _mm256_set_m128(_mm_set1_ps(b.y), _mm_set1_ps(a.y));
+    const __m256 z = _mm256_set_m128(_mm_set1_ps(b.z), _mm_set1_ps(a.z));
+    const __m256 result = _mm256_add_ps(
+        _mm256_add_ps(_mm256_mul_ps(x, col0), _mm256_mul_ps(y, col1)),
+        _mm256_add_ps(_mm256_mul_ps(z, col2), col3));
+    /* Store through a temporary, see #transform_points_impl. */
+    float result_v[8];
+    _mm256_storeu_ps(result_v, result);
+    dst[pair * 2] = float3(result_v[0], result_v[1], result_v[2]);
+    dst[pair * 2 + 1] = float3(result_v[4], result_v[5], result_v[6]);
+  }
+  if (src.size() % 2 == 1) {
+    transform_points_impl(src.take_back(1), transform, dst.take_back(1));
+  }
+}
+#endif
+
+void transform_points(const float4x4 &transform, MutableSpan<float3> points)
+{
+  transform_points(points, transform, points);
+}
+
+void transform_points(const Span<float3> src, const float4x4 &transform, MutableSpan<float3> dst)
+{
+  BLI_assert(src.size() == dst.size());
+#if BLI_HAVE_TARGET_AVX2
+  static const bool use_avx2 = BLI_cpu_support_avx2();
+  if (use_avx2) {
+    threading::parallel_for(src.index_range(), 1024, [&](const IndexRange range) {
+      transform_points_impl_avx2(src.slice(range), transform, dst.slice(range));
+    });
+    return;
+  }
+#endif
+  threading::parallel_for(src.index_range(), 1024, [&](const IndexRange range) {
+    transform_points_impl(src.slice(range), transform, dst.slice(range));
+  });
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Template instantiation
  * \{ */
@@ -0,0 +1,149 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <array>
+#include <cstring>
+
+#include "BLI_array.hh"
+#include "BLI_sort.hh"
+#include "BLI_task.hh"
+
+namespace blender {
+
+/* Number of bits sorted in a single pass. */
+static constexpr int radix_bits = 8;
+static constexpr int radix_size = 1 << radix_bits;
+/* Number of elements that are processed by a single task in every pass. */
+static constexpr int64_t radix_chunk_size = 1 << 16;
+
+using DigitCounts = std::array<int64_t, radix_size>;
+
+template<typename UInt> struct KeyIndex {
+  UInt key;
+  int index;
+};
+
+template<typename UInt> static int get_digit(const UInt key, const int shift)
+{
+  return int((key >> shift) & (radix_size - 1));
+}
+
+template<typename UInt, typename GetKeyFn>
+static void radix_sort_indices_impl(const int64_t size,
+                                    const GetKeyFn &get_key,
+                                    MutableSpan<int> r_indices)
+{
+  BLI_assert(r_indices.size() == size);
+  if (size == 0) {
+    return;
+  }
+
+  Array<KeyIndex<UInt>> buffer_a(size, NoInitialization());
+  Array<KeyIndex<UInt>> buffer_b(size, NoInitialization());
+  threading::parallel_for(IndexRange(size), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      buffer_a[i] = {get_key(i), int(i)};
+    }
+  });
+
+  const int64_t chunks_num = (size + radix_chunk_size - 1) / radix_chunk_size;
+  const auto chunk_range = [&](const int64_t chunk) {
+    const int64_t start = chunk * radix_chunk_size;
+    return IndexRange(start, std::min(radix_chunk_size, size - start));
+  };
+  /* Counts for every digit in every chunk, turned into the write offsets of the chunk. */
+  Array<DigitCounts> chunk_offsets(chunks_num);
+
+  MutableSpan<KeyIndex<UInt>> src = buffer_a;
+  MutableSpan<KeyIndex<UInt>> dst = buffer_b;
+  for (int shift = 0; shift < int(sizeof(UInt) * 8); shift += radix_bits) {
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange chunks) {
+      for (const int64_t chunk : chunks) {
+        DigitCounts &counts = chunk_offsets[chunk];
+        counts.fill(0);
+        for (const KeyIndex<UInt> &item : src.slice(chunk_range(chunk))) {
+          counts[get_digit(item.key, shift)]++;
+        }
+      }
+    });
+
+    /* Passes where all keys have the same digit do not change the order. This is common for the
+     * high digits of keys that do not use their full range. */
+    const int first_digit = get_digit(src.first().key, shift);
+    int64_t first_digit_count = 0;
+    for (const DigitCounts &counts : chunk_offsets) {
+      first_digit_count += counts[first_digit];
+    }
+    if (first_digit_count == size) {
+      continue;
+    }
+
+    int64_t offset = 0;
+    for (const int digit : IndexRange(radix_size)) {
+      for (DigitCounts &counts : chunk_offsets) {
+        const int64_t count = counts[digit];
+        counts[digit] = offset;
+        offset += count;
+      }
+    }
+
+    threading::parallel_for(IndexRange(chunks_num), 1, [&](const IndexRange chunks) {
+      for (const int64_t chunk : chunks) {
+        DigitCounts &offsets = chunk_offsets[chunk];
+        for (const KeyIndex<UInt> &item : src.slice(chunk_range(chunk))) {
+          dst[offsets[get_digit(item.key, shift)]++] = item;
+        }
+      }
+    });
+    std::swap(src, dst);
+  }
+
+  threading::parallel_for(IndexRange(size), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      r_indices[i] = src[i].index;
+    }
+  });
+}
+
+void radix_sort_indices(const Span<uint32_t> keys, MutableSpan<int> r_indices)
+{
+  radix_sort_indices_impl<uint32_t>(
+      keys.size(), [&](const int64_t i) { return keys[i]; }, r_indices);
+}
+
+void radix_sort_indices(const Span<uint64_t> keys, MutableSpan<int> r_indices)
+{
+  radix_sort_indices_impl<uint64_t>(
+      keys.size(), [&](const int64_t i) { return keys[i]; }, r_indices);
+}
+
+void radix_sort_indices(const Span<int> keys, MutableSpan<int> r_indices)
+{
+  /* Flipping the sign bit orders negative values before positive values. */
+  radix_sort_indices_impl<uint32_t>(
+      keys.size(),
+      [&](const int64_t i) { return uint32_t(keys[i]) ^ (uint32_t(1) << 31); },
+      r_indices);
+}
+
+void radix_sort_indices(const Span<float> keys, MutableSpan<int> r_indices)
+{
+  /* Map the floats to integers with the same order. For positive values it's enough to set the
+   * sign bit, negative values have all bits flipped, because a larger magnitude means a smaller
+   * value. */
+  radix_sort_indices_impl<uint32_t>(
+      keys.size(),
+      [&](const int64_t i) {
+        uint32_t bits;
+        memcpy(&bits, &keys[i], sizeof(bits));
+        return (bits & (uint32_t(1) << 31)) ? ~bits : bits | (uint32_t(1) << 31);
+      },
+      r_indices);
+}
+
+}  // namespace blender
@@ -157,6 +157,67 @@ int BLI_cpu_support_sse41(void)
   return 0;
 }
 
+/* Detection of AVX instruction sets. Besides the CPU, the operating system has to support saving
+ * the wider registers, which is checked with the `XCR0` register. Only done on x86_64, these
+ * instruction sets are not available on 32 bit builds. */
+#if defined(__x86_64__) || defined(_M_X64)
+static void cpuid_count(int data[4], const int leaf, const int subleaf)
+{
+#  if defined(_MSC_VER)
+  __cpuidex(data, leaf, subleaf);
+#  else
+  asm("cpuid"
+      : "=a"(data[0]), "=b"(data[1]), "=c"(data[2]), "=d"(data[3])
+      : "a"(leaf), "c"(subleaf));
+#  endif
+}
+
+static uint64_t xgetbv_xcr0(void)
+{
+#  if defined(_MSC_VER)
+  return _xgetbv(0);
+#  else
+  uint eax, edx;
+  asm("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+  return ((uint64_t)edx << 32) | eax;
+#  endif
+}
+
+/**
+ * \param xcr0_mask: Register state the operating system has to save for the instruction set.
+ * \param ebx_mask: Bits of the extended features (leaf 7) that have to be supported.
+ */
+static int cpu_support_avx_impl(const uint64_t xcr0_mask, const uint ebx_mask)
+{
+  int result[4];
+  cpuid_count(result, 0, 0);
+  if (result[0] < 7) {
+    return 0;
+  }
+  cpuid_count(result, 1, 0);
+  /* OSXSAVE (bit 27), AVX (bit 28) and FMA (bit 12). */
+  const uint ecx_mask = (1u << 27) | (1u << 28) | (1u << 12);
+  if (((uint)result[2] & ecx_mask) != ecx_mask) {
+    return 0;
+  }
+  if ((xgetbv_xcr0() & xcr0_mask) != xcr0_mask) {
+    return 0;
+  }
+  cpuid_count(result, 7, 0);
+  return ((uint)result[1] & ebx_mask) == ebx_mask;
+}
+#endif
+
+int BLI_cpu_support_avx2(void)
+{
+#if defined(__x86_64__) || defined(_M_X64)
+  /* XMM and YMM state, AVX2 (bit 5). */
+  return cpu_support_avx_impl(0x6, 1u << 5);
+#else
+  return 0;
+#endif
+}
+
 void BLI_hostname_get(char *buffer, size_t bufsize)
 {
 #ifndef WIN32
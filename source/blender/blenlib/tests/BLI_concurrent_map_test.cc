@@ -0,0 +1,92 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "BLI_concurrent_map.hh"
+#include "BLI_task.hh"
+
+#include "testing/testing.h"
+
+namespace blender::tests {
+
+TEST(concurrent_map, DefaultConstructor)
+{
+  ConcurrentMap<int, float> map;
+  EXPECT_EQ(map.size(), 0);
+  EXPECT_TRUE(map.is_empty());
+}
+
+TEST(concurrent_map, AddAndLookup)
+{
+  ConcurrentMap<int, float> map;
+  {
+    ConcurrentMap<int, float>::MutableAccessor accessor;
+    EXPECT_TRUE(map.add(accessor, 3));
+    accessor->second = 5.0f;
+  }
+  {
+    ConcurrentMap<int, float>::MutableAccessor accessor;
+    EXPECT_FALSE(map.add(accessor, 3));
+    EXPECT_EQ(accessor->second, 5.0f);
+  }
+  {
+    ConcurrentMap<int, float>::ConstAccessor accessor;
+    EXPECT_TRUE(map.lookup(accessor, 3));
+    EXPECT_EQ(accessor->first, 3);
+    EXPECT_EQ(accessor->second, 5.0f);
+  }
+  {
+    ConcurrentMap<int, float>::ConstAccessor accessor;
+    EXPECT_FALSE(map.lookup(accessor, 4));
+  }
+  EXPECT_EQ(map.size(), 1);
+}
+
+TEST(concurrent_map, ReuseAccessor)
+{
+  ConcurrentMap<int, int> map;
+  ConcurrentMap<int, int>::MutableAccessor accessor;
+  EXPECT_TRUE(map.add(accessor, 1));
+  accessor->second = 10;
+  /* The previous element is released before the next one is accessed. */
+  EXPECT_TRUE(map.add(accessor, 2));
+  accessor->second = 20;
+  EXPECT_TRUE(map.lookup(accessor, 1));
+  EXPECT_EQ(accessor->second, 10);
+  accessor.release();
+  EXPECT_EQ(map.size(), 2);
+}
+
+TEST(concurrent_map, Remove)
+{
+  ConcurrentMap<int, int> map;
+  {
+    ConcurrentMap<int, int>::MutableAccessor accessor;
+    map.add(accessor, 1);
+  }
+  EXPECT_FALSE(map.remove(2));
+  EXPECT_TRUE(map.remove(1));
+  EXPECT_TRUE(map.is_empty());
+}
+
+TEST(concurrent_map, ParallelAdd)
+{
+  ConcurrentMap<int, int> map;
+  threading::parallel_for(IndexRange(10000), 64, [&](const IndexRange range) {
+    for (const int i : range) {
+      ConcurrentMap<int, int>::MutableAccessor accessor;
+      map.add(accessor, i % 100);
+      accessor->second++;
+    }
+  });
+  EXPECT_EQ(map.size(), 100);
+  int total = 0;
+  map.foreach_item([&](const int key, const int value) {
+    EXPECT_EQ(value, 100);
+    EXPECT_TRUE(key >= 0 && key < 100);
+    total += value;
+  });
+  EXPECT_EQ(total, 10000);
+}
+
+}  // namespace blender::tests
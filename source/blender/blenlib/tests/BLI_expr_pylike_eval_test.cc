@@ -184,6 +184,28 @@ TEST_CONST(Smoothstep4, "smoothstep(-10,10,20)", 1.0)
 TEST_CONST(Smoothstep5, "smoothstep(-10,10,-5)", 0.15625)
 TEST_EVAL(Smoothstep1, "smoothstep(-10,10,x)", 5, 0.84375)
 
+TEST_CONST(E, "e", M_E)
+TEST_CONST(Tau, "tau", 2.0 * M_PI)
+
+TEST_CONST(Float, "float(1.5)", 1.5)
+TEST_CONST(Bool1, "bool(-2)", TRUE_VAL)
+TEST_CONST(Bool2, "bool(0)", FALSE_VAL)
+
+TEST_CONST(Log2_2, "log2(8)", 3.0)
+TEST_CONST(Log10, "log10(100)", 2.0)
+TEST_EVAL(Log10, "log10(x)", 1000.0, 3.0)
+
+TEST_CONST(Hypot, "hypot(3, 4)", 5.0)
+TEST_EVAL(Hypot, "hypot(x, 4)", 3.0, 5.0)
+TEST_CONST(CopySign, "copysign(2, -0.5)", -2.0)
+
+TEST_CONST(Sinh, "sinh(0)", 0.0)
+TEST_CONST(Cosh, "cosh(0)", 1.0)
+TEST_CONST(Tanh, "tanh(0)", 0.0)
+TEST_CONST(Asinh, "asinh(0)", 0.0)
+TEST_CONST(Acosh, "acosh(1)", 0.0)
+TEST_CONST(Atanh, "atanh(0)", 0.0)
+
 TEST_RESULT(Min1, "min(3,1,2)", 1.0)
 TEST_RESULT(Max1, "max(3,1,2)", 3.0)
 TEST_RESULT(Min2, "min(1,2,3)", 1.0)
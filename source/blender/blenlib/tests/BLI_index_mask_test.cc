@@ -100,6 +100,138 @@ TEST(index_mask, FromUnion)
   }
 }
 
+TEST(index_mask, FromIntersection)
+{
+  IndexMaskMemory memory;
+  Array<int> data_a = {1, 2, 5, 20000, 20001};
+  IndexMask mask_a = IndexMask::from_indices<int>(data_a, memory);
+  IndexMask mask_b(IndexRange(2, 19999));
+
+  IndexMask mask_intersection = IndexMask::from_intersection(mask_a, mask_b, memory);
+
+  EXPECT_EQ(mask_intersection.size(), 3);
+  EXPECT_EQ(mask_intersection[0], 2);
+  EXPECT_EQ(mask_intersection[1], 5);
+  EXPECT_EQ(mask_intersection[2], 20000);
+
+  EXPECT_TRUE(IndexMask::from_intersection(mask_a, IndexRange(6, 100), memory).is_empty());
+  EXPECT_TRUE(IndexMask::from_intersection(mask_a, {}, memory).is_empty());
+}
+
+TEST(index_mask, FromDifference)
+{
+  IndexMaskMemory memory;
+  IndexMask mask_a(IndexRange(40000));
+  Array<int> data_b = {0, 3, 16384, 39999};
+  IndexMask mask_b = IndexMask::from_indices<int>(data_b, memory);
+
+  IndexMask mask_difference = IndexMask::from_difference(mask_a, mask_b, memory);
+
+  EXPECT_EQ(mask_difference.size(), 40000 - 4);
+  EXPECT_EQ(mask_difference.first(), 1);
+  EXPECT_EQ(mask_difference.last(), 39998);
+  for (const int i : data_b) {
+    EXPECT_FALSE(mask_difference.contains(i));
+  }
+  EXPECT_TRUE(mask_difference.contains(16383));
+  EXPECT_TRUE(mask_difference.contains(16385));
+
+  EXPECT_TRUE(IndexMask::from_difference(mask_b, mask_a, memory).is_empty());
+  EXPECT_EQ(IndexMask::from_difference(mask_b, {}, memory).size(), 4);
+}
+
+TEST(index_mask, SetOperationsFuzzy)
+{
+  RandomNumberGenerator rng;
+
+  const int64_t universe_size = 100000;
+  for ([[maybe_unused]] const int64_t iter : IndexRange(20)) {
+    /* Use different densities and blocks that are fully selected or empty to test all cases. */
+    const int density_a = rng.get_int32(10) + 1;
+    const int density_b = rng.get_int32(10) + 1;
+    const auto in_a = [&](const int64_t i) {
+      return (i / 10000) % 3 == 0 || (i * 7) % density_a == 0;
+    };
+    const auto in_b = [&](const int64_t i) {
+      return (i / 20000) % 2 == 0 && (i * 13) % density_b == 0;
+    };
+
+    IndexMaskMemory memory;
+    const IndexMask mask_a = IndexMask::from_predicate(
+        IndexRange(universe_size), GrainSize(1024), memory, in_a);
+    const IndexMask mask_b = IndexMask::from_predicate(
+        IndexRange(universe_size), GrainSize(1024), memory, in_b);
+
+    const IndexMask mask_union = IndexMask::from_union(mask_a, mask_b, memory);
+    const IndexMask mask_intersection = IndexMask::from_intersection(mask_a, mask_b, memory);
+    const IndexMask mask_difference = IndexMask::from_difference(mask_a, mask_b, memory);
+
+    const IndexMask expected_union = IndexMask::from_predicate(
+        IndexRange(universe_size), GrainSize(1024), memory, [&](const int64_t i) {
+          return in_a(i) || in_b(i);
+        });
+    const IndexMask expected_intersection = IndexMask::from_predicate(
+        IndexRange(universe_size), GrainSize(1024), memory, [&](const int64_t i) {
+          return in_a(i) && in_b(i);
+        });
+    const IndexMask expected_difference = IndexMask::from_predicate(
+        IndexRange(universe_size), GrainSize(1024), memory, [&](const int64_t i) {
+          return in_a(i) && !in_b(i);
+        });
+
+    Array<int> indices(universe_size);
+    Array<int> expected_indices(universe_size);
+    const auto expect_equal = [&](const IndexMask &mask, const IndexMask &expected) {
+      ASSERT_EQ(mask.size(), expected.size());
+      mask.to_indices<int>(indices.as_mutable_span().take_front(mask.size()));
+      expected.to_indices<int>(expected_indices.as_mutable_span().take_front(expected.size()));
+      EXPECT_EQ(indices.as_span().take_front(mask.size()),
+                expected_indices.as_span().take_front(expected.size()));
+    };
+    expect_equal(mask_union, expected_union);
+    expect_equal(mask_intersection, expected_intersection);
+    expect_equal(mask_difference, expected_difference);
+  }
+}
+
+#if 0
+TEST(index_mask, SetOperationsBenchmark)
+{
+  for (const int64_t size : {10'000'000, 100'000'000}) {
+    IndexMaskMemory memory;
+    const IndexMask mask_a = IndexMask::from_predicate(
+        IndexRange(size), GrainSize(4096), memory, [](const int64_t i) { return i % 3 != 0; });
+    const IndexMask mask_b = IndexMask::from_predicate(
+        IndexRange(size), GrainSize(4096), memory, [](const int64_t i) {
+          return (i / 100000) % 2 == 0;
+        });
+    for ([[maybe_unused]] const int64_t i : IndexRange(3)) {
+      {
+        SCOPED_TIMER("union " + std::to_string(size));
+        IndexMask::from_union(mask_a, mask_b, memory);
+      }
+      {
+        SCOPED_TIMER("intersection " + std::to_string(size));
+        IndexMask::from_intersection(mask_a, mask_b, memory);
+      }
+      {
+        SCOPED_TIMER("difference " + std::to_string(size));
+        IndexMask::from_difference(mask_a, mask_b, memory);
+      }
+    }
+  }
+}
+
+/**
+ * Timer 'union 10000000' took 29.07 ms
+ * Timer 'intersection 10000000' took 26.62 ms
+ * Timer 'difference 10000000' took 27.42 ms
+ * Timer 'union 100000000' took 267.33 ms
+ * Timer 'intersection 100000000' took 295.65 ms
+ * Timer 'difference 100000000' took 250.13 ms
+ */
+#endif /* Benchmark */
+
 TEST(index_mask, DefaultConstructor)
 {
   IndexMask mask;
@@ -0,0 +1,115 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "BLI_array.hh"
+#include "BLI_rand.hh"
+#include "BLI_sort.hh"
+#include "BLI_timeit.hh"
+
+namespace blender::tests {
+
+template<typename T> static Array<int> std_stable_sort_indices(const Span<T> keys)
+{
+  Array<int> indices(keys.size());
+  std::iota(indices.begin(), indices.end(), 0);
+  std::stable_sort(
+      indices.begin(), indices.end(), [&](const int a, const int b) { return keys[a] < keys[b]; });
+  return indices;
+}
+
+TEST(sort, RadixSortIndicesEmpty)
+{
+  Array<int> indices;
+  radix_sort_indices(Span<uint32_t>(), indices);
+  EXPECT_TRUE(indices.is_empty());
+}
+
+TEST(sort, RadixSortIndicesSmall)
+{
+  const Array<uint32_t> keys = {5, 3, 8, 3, 0, 1000000, 5};
+  Array<int> indices(keys.size());
+  radix_sort_indices(keys.as_span(), indices);
+  const Array<int> expected = {4, 1, 3, 0, 6, 2, 5};
+  EXPECT_EQ(indices.as_span(), expected.as_span());
+}
+
+TEST(sort, RadixSortIndicesSigned)
+{
+  const Array<int> keys = {3, -1, 0, INT32_MIN, INT32_MAX, -1};
+  Array<int> indices(keys.size());
+  radix_sort_indices(keys.as_span(), indices);
+  const Array<int> expected = {3, 1, 5, 2, 0, 4};
+  EXPECT_EQ(indices.as_span(), expected.as_span());
+}
+
+TEST(sort, RadixSortIndicesFloat)
+{
+  const Array<float> keys = {1.5f, -2.0f, 0.0f, -0.5f, 100.0f, -1000.0f, 0.25f};
+  Array<int> indices(keys.size());
+  radix_sort_indices(keys.as_span(), indices);
+  const Array<int> expected = {5, 1, 3, 2, 6, 0, 4};
+  EXPECT_EQ(indices.as_span(), expected.as_span());
+}
+
+TEST(sort, RadixSortIndicesLargeStable)
+{
+  /* Enough elements to be split into multiple chunks, with many equal keys. */
+  RandomNumberGenerator rng(0);
+  Array<uint64_t> keys(300000);
+  for (uint64_t &key : keys) {
+    key = uint64_t(rng.get_uint32() % 1000) << 40;
+  }
+  Array<int> indices(keys.size());
+  radix_sort_indices(keys.as_span(), indices);
+  EXPECT_EQ(indices.as_span(), std_stable_sort_indices(keys.as_span()).as_span());
+}
+
+TEST(sort, RadixSortIndicesLargeFloat)
+{
+  RandomNumberGenerator rng(1);
+  Array<float> keys(200000);
+  for (float &key : keys) {
+    key = rng.get_float() * 200.0f - 100.0f;
+  }
+  Array<int> indices(keys.size());
+  radix_sort_indices(keys.as_span(), indices);
+  EXPECT_EQ(indices.as_span(), std_stable_sort_indices(keys.as_span()).as_span());
+}
+
+#if 0
+TEST(sort, RadixSortBenchmark)
+{
+  RandomNumberGenerator rng(0);
+  Array<uint32_t> keys(10000000);
+  for (uint32_t &key : keys) {
+    key = rng.get_uint32();
+  }
+  Array<int> indices(keys.size());
+  for (int i = 0; i < 3; i++) {
+    {
+      SCOPED_TIMER("radix_sort_indices");
+      radix_sort_indices(keys.as_span(), indices);
+    }
+    {
+      SCOPED_TIMER("parallel_sort");
+      std::iota(indices.begin(), indices.end(), 0);
+      parallel_sort(indices.begin(), indices.end(), [&](const int a, const int b) {
+        return keys[a] < keys[b];
+      });
+    }
+  }
+}
+
+/**
+ * Timer 'radix_sort_indices' took 575.88 ms
+ * Timer 'parallel_sort' took 2460.12 ms
+ */
+#endif /* Benchmark */
+
+}  // namespace blender::tests
@@ -0,0 +1,174 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <string>
+
+#include "BLI_array.hh"
+#include "BLI_index_mask.hh"
+#include "BLI_map.hh"
+#include "BLI_set.hh"
+#include "BLI_timeit.hh"
+#include "BLI_vector.hh"
+
+/**
+ * Micro-benchmarks for the containers and the #IndexMask, which are used in many hot loops.
+ * Every benchmark runs a few times and prints the time of every step, so that regressions can be
+ * spotted by comparing the output of two builds.
+ */
+
+namespace blender::tests {
+
+#define NUM_RUNS 5
+
+/** Same pseudo random sequence on every platform, independent of other code. */
+static uint32_t gen_pseudo_random_number(uint32_t num)
+{
+  num ^= num << 13;
+  num ^= num >> 17;
+  num ^= num << 5;
+  return num;
+}
+
+static Array<int> random_ints(const int amount)
+{
+  Array<int> values(amount);
+  uint32_t state = 1;
+  for (const int i : values.index_range()) {
+    state = gen_pseudo_random_number(state);
+    values[i] = int(state & 0x7fffffff);
+  }
+  return values;
+}
+
+static void benchmark_vector(const int amount)
+{
+  const std::string suffix = " " + std::to_string(amount);
+  for ([[maybe_unused]] const int run : IndexRange(NUM_RUNS)) {
+    Vector<int> vector;
+    {
+      SCOPED_TIMER("vector append" + suffix);
+      for (const int i : IndexRange(amount)) {
+        vector.append(i);
+      }
+    }
+    int64_t sum = 0;
+    {
+      SCOPED_TIMER("vector iterate" + suffix);
+      for (const int value : vector) {
+        sum += value;
+      }
+    }
+    EXPECT_EQ(sum, int64_t(amount) * (amount - 1) / 2);
+  }
+}
+
+TEST(containers_performance, Vector)
+{
+  benchmark_vector(1000);
+  benchmark_vector(1000000);
+}
+
+static void benchmark_map(const int amount)
+{
+  const std::string suffix = " " + std::to_string(amount);
+  const Array<int> values = random_ints(amount);
+  for ([[maybe_unused]] const int run : IndexRange(NUM_RUNS)) {
+    Map<int, int> map;
+    {
+      SCOPED_TIMER("map add" + suffix);
+      for (const int value : values) {
+        map.add(value, value);
+      }
+    }
+    int count = 0;
+    {
+      SCOPED_TIMER("map lookup" + suffix);
+      for (const int value : values) {
+        count += map.contains(value);
+      }
+    }
+    EXPECT_EQ(count, amount);
+    {
+      SCOPED_TIMER("map remove" + suffix);
+      for (const int value : values) {
+        map.remove(value);
+      }
+    }
+    EXPECT_TRUE(map.is_empty());
+  }
+}
+
+TEST(containers_performance, Map)
+{
+  benchmark_map(1000);
+  benchmark_map(1000000);
+}
+
+static void benchmark_set(const int amount)
+{
+  const std::string suffix = " " + std::to_string(amount);
+  const Array<int> values = random_ints(amount);
+  for ([[maybe_unused]] const int run : IndexRange(NUM_RUNS)) {
+    Set<int> set;
+    {
+      SCOPED_TIMER("set add" + suffix);
+      for (const int value : values) {
+        set.add(value);
+      }
+    }
+    int count = 0;
+    {
+      SCOPED_TIMER("set contains" + suffix);
+      for (const int value : values) {
+        count += set.contains(value);
+      }
+    }
+    EXPECT_EQ(count, amount);
+  }
+}
+
+TEST(containers_performance, Set)
+{
+  benchmark_set(1000);
+  benchmark_set(1000000);
+}
+
+static void benchmark_index_mask(const int64_t size)
+{
+  const std::string suffix = " " + std::to_string(size);
+  Array<bool> bools(size);
+  for (const int64_t i : bools.index_range()) {
+    /* Mix of long selected ranges and scattered indices. */
+    bools[i] = (i / 10000) % 2 == 0 || i % 7 == 0;
+  }
+  for ([[maybe_unused]] const int run : IndexRange(NUM_RUNS)) {
+    IndexMaskMemory memory;
+    IndexMask mask;
+    {
+      SCOPED_TIMER("index mask from bools" + suffix);
+      mask = IndexMask::from_bools(bools, memory);
+    }
+    {
+      SCOPED_TIMER("index mask from predicate" + suffix);
+      IndexMask::from_predicate(
+          IndexRange(size), GrainSize(4096), memory, [&](const int64_t i) { return bools[i]; });
+    }
+    int64_t count = 0;
+    {
+      SCOPED_TIMER("index mask foreach index" + suffix);
+      mask.foreach_index([&](const int64_t /*i*/) { count++; });
+    }
+    EXPECT_EQ(count, mask.size());
+  }
+}
+
+TEST(containers_performance, IndexMask)
+{
+  benchmark_index_mask(1000);
+  benchmark_index_mask(10000000);
+}
+
+}  // namespace blender::tests
@@ -33,6 +33,10 @@
 
 #include "DNA_windowmanager_types.h" /* for eReportType */
 
+namespace blender {
+class ImplicitSharingInfo;
+}
+
 struct BlendDataReader;
 struct BlendFileReadReport;
 struct BlendLibReader;
@@ -221,6 +225,23 @@ void *BLO_read_get_new_packed_address(BlendDataReader *reader, const void *old_a
 
 #define BLO_read_data_address(reader, ptr_p) \
   *((void **)ptr_p) = BLO_read_get_new_data_address((reader), *(ptr_p))
+
+/**
+ * Same as #BLO_read_data_address, but large arrays may be used directly from the memory-mapped
+ * file instead of being copied. In that case the returned sharing info owns the data and the
+ * caller gets a user of it, the data must only be modified after making it mutable (which copies
+ * it). Otherwise null is returned and the caller owns the data as usual. The whole file stays
+ * mapped as long as any data that uses it is alive.
+ *
+ * Only valid for plain arrays that don't need endian switching (the file data is used as is).
+ */
+const blender::ImplicitSharingInfo *BLO_read_shared_data_address(BlendDataReader *reader,
+                                                                 void **ptr_p);
+/**
+ * Whether the data owned by \a sharing_info is used directly from a memory-mapped file (see
+ * #BLO_read_shared_data_address). Such data is not allocated with guarded-alloc.
+ */
+bool BLO_read_data_is_memory_mapped(const blender::ImplicitSharingInfo *sharing_info);
 #define BLO_read_packed_address(reader, ptr_p) \
   *((void **)ptr_p) = BLO_read_get_new_packed_address((reader), *(ptr_p))
 
@@ -101,6 +101,8 @@ typedef struct BlendFileReadReport {
     double lib_overrides;
     double lib_overrides_resync;
     double lib_overrides_recursive_resync;
+    /** Time spent in (non-skipped) versioning passes, before and after linking. */
+    double versioning;
   } duration;
 
   /** Count information. */
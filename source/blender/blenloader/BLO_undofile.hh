@@ -12,6 +12,7 @@
 #include "BLI_filereader.h"
 #include "BLI_listbase.h"
 
+struct BLI_mempool;
 struct GHash;
 struct Main;
 struct Scene;
@@ -34,7 +35,13 @@ struct MemFileChunk {
 
 struct MemFile {
   ListBase chunks;
+  /** Size in bytes of the chunk buffers owned by this memfile. */
   size_t size;
+  /**
+   * Storage of #MemFileChunk, avoids one allocation per chunk since undo steps of large scenes
+   * easily have hundreds of thousands of them. Created on demand.
+   */
+  BLI_mempool *chunk_pool;
 };
 
 struct MemFileWriteData {
@@ -91,11 +98,19 @@ extern void BLO_memfile_merge(MemFile *first, MemFile *second);
  */
 extern void BLO_memfile_clear_future(MemFile *memfile);
 
+/**
+ * Copy the content of `memfile` into a single chunk owned by `r_memfile`, which then stays valid
+ * independently of the undo stack (e.g. to write it from another thread).
+ * `r_memfile` is expected to be empty, free it with #BLO_memfile_free.
+ */
+extern void BLO_memfile_copy_flat(const MemFile *memfile, MemFile *r_memfile);
+
 /* Utilities. */
 
 extern Main *BLO_memfile_main_get(MemFile *memfile, Main *bmain, Scene **r_scene);
 /**
  * Saves .blend using undo buffer.
+ * The file is written to a temporary file first, and moved to `filepath` on success.
  *
  * \return success.
  */
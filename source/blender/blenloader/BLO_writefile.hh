@@ -47,6 +47,11 @@ struct BlendFileWriteParams {
   uint use_save_as_copy : 1;
   uint use_userdef : 1;
   const struct BlendThumbnail *thumb;
+  /**
+   * Upper bound for the memory used by data waiting to be compressed or written, when writing
+   * compressed files. Zero uses a default.
+   */
+  size_t compress_memory_limit;
 };
 
 /**
@@ -260,12 +260,18 @@ PreviewImage *BLO_blendhandle_get_preview_for_id(BlendHandle *bh,
                                                  const char *name)
 {
   FileData *fd = (FileData *)bh;
-  bool looking = false;
   const int sdna_preview_image = DNA_struct_find_with_alias(fd->filesdna, "PreviewImage");
 
-  for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+  /* Jump straight to the ID, the lookup table makes reading previews of many IDs from the same
+   * handle cheap. */
+  BHead *bhead_id = blo_bhead_find_from_code_name(fd, short(ofblocktype), name);
+  if (bhead_id == nullptr) {
+    return nullptr;
+  }
+
+  for (BHead *bhead = blo_bhead_next(fd, bhead_id); bhead; bhead = blo_bhead_next(fd, bhead)) {
     if (bhead->code == BLO_CODE_DATA) {
-      if (looking && bhead->SDNAnr == sdna_preview_image) {
+      if (bhead->SDNAnr == sdna_preview_image) {
         PreviewImage *preview_from_file = static_cast<PreviewImage *>(
             BLO_library_read_struct(fd, bhead, "PreviewImage"));
 
@@ -280,17 +286,11 @@ PreviewImage *BLO_blendhandle_get_preview_for_id(BlendHandle *bh,
         return result;
       }
     }
-    else if (looking || bhead->code == BLO_CODE_ENDB) {
+    else {
       /* We were looking for a preview image, but didn't find any belonging to block. So it doesn't
        * exist. */
       break;
     }
-    else if (bhead->code == ofblocktype) {
-      const char *idname = blo_bhead_id_name(fd, bhead);
-      if (STREQ(&idname[2], name)) {
-        looking = true;
-      }
-    }
   }
 
   return nullptr;
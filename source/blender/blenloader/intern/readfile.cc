@@ -51,11 +51,15 @@
 #include "BLI_endian_defines.h"
 #include "BLI_endian_switch.h"
 #include "BLI_ghash.h"
+#include "BLI_implicit_sharing.hh"
 #include "BLI_linklist.h"
 #include "BLI_map.hh"
 #include "BLI_memarena.h"
 #include "BLI_mempool.h"
+#include "BLI_mmap.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #include "PIL_time.h"
 
@@ -175,6 +179,29 @@
 /** Use #GHash for restoring pointers by name. */
 #define USE_GHASH_RESTORE_POINTER
 
+/**
+ * Convert data-blocks (endian switch, DNA reconstruction) of each ID on multiple threads.
+ * Only the conversion is threaded, file access and pointer mapping remain serial.
+ */
+#define USE_PARALLEL_DATA_CONVERSION
+
+/** Maximum size of raw file data kept in memory while waiting for parallel conversion. */
+#define DATA_CONVERSION_BATCH_SIZE (64 * 1024 * 1024)
+
+/**
+ * Let large data-blocks that don't need any conversion point directly into the memory-mapped
+ * file instead of copying them, see #BLO_read_shared_data_address.
+ *
+ * \note Disabled on WIN32, where a mapped file can't be replaced, which would prevent saving
+ * over the file that is currently open.
+ */
+#if defined(USE_BHEAD_READ_ON_DEMAND) && !defined(WIN32)
+#  define USE_MMAP_SHARED_DATA
+#endif
+
+/** Smaller data-blocks are always copied, to avoid keeping mostly unused pages mapped. */
+#define MMAP_SHARED_DATA_MIN_SIZE (64 * 1024)
+
 static CLG_LogRef LOG = {"blo.readfile"};
 static CLG_LogRef LOG_UNDO = {"blo.readfile.undo"};
 
@@ -244,6 +271,9 @@ struct NewAddress {
 
   /** `nr` is "user count" for data, and ID code for libdata. */
   int nr;
+
+  /** When non-zero, `newp` points into the memory-mapped file and isn't owned by anyone. */
+  int mapped_size = 0;
 };
 
 struct OldNewMap {
@@ -307,7 +337,7 @@ static void oldnewmap_clear(OldNewMap *onm)
 {
   /* Free unused data. */
   for (NewAddress &new_addr : onm->map.values()) {
-    if (new_addr.nr == 0) {
+    if (new_addr.nr == 0 && new_addr.mapped_size == 0) {
       MEM_freeN(new_addr.newp);
     }
   }
@@ -319,6 +349,40 @@ static void oldnewmap_free(OldNewMap *onm)
   MEM_delete(onm);
 }
 
+#ifdef USE_MMAP_SHARED_DATA
+/**
+ * Owns the memory-mapped file of a #FileData, which is unmapped once the last user is gone.
+ *
+ * \note Every layer that uses the mapping keeps the whole file mapped, even when all other data
+ * of the file has been freed. This only costs address space: the mapping is backed by the file,
+ * so pages that aren't used by any layer are never touched again and can be reclaimed by the
+ * system like any other file cache. Blocks smaller than #MMAP_SHARED_DATA_MIN_SIZE are copied,
+ * so the used pages are mostly occupied by the shared layers themselves.
+ */
+class MappedFileSharingInfo : public blender::ImplicitSharingInfo {
+ private:
+  BLI_mmap_file *mmap_file_;
+
+ public:
+  MappedFileSharingInfo(BLI_mmap_file *mmap_file) : mmap_file_(mmap_file) {}
+
+ private:
+  void delete_self_with_data() override
+  {
+    this->delete_data_only();
+    MEM_delete(this);
+  }
+
+  void delete_data_only() override
+  {
+    if (mmap_file_ != nullptr) {
+      BLI_mmap_free(mmap_file_);
+      mmap_file_ = nullptr;
+    }
+  }
+};
+#endif
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -476,6 +540,11 @@ static bool blo_bhead_is_id_valid_type(const BHead *bhead)
 #ifdef USE_GHASH_BHEAD
 static void read_file_bhead_idname_map_create(FileData *fd)
 {
+  /* May already have been created by #blo_bhead_find_from_code_name. */
+  if (fd->bhead_idname_hash != nullptr) {
+    return;
+  }
+
   BHead *bhead;
 
   /* dummy values */
@@ -496,8 +565,6 @@ static void read_file_bhead_idname_map_create(FileData *fd)
     }
   }
 
-  BLI_assert(fd->bhead_idname_hash == nullptr);
-
   fd->bhead_idname_hash = BLI_ghash_str_new_ex(__func__, reserve);
 
   for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
@@ -1186,10 +1253,19 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
   /* Rewind the file after reading the header. */
   rawfile->seek(rawfile, 0, SEEK_SET);
 
+  BLI_mmap_file *mmap_file = nullptr;
+
   /* Check if we have a regular file. */
   if (memcmp(header, "BLENDER", sizeof(header)) == 0) {
     /* Try opening the file with memory-mapped IO. */
+#ifdef USE_MMAP_SHARED_DATA
+    mmap_file = BLI_mmap_open(filedes);
+    if (mmap_file != nullptr) {
+      file = BLI_filereader_new_mmap_file(mmap_file);
+    }
+#else
     file = BLI_filereader_new_mmap(filedes);
+#endif
     if (file == nullptr) {
       /* `mmap` failed, so just keep using `rawfile`. */
       file = rawfile;
@@ -1220,6 +1296,12 @@ static FileData *blo_filedata_from_file_descriptor(const char *filepath,
 
   FileData *fd = filedata_new(reports);
   fd->file = file;
+#ifdef USE_MMAP_SHARED_DATA
+  if (mmap_file != nullptr) {
+    fd->mmap_file = mmap_file;
+    fd->mmap_sharing_info = MEM_new<MappedFileSharingInfo>(__func__, mmap_file);
+  }
+#endif
 
   return fd;
 }
@@ -1333,6 +1415,10 @@ void blo_filedata_free(FileData *fd)
     }
 #endif
     fd->file->close(fd->file);
+    if (fd->mmap_sharing_info) {
+      /* The mapping stays alive as long as data read from the file still uses it. */
+      fd->mmap_sharing_info->remove_user_and_delete_if_last();
+    }
 
     if (fd->filesdna) {
       DNA_sdna_free(fd->filesdna);
@@ -1419,16 +1505,42 @@ BlendThumbnail *BLO_thumbnail_from_file(const char *filepath)
 /** \name Old/New Pointer Map
  * \{ */
 
+/**
+ * Callers of the regular lookup functions own the returned data, so data that still points into
+ * the memory-mapped file is copied first.
+ */
+static void *datamap_lookup_and_inc(FileData *fd, const void *adr, const bool increase_users)
+{
+#ifdef USE_MMAP_SHARED_DATA
+  NewAddress *entry = fd->datamap->map.lookup_ptr(adr);
+  if (entry != nullptr && entry->mapped_size != 0) {
+    void *data = MEM_mallocN(size_t(entry->mapped_size), "Data from mapped file");
+    if (UNLIKELY(!BLI_mmap_read(fd->mmap_file,
+                                data,
+                                size_t(static_cast<const char *>(entry->newp) -
+                                       static_cast<const char *>(
+                                           BLI_mmap_get_pointer(fd->mmap_file))),
+                                size_t(entry->mapped_size))))
+    {
+      fd->flags &= ~FD_FLAGS_FILE_OK;
+    }
+    entry->newp = data;
+    entry->mapped_size = 0;
+  }
+#endif
+  return oldnewmap_lookup_and_inc(fd->datamap, adr, increase_users);
+}
+
 /* Only direct data-blocks. */
 static void *newdataadr(FileData *fd, const void *adr)
 {
-  return oldnewmap_lookup_and_inc(fd->datamap, adr, true);
+  return datamap_lookup_and_inc(fd, adr, true);
 }
 
 /* Only direct data-blocks. */
 static void *newdataadr_no_us(FileData *fd, const void *adr)
 {
-  return oldnewmap_lookup_and_inc(fd->datamap, adr, false);
+  return datamap_lookup_and_inc(fd, adr, false);
 }
 
 void *blo_read_get_new_globaldata_address(FileData *fd, const void *adr)
@@ -1443,7 +1555,7 @@ static void *newpackedadr(FileData *fd, const void *adr)
     return oldnewmap_lookup_and_inc(fd->packedmap, adr, true);
   }
 
-  return oldnewmap_lookup_and_inc(fd->datamap, adr, true);
+  return datamap_lookup_and_inc(fd, adr, true);
 }
 
 /* only lib data */
@@ -1502,7 +1614,11 @@ static void change_link_placeholder_to_real_ID_pointer(ListBase *mainlist,
 static void insert_packedmap(FileData *fd, PackedFile *pf)
 {
   oldnewmap_insert(fd->packedmap, pf, pf, 0);
-  oldnewmap_insert(fd->packedmap, pf->data, pf->data, 0);
+  /* Shared data is owned through the sharing info of its packed files, it can only be restored
+   * together with them, never on its own. */
+  if (pf->sharing_info == nullptr) {
+    oldnewmap_insert(fd->packedmap, pf->data, pf->data, 0);
+  }
 }
 
 void blo_make_packed_pointer_map(FileData *fd, Main *oldmain)
@@ -1755,20 +1871,50 @@ void blo_cache_storage_end(FileData *fd)
 /** \name DNA Struct Loading
  * \{ */
 
+/**
+ * Arrays of structs with at least this many elements are converted (endian switch, DNA
+ * reconstruction) on multiple threads, typically legacy mesh data.
+ */
+#define DATA_CONVERSION_PARALLEL_ELEMENTS_MIN 4096
+
 static void switch_endian_structs(const SDNA *filesdna, BHead *bhead)
 {
-  int blocksize, nblocks;
-  char *data;
+  char *data = (char *)(bhead + 1);
+  const int blocksize = filesdna->types_size[filesdna->structs[bhead->SDNAnr]->type];
 
-  data = (char *)(bhead + 1);
-  blocksize = filesdna->types_size[filesdna->structs[bhead->SDNAnr]->type];
+  blender::threading::parallel_for(
+      blender::IndexRange(bhead->nr),
+      DATA_CONVERSION_PARALLEL_ELEMENTS_MIN,
+      [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          DNA_struct_switch_endian(filesdna, bhead->SDNAnr, data + i * blocksize);
+        }
+      });
+}
 
-  nblocks = bhead->nr;
-  while (nblocks--) {
-    DNA_struct_switch_endian(filesdna, bhead->SDNAnr, data);
+static void *reconstruct_structs(FileData *fd, BHead *bh)
+{
+  if (bh->nr < DATA_CONVERSION_PARALLEL_ELEMENTS_MIN) {
+    return DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1));
+  }
 
-    data += blocksize;
+  const int new_block_size = DNA_struct_reconstruct_size(fd->reconstruct_info, bh->SDNAnr);
+  if (new_block_size == 0) {
+    return nullptr;
   }
+  void *new_blocks = MEM_calloc_arrayN(size_t(bh->nr), size_t(new_block_size), "reconstruct");
+  blender::threading::parallel_for(
+      blender::IndexRange(bh->nr),
+      DATA_CONVERSION_PARALLEL_ELEMENTS_MIN,
+      [&](const blender::IndexRange range) {
+        DNA_struct_reconstruct_range(fd->reconstruct_info,
+                                     bh->SDNAnr,
+                                     int(range.start()),
+                                     int(range.size()),
+                                     (bh + 1),
+                                     new_blocks);
+      });
+  return new_blocks;
 }
 
 static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
@@ -1805,7 +1951,7 @@ static void *read_struct(FileData *fd, BHead *bh, const char *blockname)
           }
         }
 #endif
-        temp = DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, (bh + 1));
+        temp = reconstruct_structs(fd, bh);
       }
       else {
         /* SDNA_CMP_EQUAL */
@@ -2522,6 +2668,165 @@ static bool direct_link_id(FileData *fd, Main *main, const int tag, ID *id, ID *
   return success;
 }
 
+#ifdef USE_MMAP_SHARED_DATA
+
+/**
+ * Get the data of a block that can be used directly from the memory-mapped file, without any
+ * conversion or copy. Returns null when the block has to be read with #read_struct.
+ */
+static void *read_struct_mapped(FileData *fd, BHead *bh)
+{
+  if (fd->mmap_file == nullptr || bh->len < MMAP_SHARED_DATA_MIN_SIZE) {
+    return nullptr;
+  }
+  if (BHEADN_FROM_BHEAD(bh)->has_data || fd->compflags[bh->SDNAnr] != SDNA_CMP_EQUAL) {
+    return nullptr;
+  }
+  if (fd->flags & FD_FLAGS_SWITCH_ENDIAN) {
+    /* Also raw data may be switched later on (e.g. #BLO_read_float3_array). */
+    return nullptr;
+  }
+  const off64_t offset = BHEADN_FROM_BHEAD(bh)->file_offset;
+  if (offset <= 0 || size_t(offset) + size_t(bh->len) > BLI_mmap_get_length(fd->mmap_file)) {
+    return nullptr;
+  }
+  return POINTER_OFFSET(BLI_mmap_get_pointer(fd->mmap_file), offset);
+}
+
+static void oldnewmap_insert_mapped(FileData *fd, BHead *bh, void *data)
+{
+  oldnewmap_insert(fd->datamap, bh->old, data, 0);
+  if (NewAddress *entry = fd->datamap->map.lookup_ptr(bh->old)) {
+    entry->mapped_size = bh->len;
+  }
+}
+
+#endif /* USE_MMAP_SHARED_DATA */
+
+#ifdef USE_PARALLEL_DATA_CONVERSION
+
+/**
+ * Whether reading the struct requires CPU-side work (endian switching or DNA reconstruction),
+ * rather than a plain copy of the file data.
+ */
+static bool read_struct_needs_conversion(const FileData *fd, const BHead *bh)
+{
+  if (bh->len == 0 || fd->compflags[bh->SDNAnr] == SDNA_CMP_REMOVED) {
+    return false;
+  }
+  if (bh->SDNAnr && (fd->flags & FD_FLAGS_SWITCH_ENDIAN)) {
+    return true;
+  }
+  return fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL;
+}
+
+struct DataBlockRead {
+  BHead *bhead;
+  /** Copy of the block with its file data loaded, owned when different from #bhead. */
+  BHead *bhead_full;
+  void *data;
+  /** The data points into the memory-mapped file. */
+  bool is_mapped;
+};
+
+static void read_data_blocks_convert_parallel(FileData *fd,
+                                              blender::MutableSpan<DataBlockRead> blocks,
+                                              const char *allocname)
+{
+  blender::threading::parallel_for(blocks.index_range(), 8, [&](const blender::IndexRange range) {
+    for (DataBlockRead &block : blocks.slice(range)) {
+      if (block.bhead_full == nullptr) {
+        continue;
+      }
+      /* The data is already in memory, so this does not access the (non thread-safe) file. */
+      block.data = read_struct(fd, block.bhead_full, allocname);
+#  ifdef USE_BHEAD_READ_ON_DEMAND
+      if (block.bhead_full != block.bhead) {
+        MEM_freeN(BHEADN_FROM_BHEAD(block.bhead_full));
+      }
+#  endif
+      block.bhead_full = nullptr;
+    }
+  });
+}
+
+static void read_data_blocks_insert(FileData *fd, blender::Span<DataBlockRead> blocks)
+{
+  for (const DataBlockRead &block : blocks) {
+    if (block.data == nullptr) {
+      continue;
+    }
+#  ifdef USE_MMAP_SHARED_DATA
+    if (block.is_mapped) {
+      oldnewmap_insert_mapped(fd, block.bhead, block.data);
+      continue;
+    }
+#  endif
+    oldnewmap_insert(fd->datamap, block.bhead->old, block.data, 0);
+  }
+}
+
+/**
+ * Read all data associated with a datablock into datamap.
+ *
+ * Reading from the file stays serial, but blocks which need endian switching or DNA
+ * reconstruction (typically files from older versions) are converted on multiple threads.
+ * The raw data of pending blocks is kept in memory until converted, bounded by
+ * #DATA_CONVERSION_BATCH_SIZE.
+ */
+static BHead *read_data_into_datamap(FileData *fd, BHead *bhead, const char *allocname)
+{
+  bhead = blo_bhead_next(fd, bhead);
+
+  blender::Vector<DataBlockRead, 64> blocks;
+  int64_t pending_size = 0;
+
+  while (bhead && bhead->code == BLO_CODE_DATA) {
+    DataBlockRead block = {bhead, nullptr, nullptr, false};
+#  ifdef USE_MMAP_SHARED_DATA
+    block.data = read_struct_mapped(fd, bhead);
+    block.is_mapped = block.data != nullptr;
+#  endif
+    if (block.is_mapped) {
+      /* Used directly from the file, nothing to read. */
+    }
+    else if (read_struct_needs_conversion(fd, bhead)) {
+      block.bhead_full = bhead;
+#  ifdef USE_BHEAD_READ_ON_DEMAND
+      if (BHEADN_FROM_BHEAD(bhead)->has_data == false) {
+        block.bhead_full = blo_bhead_read_full(fd, bhead);
+        if (UNLIKELY(block.bhead_full == nullptr)) {
+          fd->flags &= ~FD_FLAGS_FILE_OK;
+        }
+      }
+#  endif
+      pending_size += bhead->len;
+    }
+    else {
+      block.data = read_struct(fd, bhead, allocname);
+    }
+    blocks.append(block);
+
+    if (pending_size > DATA_CONVERSION_BATCH_SIZE) {
+      read_data_blocks_convert_parallel(fd, blocks, allocname);
+      read_data_blocks_insert(fd, blocks);
+      blocks.clear();
+      pending_size = 0;
+    }
+
+    bhead = blo_bhead_next(fd, bhead);
+  }
+
+  if (pending_size > 0) {
+    read_data_blocks_convert_parallel(fd, blocks, allocname);
+  }
+  read_data_blocks_insert(fd, blocks);
+
+  return bhead;
+}
+
+#else
+
 /* Read all data associated with a datablock into datamap. */
 static BHead *read_data_into_datamap(FileData *fd, BHead *bhead, const char *allocname)
 {
@@ -2548,6 +2853,14 @@ static BHead *read_data_into_datamap(FileData *fd, BHead *bhead, const char *all
     }
 #endif
 
+#  ifdef USE_MMAP_SHARED_DATA
+    if (void *data = read_struct_mapped(fd, bhead)) {
+      oldnewmap_insert_mapped(fd, bhead, data);
+      bhead = blo_bhead_next(fd, bhead);
+      continue;
+    }
+#  endif
+
     void *data = read_struct(fd, bhead, allocname);
     if (data) {
       oldnewmap_insert(fd->datamap, bhead->old, data, 0);
@@ -2559,6 +2872,8 @@ static BHead *read_data_into_datamap(FileData *fd, BHead *bhead, const char *all
   return bhead;
 }
 
+#endif /* USE_PARALLEL_DATA_CONVERSION */
+
 /* Verify if the datablock and all associated data is identical. */
 static bool read_libblock_is_identical(FileData *fd, BHead *bhead)
 {
@@ -3165,6 +3480,45 @@ static void do_versions_userdef(FileData * /*fd*/, BlendFileData *bfd)
   blo_do_versions_userdef(user);
 }
 
+/** Version passed to #do_versions_pass for the latest pass, which always runs. */
+#define VERSIONING_PASS_NEVER_SKIP INT_MAX
+
+/**
+ * Run a single versioning pass, unless the file is at least `skip_version.skip_subversion`, from
+ * which on the pass has nothing left to do. Besides their own version range, older passes
+ * contain some code for later (sub)versions and some code which is not gated by the file version
+ * at all, so the skip version is chosen conservatively for them.
+ *
+ * The time spent is accumulated in the read report, and printed per pass with `--debug-io`.
+ */
+template<typename Fn>
+static void do_versions_pass(FileData *fd,
+                             Main *main,
+                             const char *name,
+                             const int skip_version,
+                             const int skip_subversion,
+                             const Fn &fn)
+{
+  if (main->is_read_invalid) {
+    return;
+  }
+  if (MAIN_VERSION_FILE_ATLEAST(main, skip_version, skip_subversion)) {
+    return;
+  }
+
+  const double time_start = PIL_check_seconds_timer();
+  fn();
+  const double duration = PIL_check_seconds_timer() - time_start;
+
+  fd->reports->duration.versioning += duration;
+  if (G.debug & G_DEBUG_IO) {
+    printf("Versioning %s (%s): %.3f ms\n",
+           name,
+           main->curlib ? main->curlib->filepath : main->filepath,
+           duration * 1000.0);
+  }
+}
+
 static void do_versions(FileData *fd, Library *lib, Main *main)
 {
   /* WATCH IT!!!: pointers from libdata have not been converted */
@@ -3193,30 +3547,16 @@ static void do_versions(FileData *fd, Library *lib, Main *main)
               main->build_hash);
   }
 
-  if (!main->is_read_invalid) {
-    blo_do_versions_pre250(fd, lib, main);
-  }
-  if (!main->is_read_invalid) {
-    blo_do_versions_250(fd, lib, main);
-  }
-  if (!main->is_read_invalid) {
-    blo_do_versions_260(fd, lib, main);
-  }
-  if (!main->is_read_invalid) {
-    blo_do_versions_270(fd, lib, main);
-  }
-  if (!main->is_read_invalid) {
-    blo_do_versions_280(fd, lib, main);
-  }
-  if (!main->is_read_invalid) {
-    blo_do_versions_290(fd, lib, main);
-  }
-  if (!main->is_read_invalid) {
-    blo_do_versions_300(fd, lib, main);
-  }
-  if (!main->is_read_invalid) {
+  do_versions_pass(fd, main, "pre250", 250, 0, [&]() { blo_do_versions_pre250(fd, lib, main); });
+  do_versions_pass(fd, main, "250", 260, 0, [&]() { blo_do_versions_250(fd, lib, main); });
+  do_versions_pass(fd, main, "260", 280, 60, [&]() { blo_do_versions_260(fd, lib, main); });
+  do_versions_pass(fd, main, "270", 280, 0, [&]() { blo_do_versions_270(fd, lib, main); });
+  do_versions_pass(fd, main, "280", 400, 0, [&]() { blo_do_versions_280(fd, lib, main); });
+  do_versions_pass(fd, main, "290", 300, 0, [&]() { blo_do_versions_290(fd, lib, main); });
+  do_versions_pass(fd, main, "300", 400, 0, [&]() { blo_do_versions_300(fd, lib, main); });
+  do_versions_pass(fd, main, "400", VERSIONING_PASS_NEVER_SKIP, 0, [&]() {
     blo_do_versions_400(fd, lib, main);
-  }
+  });
 
   /* WATCH IT!!!: pointers from libdata have not been converted yet here! */
   /* WATCH IT 2!: Userdef struct init see do_versions_userdef() above! */
@@ -3241,27 +3581,21 @@ static void do_versions_after_linking(FileData *fd, Main *main)
   /* Don't allow versioning to create new data-blocks. */
   main->is_locked_for_linking = true;
 
-  if (!main->is_read_invalid) {
-    do_versions_after_linking_250(main);
-  }
-  if (!main->is_read_invalid) {
-    do_versions_after_linking_260(main);
-  }
-  if (!main->is_read_invalid) {
-    do_versions_after_linking_270(main);
-  }
-  if (!main->is_read_invalid) {
-    do_versions_after_linking_280(fd, main);
-  }
-  if (!main->is_read_invalid) {
-    do_versions_after_linking_290(fd, main);
-  }
-  if (!main->is_read_invalid) {
-    do_versions_after_linking_300(fd, main);
-  }
-  if (!main->is_read_invalid) {
+  do_versions_pass(
+      fd, main, "after linking 250", 260, 0, [&]() { do_versions_after_linking_250(main); });
+  do_versions_pass(
+      fd, main, "after linking 260", 280, 60, [&]() { do_versions_after_linking_260(main); });
+  do_versions_pass(
+      fd, main, "after linking 270", 280, 0, [&]() { do_versions_after_linking_270(main); });
+  do_versions_pass(
+      fd, main, "after linking 280", 400, 0, [&]() { do_versions_after_linking_280(fd, main); });
+  do_versions_pass(
+      fd, main, "after linking 290", 300, 0, [&]() { do_versions_after_linking_290(fd, main); });
+  do_versions_pass(
+      fd, main, "after linking 300", 400, 0, [&]() { do_versions_after_linking_300(fd, main); });
+  do_versions_pass(fd, main, "after linking 400", VERSIONING_PASS_NEVER_SKIP, 0, [&]() {
     do_versions_after_linking_400(fd, main);
-  }
+  });
 
   main->is_locked_for_linking = false;
 }
@@ -3773,6 +4107,10 @@ BlendFileData *blo_read_file_internal(FileData *fd, const char *filepath)
 
     placeholders_ensure_valid(bfd->main);
 
+    if (!is_undo) {
+      BKE_packedfile_share_identical_data(bfd->main);
+    }
+
     BKE_main_id_tag_all(bfd->main, LIB_TAG_NEW, false);
 
     /* Must happen before applying liboverrides, as this process may fully invalidate e.g. view
@@ -3851,6 +4189,12 @@ static int verg_bheadsort(const void *v1, const void *v2)
   return 0;
 }
 
+/**
+ * Build the sorted map of #BHead.old pointers used by #find_bhead.
+ *
+ * Only ID blocks are stored since expanding only ever looks up ID pointers,
+ * this keeps the map small for large libraries which mostly contain data blocks.
+ */
 static void sort_bhead_old_map(FileData *fd)
 {
   BHead *bhead;
@@ -3858,7 +4202,9 @@ static void sort_bhead_old_map(FileData *fd)
   int tot = 0;
 
   for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
-    tot++;
+    if (blo_bhead_is_id(bhead)) {
+      tot++;
+    }
   }
 
   fd->tot_bheadmap = tot;
@@ -3869,9 +4215,12 @@ static void sort_bhead_old_map(FileData *fd)
   bhs = fd->bheadmap = static_cast<BHeadSort *>(
       MEM_malloc_arrayN(tot, sizeof(BHeadSort), "BHeadSort"));
 
-  for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead), bhs++) {
-    bhs->bhead = bhead;
-    bhs->old = bhead->old;
+  for (bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+    if (blo_bhead_is_id(bhead)) {
+      bhs->bhead = bhead;
+      bhs->old = bhead->old;
+      bhs++;
+    }
   }
 
   qsort(fd->bheadmap, tot, sizeof(BHeadSort), verg_bheadsort);
@@ -3893,6 +4242,7 @@ static BHead *find_previous_lib(FileData *fd, BHead *bhead)
   return bhead;
 }
 
+/** Find the ID block with the given old address, see #sort_bhead_old_map. */
 static BHead *find_bhead(FileData *fd, void *old)
 {
 #if 0
@@ -3957,6 +4307,31 @@ static BHead *find_bhead_from_code_name(FileData *fd, const short idcode, const
 #endif
 }
 
+BHead *blo_bhead_find_from_code_name(FileData *fd, const short idcode, const char *name)
+{
+#ifdef USE_GHASH_BHEAD
+  /* Only linkable ID types are stored in the lookup table. */
+  if (BKE_idtype_idcode_is_linkable(idcode)) {
+    if (fd->bhead_idname_hash == nullptr) {
+      read_file_bhead_idname_map_create(fd);
+    }
+    return find_bhead_from_code_name(fd, idcode, name);
+  }
+#endif
+
+  for (BHead *bhead = blo_bhead_first(fd); bhead; bhead = blo_bhead_next(fd, bhead)) {
+    if (bhead->code == idcode) {
+      if (STREQ(blo_bhead_id_name(fd, bhead) + 2, name)) {
+        return bhead;
+      }
+    }
+    else if (bhead->code == BLO_CODE_ENDB) {
+      break;
+    }
+  }
+  return nullptr;
+}
+
 static BHead *find_bhead_from_idname(FileData *fd, const char *idname)
 {
 #ifdef USE_GHASH_BHEAD
@@ -4443,6 +4818,8 @@ static void library_link_end(Main *mainl, FileData **fd, const int flag)
   add_main_to_main(mainvar, main_newid);
   BKE_main_free(main_newid);
 
+  BKE_packedfile_share_identical_data(mainvar);
+
   BKE_main_id_tag_all(mainvar, LIB_TAG_NEW, false);
 
   /* FIXME Temporary 'fix' to a problem in how temp ID are copied in
@@ -4833,6 +5210,33 @@ void *BLO_read_get_new_data_address_no_us(BlendDataReader *reader, const void *o
   return newdataadr_no_us(reader->fd, old_address);
 }
 
+const blender::ImplicitSharingInfo *BLO_read_shared_data_address(BlendDataReader *reader,
+                                                                 void **ptr_p)
+{
+  FileData *fd = reader->fd;
+#ifdef USE_MMAP_SHARED_DATA
+  NewAddress *entry = fd->datamap->map.lookup_ptr(*ptr_p);
+  if (entry != nullptr && entry->mapped_size != 0) {
+    entry->nr++;
+    *ptr_p = entry->newp;
+    fd->mmap_sharing_info->add_user();
+    return fd->mmap_sharing_info;
+  }
+#endif
+  *ptr_p = newdataadr(fd, *ptr_p);
+  return nullptr;
+}
+
+bool BLO_read_data_is_memory_mapped(const blender::ImplicitSharingInfo *sharing_info)
+{
+#ifdef USE_MMAP_SHARED_DATA
+  return dynamic_cast<const MappedFileSharingInfo *>(sharing_info) != nullptr;
+#else
+  UNUSED_VARS(sharing_info);
+  return false;
+#endif
+}
+
 void *BLO_read_get_new_packed_address(BlendDataReader *reader, const void *old_address)
 {
   return newpackedadr(reader->fd, old_address);
@@ -22,6 +22,11 @@
 
 #include "BLO_readfile.h"
 
+namespace blender {
+class ImplicitSharingInfo;
+}
+
+struct BLI_mmap_file;
 struct BlendFileData;
 struct BlendFileReadParams;
 struct BlendFileReadReport;
@@ -61,6 +66,14 @@ struct FileData {
 
   FileReader *file;
 
+  /** Memory-mapped file, only set when reading an uncompressed file from disk. */
+  BLI_mmap_file *mmap_file;
+  /**
+   * Owns #mmap_file, data-blocks that point directly into the mapping hold a user of it
+   * (see #BLO_read_shared_data_address), so it may outlive the #FileData.
+   */
+  const blender::ImplicitSharingInfo *mmap_sharing_info;
+
   /** Whether we are undoing (< 0) or redoing (> 0), used to choose which 'unchanged' flag to use
    * to detect unchanged data from memfile. */
   int undo_direction; /* eUndoStepDir */
@@ -177,6 +190,11 @@ void blo_filedata_free(FileData *fd);
 BHead *blo_bhead_first(FileData *fd);
 BHead *blo_bhead_next(FileData *fd, BHead *thisblock);
 BHead *blo_bhead_prev(FileData *fd, BHead *thisblock);
+/**
+ * Find the #BHead of a linkable ID, creating the ID name lookup table on first use.
+ * Useful when many IDs are searched in the same file.
+ */
+BHead *blo_bhead_find_from_code_name(FileData *fd, short idcode, const char *name);
 
 /**
  * Warning! Caller's responsibility to ensure given bhead **is** an ID one!
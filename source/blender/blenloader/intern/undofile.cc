@@ -26,6 +26,7 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_ghash.h"
+#include "BLI_mempool.h"
 
 #include "BLO_readfile.h"
 #include "BLO_undofile.hh"
@@ -45,7 +46,10 @@ void BLO_memfile_free(MemFile *memfile)
     if (chunk->is_identical == false) {
       MEM_freeN((void *)chunk->buf);
     }
-    MEM_freeN(chunk);
+  }
+  if (memfile->chunk_pool != nullptr) {
+    BLI_mempool_destroy(memfile->chunk_pool);
+    memfile->chunk_pool = nullptr;
   }
   memfile->size = 0;
 }
@@ -97,6 +101,35 @@ void BLO_memfile_clear_future(MemFile *memfile)
   }
 }
 
+void BLO_memfile_copy_flat(const MemFile *memfile, MemFile *r_memfile)
+{
+  BLI_assert(BLI_listbase_is_empty(&r_memfile->chunks));
+
+  size_t size = 0;
+  LISTBASE_FOREACH (const MemFileChunk *, chunk, &memfile->chunks) {
+    size += chunk->size;
+  }
+
+  char *buf = static_cast<char *>(MEM_mallocN(size, "Chunk buffer (flat copy)"));
+  size_t offset = 0;
+  LISTBASE_FOREACH (const MemFileChunk *, chunk, &memfile->chunks) {
+    memcpy(buf + offset, chunk->buf, chunk->size);
+    offset += chunk->size;
+  }
+
+  /* Add the chunk directly, instead of going through #BLO_memfile_chunk_add which would copy the
+   * buffer once more. */
+  if (r_memfile->chunk_pool == nullptr) {
+    r_memfile->chunk_pool = BLI_mempool_create(sizeof(MemFileChunk), 0, 1, BLI_MEMPOOL_NOP);
+  }
+  MemFileChunk *chunk = static_cast<MemFileChunk *>(BLI_mempool_calloc(r_memfile->chunk_pool));
+  chunk->buf = buf;
+  chunk->size = size;
+  chunk->id_session_uuid = MAIN_ID_SESSION_UUID_UNSET;
+  BLI_addtail(&r_memfile->chunks, chunk);
+  r_memfile->size = size;
+}
+
 void BLO_memfile_write_init(MemFileWriteData *mem_data,
                             MemFile *written_memfile,
                             MemFile *reference_memfile)
@@ -146,8 +179,10 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   MemFile *memfile = mem_data->written_memfile;
   MemFileChunk **compchunk_step = &mem_data->reference_current_chunk;
 
-  MemFileChunk *curchunk = static_cast<MemFileChunk *>(
-      MEM_mallocN(sizeof(MemFileChunk), "MemFileChunk"));
+  if (memfile->chunk_pool == nullptr) {
+    memfile->chunk_pool = BLI_mempool_create(sizeof(MemFileChunk), 0, 4096, BLI_MEMPOOL_NOP);
+  }
+  MemFileChunk *curchunk = static_cast<MemFileChunk *>(BLI_mempool_alloc(memfile->chunk_pool));
   curchunk->size = size;
   curchunk->buf = nullptr;
   curchunk->is_identical = false;
@@ -204,6 +239,11 @@ bool BLO_memfile_write_file(MemFile *memfile, const char *filepath)
   MemFileChunk *chunk;
   int file, oflags;
 
+  /* Write to a temporary file first, so that an interrupted write never leaves a corrupt file
+   * behind (this may run in a background job for auto-save). */
+  char filepath_tmp[FILE_MAX];
+  SNPRINTF(filepath_tmp, "%s@", filepath);
+
   /* NOTE: This is currently used for auto-save and `quit.blend`,
    * where _not_ following symbolic-links is OK,
    * however if this is ever executed explicitly by the user,
@@ -219,7 +259,7 @@ bool BLO_memfile_write_file(MemFile *memfile, const char *filepath)
 #    warning "Symbolic links will be followed on undo save, possibly causing CVE-2008-1103"
 #  endif
 #endif
-  file = BLI_open(filepath, oflags, 0666);
+  file = BLI_open(filepath_tmp, oflags, 0666);
 
   if (file == -1) {
     fprintf(stderr,
@@ -249,6 +289,16 @@ bool BLO_memfile_write_file(MemFile *memfile, const char *filepath)
             "Unable to save '%s': %s\n",
             filepath,
             errno ? strerror(errno) : "Unknown error writing file");
+    BLI_delete(filepath_tmp, false, false);
+    return false;
+  }
+
+  if (BLI_rename_overwrite(filepath_tmp, filepath) != 0) {
+    fprintf(stderr,
+            "Unable to save '%s': %s\n",
+            filepath,
+            errno ? strerror(errno) : "Unknown error moving file into place");
+    BLI_delete(filepath_tmp, false, false);
     return false;
   }
   return true;
@@ -2528,5 +2528,17 @@ void blo_do_versions_400(FileData *fd, Library * /*lib*/, Main *bmain)
         material->displacement_method = displacement_method;
       }
     }
+
+    if (!DNA_struct_member_exists(
+            fd->filesdna, "SubsurfModifierData", "float", "adaptive_edge_length"))
+    {
+      LISTBASE_FOREACH (Object *, ob, &bmain->objects) {
+        LISTBASE_FOREACH (ModifierData *, md, &ob->modifiers) {
+          if (md->type == eModifierType_Subsurf) {
+            reinterpret_cast<SubsurfModifierData *>(md)->adaptive_edge_length = 1.0f;
+          }
+        }
+      }
+    }
   }
 }
@@ -58,6 +58,7 @@
  *   - #BLENDER_USERPREF_FILE (on UNIX `~/.config/blender/X.X/config/userpref.blend`).
  */
 
+#include <algorithm>
 #include <cerrno>
 #include <climits>
 #include <cmath>
@@ -140,6 +141,13 @@
 
 #define ZSTD_COMPRESSION_LEVEL 3
 
+/**
+ * Default limit for the memory of in-flight compression tasks (input and output buffers).
+ * Larger writes are split into frames of at most #ZSTD_BUFFER_SIZE, so this bounds the peak
+ * memory of writing regardless of the size of the data.
+ */
+#define ZSTD_MEMORY_LIMIT_DEFAULT (64 * 1024 * 1024)
+
 static CLG_LogRef LOG = {"blo.writefile"};
 
 /** Use if we want to store how many bytes have been written to the file. */
@@ -212,8 +220,15 @@ class ZstdWriteWrap : public WriteWrap {
 
   bool write_error = false;
 
+  /** Limit for the memory used by in-flight tasks, see #ZSTD_MEMORY_LIMIT_DEFAULT. */
+  size_t memory_limit;
+
  public:
-  ZstdWriteWrap(WriteWrap &base_wrap) : base_wrap(base_wrap) {}
+  ZstdWriteWrap(WriteWrap &base_wrap, const size_t memory_limit)
+      : base_wrap(base_wrap),
+        memory_limit(memory_limit ? memory_limit : size_t(ZSTD_MEMORY_LIMIT_DEFAULT))
+  {
+  }
 
   bool open(const char *filepath) override;
   bool close() override;
@@ -222,6 +237,7 @@ class ZstdWriteWrap : public WriteWrap {
  private:
   struct ZstdWriteBlockTask;
   void write_task(ZstdWriteBlockTask *task);
+  void write_frame(const void *buf, size_t buf_len);
   void write_u32_le(uint32_t val);
   void write_seekable_frames();
 };
@@ -286,8 +302,12 @@ bool ZstdWriteWrap::open(const char *filepath)
     return false;
   }
 
-  /* Leave one thread open for the main writing logic, unless we only have one HW thread. */
-  int num_threads = max_ii(1, BLI_system_thread_count() - 1);
+  /* Leave one thread open for the main writing logic, unless we only have one HW thread.
+   * Every thread holds at most one frame and its compressed output. When all threads are busy,
+   * writing waits for the oldest task, which bounds the memory used. */
+  const int max_tasks = int(
+      std::max<size_t>(1, memory_limit / (2 * size_t(ZSTD_compressBound(ZSTD_BUFFER_SIZE)))));
+  int num_threads = std::min(max_ii(1, BLI_system_thread_count() - 1), max_tasks);
   BLI_threadpool_init(&threadpool, ZstdWriteBlockTask::write_task, num_threads);
   BLI_mutex_init(&mutex);
   BLI_condition_init(&condition);
@@ -356,6 +376,20 @@ bool ZstdWriteWrap::write(const void *buf, size_t buf_len)
     return false;
   }
 
+  /* Split large writes, to bound the size of the copies and compression buffers. */
+  const char *data = static_cast<const char *>(buf);
+  while (buf_len > 0) {
+    const size_t frame_len = std::min<size_t>(buf_len, ZSTD_BUFFER_SIZE);
+    write_frame(data, frame_len);
+    data += frame_len;
+    buf_len -= frame_len;
+  }
+
+  return true;
+}
+
+void ZstdWriteWrap::write_frame(const void *buf, size_t buf_len)
+{
   ZstdWriteBlockTask *task = static_cast<ZstdWriteBlockTask *>(
       MEM_mallocN(sizeof(ZstdWriteBlockTask), __func__));
   task->data = MEM_mallocN(buf_len, __func__);
@@ -383,8 +417,6 @@ bool ZstdWriteWrap::write(const void *buf, size_t buf_len)
     MEM_freeN(first_task);
   }
   BLI_threadpool_insert(&threadpool, task);
-
-  return true;
 }
 
 /** \} */
@@ -1637,7 +1669,7 @@ bool BLO_write_file(Main *mainvar,
   RawWriteWrap raw_wrap;
 
   if (write_flags & G_FILE_COMPRESS) {
-    ZstdWriteWrap zstd_wrap(raw_wrap);
+    ZstdWriteWrap zstd_wrap(raw_wrap, params->compress_memory_limit);
     return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, zstd_wrap);
   }
 
@@ -13,6 +13,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
 #include "BLI_heap.h"
 #include "BLI_linklist.h"
 #include "BLI_math_geom.h"
@@ -21,6 +22,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_quadric.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines_stack.h"
 
 #include "BKE_customdata.hh"
@@ -227,19 +229,24 @@ static float bm_decim_build_edge_cost_single__topology(BMEdge *e)
 
 #endif /* USE_TOPOLOGY_FALLBACK */
 
-static void bm_decim_build_edge_cost_single(BMEdge *e,
-                                            const Quadric *vquadrics,
-                                            const float *vweights,
-                                            const float vweight_factor,
-                                            Heap *eheap,
-                                            HeapNode **eheap_table)
+/**
+ * Calculate the collapse cost of an edge. Only reads the mesh, so it can be used from multiple
+ * threads.
+ *
+ * \return false when the edge should not be collapsed.
+ */
+static bool bm_decim_calc_edge_cost(BMEdge *e,
+                                    const Quadric *vquadrics,
+                                    const float *vweights,
+                                    const float vweight_factor,
+                                    float *r_cost)
 {
   float cost;
 
   if (UNLIKELY(vweights && ((vweights[BM_elem_index_get(e->v1)] == 0.0f) ||
                             (vweights[BM_elem_index_get(e->v2)] == 0.0f))))
   {
-    goto clear;
+    return false;
   }
 
   /* check we can collapse, some edges we better not touch */
@@ -249,7 +256,7 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* only collapse tri's */
-      goto clear;
+      return false;
     }
   }
   else if (BM_edge_is_manifold(e)) {
@@ -258,11 +265,11 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* only collapse tri's */
-      goto clear;
+      return false;
     }
   }
   else {
-    goto clear;
+    return false;
   }
   /* end sanity check */
 
@@ -315,16 +322,38 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
   }
 
-  BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
-  return;
+  *r_cost = cost;
+  return true;
+}
 
-clear:
+static void bm_decim_edge_cost_apply(BMEdge *e,
+                                     const bool can_collapse,
+                                     const float cost,
+                                     Heap *eheap,
+                                     HeapNode **eheap_table)
+{
+  if (can_collapse) {
+    BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
+    return;
+  }
   if (eheap_table[BM_elem_index_get(e)]) {
     BLI_heap_remove(eheap, eheap_table[BM_elem_index_get(e)]);
   }
   eheap_table[BM_elem_index_get(e)] = nullptr;
 }
 
+static void bm_decim_build_edge_cost_single(BMEdge *e,
+                                            const Quadric *vquadrics,
+                                            const float *vweights,
+                                            const float vweight_factor,
+                                            Heap *eheap,
+                                            HeapNode **eheap_table)
+{
+  float cost = 0.0f;
+  const bool can_collapse = bm_decim_calc_edge_cost(e, vquadrics, vweights, vweight_factor, &cost);
+  bm_decim_edge_cost_apply(e, can_collapse, cost, eheap, eheap_table);
+}
+
 /* use this for degenerate cases - add back to the heap with an invalid cost,
  * this way it may be calculated again if surrounding geometry changes */
 static void bm_decim_invalid_edge_cost_single(BMEdge *e, Heap *eheap, HeapNode **eheap_table)
@@ -340,14 +369,26 @@ static void bm_decim_build_edge_cost(BMesh *bm,
                                      Heap *eheap,
                                      HeapNode **eheap_table)
 {
-  BMIter iter;
-  BMEdge *e;
-  uint i;
+  using namespace blender;
+  BM_mesh_elem_table_ensure(bm, BM_EDGE);
+
+  /* The costs only depend on the initial mesh, so they are calculated in parallel. They are added
+   * to the heap in the order of the edges afterwards, so that the result does not depend on the
+   * threading. */
+  Array<float> costs(bm->totedge);
+  Array<bool> can_collapse(bm->totedge);
+  threading::parallel_for(IndexRange(bm->totedge), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      can_collapse[i] = bm_decim_calc_edge_cost(
+          BM_edge_at_index(bm, i), vquadrics, vweights, vweight_factor, &costs[i]);
+    }
+  });
 
-  BM_ITER_MESH_INDEX (e, &iter, bm, BM_EDGES_OF_MESH, i) {
+  for (const int i : IndexRange(bm->totedge)) {
     /* keep sanity check happy */
     eheap_table[i] = nullptr;
-    bm_decim_build_edge_cost_single(e, vquadrics, vweights, vweight_factor, eheap, eheap_table);
+    bm_decim_edge_cost_apply(
+        BM_edge_at_index(bm, i), can_collapse[i], costs[i], eheap, eheap_table);
   }
 }
 
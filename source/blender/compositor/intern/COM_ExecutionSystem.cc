@@ -107,9 +107,11 @@ void ExecutionSystem::execute_work(const rcti &work_rect,
     return;
   }
 
-  /* Split work vertically to maximize continuous memory. */
+  /* Split work vertically to maximize continuous memory. Use more sub-works than threads so
+   * threads that finish early on cheap rows can pick remaining work instead of idling. */
+  constexpr int sub_works_per_thread = 4;
   const int work_height = BLI_rcti_size_y(&work_rect);
-  const int num_sub_works = std::min(num_work_threads_, work_height);
+  const int num_sub_works = std::min(num_work_threads_ * sub_works_per_thread, work_height);
   const int split_height = num_sub_works == 0 ? 0 : work_height / num_sub_works;
   int remaining_height = work_height - split_height * num_sub_works;
 
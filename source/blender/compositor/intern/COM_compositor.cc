@@ -10,6 +10,9 @@
 #include "BKE_node_runtime.hh"
 #include "BKE_scene.h"
 
+#include "GPU_capabilities.h"
+
+#include "COM_DenoiseOperation.h"
 #include "COM_ExecutionSystem.h"
 #include "COM_WorkScheduler.h"
 #include "COM_compositor.hh"
@@ -49,6 +52,21 @@ static void compositor_reset_node_tree_status(bNodeTree *node_tree)
   node_tree->runtime->stats_draw(node_tree->runtime->sdh, IFACE_("Compositing"));
 }
 
+/* The realtime compositor stores every result in a single texture, fall back to the CPU
+ * compositor for resolutions larger than what the GPU supports. */
+static bool compositor_fits_gpu_textures(const RenderData *render_data)
+{
+  const int max_texture_size = GPU_max_texture_size();
+  if (max_texture_size == 0) {
+    /* The GPU capabilities are only known once a GPU backend was initialized, which happens
+     * lazily for background renders. Don't force the CPU compositor when the limit is unknown. */
+    return true;
+  }
+  int width, height;
+  BKE_render_resolution(render_data, false, &width, &height);
+  return width <= max_texture_size && height <= max_texture_size;
+}
+
 void COM_execute(Render *render,
                  RenderData *render_data,
                  Scene *scene,
@@ -77,7 +95,8 @@ void COM_execute(Render *render,
   compositor_reset_node_tree_status(node_tree);
 
   if (U.experimental.use_full_frame_compositor &&
-      node_tree->execution_mode == NTREE_EXECUTION_MODE_REALTIME)
+      node_tree->execution_mode == NTREE_EXECUTION_MODE_REALTIME &&
+      compositor_fits_gpu_textures(render_data))
   {
     /* Realtime GPU compositor. */
     RE_compositor_execute(*render, *scene, *render_data, *node_tree, rendering, view_name);
@@ -108,6 +127,11 @@ void COM_execute(Render *render,
     system.execute();
   }
 
+  if (rendering) {
+    /* Cached denoise results only help while editing, don't keep them after a render. */
+    blender::compositor::COM_denoise_cache_free();
+  }
+
   BLI_mutex_unlock(&g_compositor.mutex);
 }
 
@@ -116,6 +140,7 @@ void COM_deinitialize()
   if (g_compositor.is_initialized) {
     BLI_mutex_lock(&g_compositor.mutex);
     blender::compositor::WorkScheduler::deinitialize();
+    blender::compositor::COM_denoise_cache_free();
     g_compositor.is_initialized = false;
     BLI_mutex_unlock(&g_compositor.mutex);
     BLI_mutex_end(&g_compositor.mutex);
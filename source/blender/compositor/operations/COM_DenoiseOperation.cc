@@ -2,16 +2,129 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <array>
+#include <cstring>
+#include <string>
+
 #include "COM_DenoiseOperation.h"
+#include "BLI_array.hh"
+#include "BLI_hash_md5.h"
 #include "BLI_system.h"
+#include "BLI_struct_equality_utils.hh"
+#include "BLI_task.hh"
+#include "BLI_threads.h"
+#include "BLI_vector.hh"
 #ifdef WITH_OPENIMAGEDENOISE
-#  include "BLI_threads.h"
 #  include <OpenImageDenoise/oidn.hpp>
 static pthread_mutex_t oidn_lock = BLI_MUTEX_INITIALIZER;
 #endif
 
 namespace blender::compositor {
 
+/* Results of the latest denoise executions. The compositor re-executes the whole node tree on
+ * every edit, so this avoids running the denoiser again when only nodes after it changed. */
+
+/** Identifies the content of one denoiser input, a digest of all its pixels and its size. */
+struct DenoiseInputKey {
+  int width = 0;
+  int height = 0;
+  int num_channels = 0;
+  std::array<uint8_t, 16> digest = {};
+
+  BLI_STRUCT_EQUALITY_OPERATORS_4(DenoiseInputKey, width, height, num_channels, digest)
+};
+
+struct DenoiseCacheKey {
+  std::array<DenoiseInputKey, 3> inputs;
+  int hdr = -1;
+  int clean_aux = -1;
+  std::string image_name;
+
+  BLI_STRUCT_EQUALITY_OPERATORS_4(DenoiseCacheKey, inputs, hdr, clean_aux, image_name)
+};
+
+struct DenoiseCacheEntry {
+  DenoiseCacheKey key;
+  Array<float> result;
+};
+static Vector<DenoiseCacheEntry> denoise_cache;
+static ThreadMutex denoise_cache_lock = BLI_MUTEX_INITIALIZER;
+/* Enough for the color, albedo and normal passes of a prefiltered denoise node. */
+static constexpr int64_t denoise_cache_max_entries = 3;
+/* Results larger than this are not cached, to avoid keeping huge buffers alive. */
+static constexpr int64_t denoise_cache_max_entry_bytes = int64_t(512) * 1024 * 1024;
+
+static int64_t denoise_buffer_size(MemoryBuffer *buffer)
+{
+  return int64_t(buffer->get_width()) * buffer->get_height() * buffer->get_num_channels();
+}
+
+static DenoiseInputKey denoise_input_key(MemoryBuffer *buffer)
+{
+  DenoiseInputKey key;
+  if (buffer == nullptr) {
+    return key;
+  }
+  key.width = buffer->get_width();
+  key.height = buffer->get_height();
+  key.num_channels = buffer->get_num_channels();
+
+  /* Compute the MD5 digest of parallel chunks, the input passes can be large. The digest of
+   * the input is the digest of all chunk digests. */
+  constexpr int64_t chunk_size = 1 << 20;
+  const Span<float> data(buffer->get_buffer(), denoise_buffer_size(buffer));
+  Array<std::array<uint8_t, 16>> chunk_digests((data.size() + chunk_size - 1) / chunk_size);
+  threading::parallel_for(chunk_digests.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const Span<float> chunk = data.slice_safe(i * chunk_size, chunk_size);
+      BLI_hash_md5_buffer(reinterpret_cast<const char *>(chunk.data()),
+                          size_t(chunk.size_in_bytes()),
+                          chunk_digests[i].data());
+    }
+  });
+  BLI_hash_md5_buffer(reinterpret_cast<const char *>(chunk_digests.data()),
+                      size_t(chunk_digests.as_span().size_in_bytes()),
+                      key.digest.data());
+  return key;
+}
+
+/** Copy the cached result for the given key into the output, returns false if there is none. */
+static bool denoise_cache_lookup(const DenoiseCacheKey &key, MemoryBuffer *output)
+{
+  BLI_mutex_lock(&denoise_cache_lock);
+  bool found = false;
+  for (const DenoiseCacheEntry &entry : denoise_cache) {
+    if (entry.key == key && entry.result.size() == denoise_buffer_size(output)) {
+      memcpy(output->get_buffer(), entry.result.data(), entry.result.as_span().size_in_bytes());
+      found = true;
+      break;
+    }
+  }
+  BLI_mutex_unlock(&denoise_cache_lock);
+  return found;
+}
+
+static void denoise_cache_add(const DenoiseCacheKey &key, MemoryBuffer *output)
+{
+  if (denoise_buffer_size(output) * int64_t(sizeof(float)) > denoise_cache_max_entry_bytes) {
+    return;
+  }
+  BLI_mutex_lock(&denoise_cache_lock);
+  if (denoise_cache.size() == denoise_cache_max_entries) {
+    denoise_cache.remove(0);
+  }
+  denoise_cache.append(
+      {key, Array<float>(Span<float>(output->get_buffer(), denoise_buffer_size(output)))});
+  BLI_mutex_unlock(&denoise_cache_lock);
+}
+
+void COM_denoise_cache_free()
+{
+  BLI_mutex_lock(&denoise_cache_lock);
+  denoise_cache.clear_and_shrink();
+  BLI_mutex_unlock(&denoise_cache_lock);
+}
+
 bool COM_is_denoise_supported()
 {
 #ifdef WITH_OPENIMAGEDENOISE
@@ -209,25 +322,37 @@ void DenoiseOperation::generate_denoise(MemoryBuffer *output,
                                  input_albedo->inflate() :
                                  input_albedo;
 
-  DenoiseFilter filter;
-  filter.init_and_lock_denoiser(output);
-
-  filter.set_image("color", buf_color);
-  filter.set_image("normal", buf_normal);
-  filter.set_image("albedo", buf_albedo);
-
-  BLI_assert(settings);
+  DenoiseCacheKey cache_key;
+  cache_key.inputs = {
+      denoise_input_key(buf_color), denoise_input_key(buf_normal), denoise_input_key(buf_albedo)};
   if (settings) {
-    filter.set("hdr", settings->hdr);
-    filter.set("srgb", false);
-    filter.set("cleanAux", are_guiding_passes_noise_free(settings));
+    cache_key.hdr = int(settings->hdr);
+    cache_key.clean_aux = int(are_guiding_passes_noise_free(settings));
   }
 
-  filter.execute();
-  filter.deinit_and_unlock_denoiser();
+  if (!denoise_cache_lookup(cache_key, output)) {
+    DenoiseFilter filter;
+    filter.init_and_lock_denoiser(output);
+
+    filter.set_image("color", buf_color);
+    filter.set_image("normal", buf_normal);
+    filter.set_image("albedo", buf_albedo);
+
+    BLI_assert(settings);
+    if (settings) {
+      filter.set("hdr", settings->hdr);
+      filter.set("srgb", false);
+      filter.set("cleanAux", are_guiding_passes_noise_free(settings));
+    }
 
-  /* Copy the alpha channel, OpenImageDenoise currently only supports RGB. */
-  output->copy_from(input_color, input_color->get_rect(), 3, COM_DATA_TYPE_VALUE_CHANNELS, 3);
+    filter.execute();
+    filter.deinit_and_unlock_denoiser();
+
+    /* Copy the alpha channel, OpenImageDenoise currently only supports RGB. */
+    output->copy_from(input_color, input_color->get_rect(), 3, COM_DATA_TYPE_VALUE_CHANNELS, 3);
+
+    denoise_cache_add(cache_key, output);
+  }
 
   /* Delete inflated buffers. */
   if (input_color->is_a_single_elem()) {
@@ -282,11 +407,18 @@ void DenoisePrefilterOperation::generate_denoise(MemoryBuffer *output, MemoryBuf
   /* Denoising needs full buffers. */
   MemoryBuffer *input_buf = input->is_a_single_elem() ? input->inflate() : input;
 
-  DenoiseFilter filter;
-  filter.init_and_lock_denoiser(output);
-  filter.set_image(image_name_, input_buf);
-  filter.execute();
-  filter.deinit_and_unlock_denoiser();
+  DenoiseCacheKey cache_key;
+  cache_key.inputs[0] = denoise_input_key(input_buf);
+  cache_key.image_name = image_name_;
+  if (!denoise_cache_lookup(cache_key, output)) {
+    DenoiseFilter filter;
+    filter.init_and_lock_denoiser(output);
+    filter.set_image(image_name_, input_buf);
+    filter.execute();
+    filter.deinit_and_unlock_denoiser();
+
+    denoise_cache_add(cache_key, output);
+  }
 
   /* Delete inflated buffers. */
   if (input->is_a_single_elem()) {
@@ -10,6 +10,8 @@
 namespace blender::compositor {
 
 bool COM_is_denoise_supported();
+/** Free the results kept to avoid denoising unchanged inputs again on the next execution. */
+void COM_denoise_cache_free();
 
 class DenoiseBaseOperation : public SingleThreadedOperation {
  protected:
@@ -50,6 +50,13 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/**
+ * Write per-operation begin and end times of the last evaluation of the graph in the Chrome
+ * trace event format. The timeline is only recorded when time debugging is enabled
+ * (`--debug-depsgraph-time`).
+ */
+void DEG_debug_eval_timeline_chrome_trace(const Depsgraph *graph, FILE *fp);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
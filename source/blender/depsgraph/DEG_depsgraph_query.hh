@@ -31,6 +31,10 @@ struct PointerRNA;
 struct Scene;
 struct ViewLayer;
 struct ViewerPath;
+namespace blender::bke {
+class GeometryNodesSharedEvaluations;
+class ObjectFrameCache;
+}
 
 /* -------------------------------------------------------------------- */
 /** \name DEG input data
@@ -51,6 +55,16 @@ eEvaluationMode DEG_get_mode(const Depsgraph *graph);
 /** Get time that depsgraph is being evaluated or was last evaluated at. */
 float DEG_get_ctime(const Depsgraph *graph);
 
+/** Get the cache of evaluated object geometry per frame, null when frame caching is disabled. */
+blender::bke::ObjectFrameCache *DEG_get_object_frame_cache(const Depsgraph *graph);
+
+/**
+ * Get the storage for geometry nodes modifier results that are shared between objects during the
+ * current evaluation, null when sharing is disabled.
+ */
+blender::bke::GeometryNodesSharedEvaluations *DEG_get_geometry_nodes_shared_evaluations(
+    const Depsgraph *graph);
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
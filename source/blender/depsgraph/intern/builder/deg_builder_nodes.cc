@@ -378,6 +378,8 @@ void DepsgraphNodeBuilder::begin_build()
 {
   /* Store existing copy-on-write versions of datablock, so we can re-use
    * them for new ID nodes. */
+  const int64_t num_previous_id_nodes = graph_->id_nodes.size();
+  id_info_hash_.reserve(num_previous_id_nodes);
   for (IDNode *id_node : graph_->id_nodes) {
     /* It is possible that the ID does not need to have CoW version in which case id_cow is the
      * same as id_orig. Additionally, such ID might have been removed, which makes the check
@@ -409,6 +411,11 @@ void DepsgraphNodeBuilder::begin_build()
   graph_->clear_all_nodes();
   graph_->operations.clear();
   graph_->entry_tags.clear();
+
+  /* Relations rebuild mostly re-creates the same set of IDs, so size the lookup for the previous
+   * graph upfront instead of growing it one re-hash at a time. The ID nodes and operations vectors
+   * keep their capacity across the clear already. */
+  graph_->id_hash.reserve(num_previous_id_nodes);
 }
 
 /* Util callbacks for `BKE_library_foreach_ID_link`, used to detect when a COW ID is using ID
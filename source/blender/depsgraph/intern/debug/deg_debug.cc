@@ -8,6 +8,8 @@
 
 #include "intern/debug/deg_debug.h"
 
+#include <thread>
+
 #include "BLI_console.h"
 #include "BLI_hash.h"
 #include "BLI_string.h"
@@ -18,6 +20,7 @@
 #include "BKE_global.h"
 
 #include "intern/depsgraph.hh"
+#include "intern/node/deg_node_operation.hh"
 
 namespace blender::deg {
 
@@ -37,6 +40,7 @@ void DepsgraphDebug::begin_graph_evaluation()
   const double current_time = PIL_check_seconds_timer();
 
   graph_evaluation_start_time_ = current_time;
+  timeline.clear();
 }
 
 void DepsgraphDebug::end_graph_evaluation()
@@ -48,6 +52,13 @@ void DepsgraphDebug::end_graph_evaluation()
   const double graph_eval_end_time = PIL_check_seconds_timer();
   const double graph_eval_time = graph_eval_end_time - graph_evaluation_start_time_;
 
+  for (TimelineEvent &event : timeline) {
+    event.name = event.operation_node->full_identifier();
+    event.operation_node = nullptr;
+    event.begin_time -= graph_evaluation_start_time_;
+    event.end_time -= graph_evaluation_start_time_;
+  }
+
   if (name.empty()) {
     printf("Depsgraph updated in %f seconds.\n", graph_eval_time);
   }
@@ -56,6 +67,15 @@ void DepsgraphDebug::end_graph_evaluation()
   }
 }
 
+void DepsgraphDebug::add_timeline_event(const OperationNode *operation_node,
+                                        const double begin_time,
+                                        const double end_time)
+{
+  const size_t thread_id = std::hash<std::thread::id>()(std::this_thread::get_id());
+  std::lock_guard<std::mutex> lock{timeline_mutex_};
+  timeline.append({operation_node, "", begin_time, end_time, thread_id});
+}
+
 bool terminal_do_color()
 {
   return (G.debug & G_DEBUG_DEPSGRAPH_PRETTY) != 0;
@@ -8,16 +8,35 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "intern/depsgraph_type.hh"
 
+#include "BLI_vector.hh"
+
 #include "BKE_global.h"
 
 #include "DEG_depsgraph_debug.hh"
 
 namespace blender::deg {
 
+struct OperationNode;
+
 class DepsgraphDebug {
  public:
+  /* Single operation evaluation as seen by the timeline. */
+  struct TimelineEvent {
+    /* Only valid while the graph is being evaluated, replaced by the name afterwards since the
+     * node might be freed by a relations update before the timeline is exported. */
+    const OperationNode *operation_node;
+    string name;
+    /* Time in seconds since the beginning of the graph evaluation. */
+    double begin_time;
+    double end_time;
+    /* Hash of the thread which evaluated the operation. */
+    size_t thread_id;
+  };
+
   DepsgraphDebug();
 
   bool do_time_debug() const;
@@ -25,6 +44,12 @@ class DepsgraphDebug {
   void begin_graph_evaluation();
   void end_graph_evaluation();
 
+  /* Record evaluation of the operation for the timeline, times are absolute as returned from
+   * #PIL_check_seconds_timer. Is safe to be called from multiple threads. */
+  void add_timeline_event(const OperationNode *operation_node,
+                          double begin_time,
+                          double end_time);
+
   /* NOTE: Corresponds to G_DEBUG_DEPSGRAPH_* flags. */
   int flags;
 
@@ -32,6 +57,10 @@ class DepsgraphDebug {
    * created for different view layer). */
   string name;
 
+  /* Operations evaluated during the last graph evaluation, in the order they finished.
+   * Only gathered when time debug is enabled. */
+  Vector<TimelineEvent> timeline;
+
  protected:
   /* Maximum number of counters used to calculate frame rate of depsgraph update. */
   static const constexpr int MAX_FPS_COUNTERS = 64;
@@ -40,6 +69,8 @@ class DepsgraphDebug {
    * Is initialized from begin_graph_evaluation() when time debug is enabled.
    */
   double graph_evaluation_start_time_;
+
+  std::mutex timeline_mutex_;
 };
 
 #define DEG_DEBUG_PRINTF(depsgraph, type, ...) \
@@ -0,0 +1,79 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ *
+ * Export of the evaluation timeline in the Chrome trace event format, which can be inspected
+ * with `chrome://tracing` or https://ui.perfetto.dev.
+ */
+
+#include "DEG_depsgraph_debug.hh"
+
+#include "BLI_map.hh"
+
+#include "intern/debug/deg_debug.h"
+#include "intern/depsgraph.hh"
+
+namespace deg = blender::deg;
+
+namespace blender::deg {
+namespace {
+
+void write_json_string(FILE *fp, const string &str)
+{
+  fputc('"', fp);
+  for (const char c : str) {
+    if (c == '"' || c == '\\') {
+      fputc('\\', fp);
+      fputc(c, fp);
+    }
+    else if (uchar(c) < 0x20) {
+      fprintf(fp, "\\u%04x", uchar(c));
+    }
+    else {
+      fputc(c, fp);
+    }
+  }
+  fputc('"', fp);
+}
+
+void deg_debug_eval_timeline_chrome_trace(const Depsgraph *graph, FILE *fp)
+{
+  /* Map thread hashes to small sequential numbers, which are easier to read in the viewer. */
+  Map<size_t, int> thread_indices;
+
+  fprintf(fp, "{\"traceEvents\":[\n");
+  bool is_first = true;
+  for (const DepsgraphDebug::TimelineEvent &event : graph->debug.timeline) {
+    const int thread_index = thread_indices.lookup_or_add(event.thread_id,
+                                                          int(thread_indices.size()));
+    if (!is_first) {
+      fprintf(fp, ",\n");
+    }
+    is_first = false;
+    fprintf(fp, "{\"name\":");
+    write_json_string(fp, event.name);
+    /* Times are in microseconds. */
+    fprintf(fp,
+            ",\"cat\":\"depsgraph\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":0,\"tid\":%d}",
+            event.begin_time * 1e6,
+            (event.end_time - event.begin_time) * 1e6,
+            thread_index);
+  }
+  fprintf(fp, "\n],\n\"displayTimeUnit\":\"ms\",\n\"otherData\":{\"depsgraph\":");
+  write_json_string(fp, graph->debug.name);
+  fprintf(fp, "}}\n");
+}
+
+}  // namespace
+}  // namespace blender::deg
+
+void DEG_debug_eval_timeline_chrome_trace(const Depsgraph *graph, FILE *fp)
+{
+  if (graph == nullptr) {
+    return;
+  }
+  deg::deg_debug_eval_timeline_chrome_trace(reinterpret_cast<const deg::Depsgraph *>(graph), fp);
+}
@@ -22,6 +22,9 @@
 
 #include "BLI_threads.h" /* for SpinLock */
 
+#include "BKE_geometry_nodes_shared_evaluation.hh"
+#include "BKE_object_frame_cache.hh"
+
 #include "DEG_depsgraph.hh"
 #include "DEG_depsgraph_physics.hh"
 
@@ -171,6 +174,15 @@ struct Depsgraph {
 
   light_linking::Cache light_linking_cache;
 
+  /* Evaluated geometry of previously evaluated frames. Only allocated for the active viewport
+   * dependency graph when the experimental frame cache is enabled. Cleared on any update which is
+   * not caused by a time change. */
+  std::unique_ptr<bke::ObjectFrameCache> object_frame_cache;
+
+  /* Results of geometry nodes modifiers that are shared between objects. Only allocated when the
+   * experimental option is enabled. Cleared after every evaluation. */
+  std::unique_ptr<bke::GeometryNodesSharedEvaluations> geometry_nodes_shared_evaluations;
+
   MEM_CXX_CLASS_ALLOC_FUNCS("Depsgraph");
 };
 
@@ -109,6 +109,19 @@ float DEG_get_ctime(const Depsgraph *graph)
   return deg_graph->ctime;
 }
 
+blender::bke::ObjectFrameCache *DEG_get_object_frame_cache(const Depsgraph *graph)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
+  return deg_graph->object_frame_cache.get();
+}
+
+blender::bke::GeometryNodesSharedEvaluations *DEG_get_geometry_nodes_shared_evaluations(
+    const Depsgraph *graph)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
+  return deg_graph->geometry_nodes_shared_evaluations.get();
+}
+
 bool DEG_id_type_updated(const Depsgraph *graph, short id_type)
 {
   const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
@@ -641,6 +641,29 @@ void id_tag_update(Main *bmain, ID *id, uint flags, eUpdateSource update_source)
   id->recalc_after_undo_push |= deg_recalc_flags_effective(nullptr, flags);
 }
 
+/* Cached frames stay valid as long as nothing but the time changes. Be conservative and consider
+ * everything which is not known to be unrelated to evaluated geometry as an invalidating change. */
+static void graph_object_frame_cache_invalidate_if_needed(Depsgraph *graph,
+                                                          const uint flags,
+                                                          const eUpdateSource update_source)
+{
+  if (!graph->object_frame_cache) {
+    return;
+  }
+  if (!ELEM(update_source, DEG_UPDATE_SOURCE_USER_EDIT, DEG_UPDATE_SOURCE_RELATIONS)) {
+    return;
+  }
+  const uint unrelated_flags = ID_RECALC_SELECT | ID_RECALC_BASE_FLAGS | ID_RECALC_SHADING |
+                               ID_RECALC_EDITORS | ID_RECALC_FRAME_CHANGE |
+                               ID_RECALC_SEQUENCER_STRIPS | ID_RECALC_AUDIO_FPS |
+                               ID_RECALC_AUDIO_VOLUME | ID_RECALC_AUDIO_MUTE |
+                               ID_RECALC_AUDIO_LISTENER | ID_RECALC_AUDIO;
+  if (flags != 0 && (flags & ~unrelated_flags) == 0) {
+    return;
+  }
+  graph->object_frame_cache->clear();
+}
+
 void graph_id_tag_update(
     Main *bmain, Depsgraph *graph, ID *id, uint flags, eUpdateSource update_source)
 {
@@ -661,6 +684,7 @@ void graph_id_tag_update(
   IDNode *id_node = (graph != nullptr) ? graph->find_id_node(id) : nullptr;
   if (graph != nullptr) {
     DEG_graph_id_type_tag(reinterpret_cast<::Depsgraph *>(graph), GS(id->name));
+    graph_object_frame_cache_invalidate_if_needed(graph, flags, update_source);
   }
   if (flags == 0) {
     deg_graph_node_tag_zero(bmain, graph, id_node, update_source);
@@ -10,6 +10,8 @@
 
 #include "intern/eval/deg_eval.h"
 
+#include <algorithm>
+
 #include "PIL_time.h"
 
 #include "BLI_compiler_attrs.h"
@@ -17,12 +19,14 @@
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.h"
 
 #include "DNA_node_types.h"
 #include "DNA_object_types.h"
 #include "DNA_scene_types.h"
+#include "DNA_userdef_types.h"
 
 #include "DEG_depsgraph.hh"
 #include "DEG_depsgraph_query.hh"
@@ -46,6 +50,29 @@
 #include "intern/node/deg_node_operation.hh"
 #include "intern/node/deg_node_time.hh"
 
+/**
+ * Measure the evaluation time of operations and prioritize the ones on the longest chain of
+ * dependent operations (based on the timings of previous evaluations), so that a long chain
+ * (e.g. rig, deform, heavy geometry nodes) doesn't start late while cheap operations keep all
+ * threads busy.
+ */
+#define USE_CRITICAL_PATH_SCHEDULING
+
+#ifdef USE_CRITICAL_PATH_SCHEDULING
+/**
+ * Evaluate operations which are known to be very cheap (e.g. transform flush) together in a
+ * single task, instead of paying the task scheduling overhead for each of them.
+ */
+#  define USE_OPERATION_BATCHING
+#endif
+
+#ifdef USE_OPERATION_BATCHING
+/** Operations estimated to take less than this many seconds are batched. */
+#  define OPERATION_BATCH_NODE_COST_MAX 1e-5f
+/** Maximum estimated time in seconds of the operations batched into a single task. */
+#  define OPERATION_BATCH_COST_MAX 2e-4f
+#endif
+
 namespace blender::deg {
 
 namespace {
@@ -53,6 +80,9 @@ namespace {
 struct DepsgraphEvalState;
 
 void deg_task_run_func(TaskPool *pool, void *taskdata);
+#ifdef USE_OPERATION_BATCHING
+void deg_task_run_batch_func(TaskPool *pool, void *taskdata);
+#endif
 
 void schedule_children(DepsgraphEvalState *state,
                        OperationNode *node,
@@ -93,14 +123,33 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
   /* Perform operation. */
+#ifdef USE_CRITICAL_PATH_SCHEDULING
+  {
+    const double start_time = PIL_check_seconds_timer();
+    operation_node->evaluate(depsgraph);
+    const double duration = PIL_check_seconds_timer() - start_time;
+    /* Average with previous evaluations, an operation is only evaluated by one thread at a time.
+     */
+    operation_node->eval_cost = (operation_node->eval_cost == 0.0f) ?
+                                    float(duration) :
+                                    0.5f * (operation_node->eval_cost + float(duration));
+    if (state->do_stats) {
+      operation_node->stats.current_time += duration;
+      state->graph->debug.add_timeline_event(operation_node, start_time, start_time + duration);
+    }
+  }
+#else
   if (state->do_stats) {
     const double start_time = PIL_check_seconds_timer();
     operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += PIL_check_seconds_timer() - start_time;
+    const double end_time = PIL_check_seconds_timer();
+    operation_node->stats.current_time += end_time - start_time;
+    state->graph->debug.add_timeline_event(operation_node, start_time, end_time);
   }
   else {
     operation_node->evaluate(depsgraph);
   }
+#endif
 
   /* Clear the flag early on, allowing partial updates without re-evaluating the same node multiple
    * times.
@@ -109,6 +158,79 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
   operation_node->flag &= ~DEPSOP_FLAG_CLEAR_ON_EVAL;
 }
 
+#ifdef USE_CRITICAL_PATH_SCHEDULING
+
+#  ifdef USE_OPERATION_BATCHING
+bool is_operation_node_cheap(const OperationNode *node)
+{
+  /* The cost is zero when the operation was never evaluated, so it's unknown. */
+  return node->eval_cost > 0.0f && node->eval_cost < OPERATION_BATCH_NODE_COST_MAX;
+}
+#  endif
+
+/**
+ * Evaluate the given operations and the operations which become ready to be evaluated by them.
+ * All children go through the task pool, except for the most expensive chain which is continued
+ * in this thread, and cheap operations which are batched.
+ */
+void evaluate_nodes_and_children(TaskPool *pool,
+                                 DepsgraphEvalState *state,
+                                 Vector<OperationNode *, 16> &queue)
+{
+#  ifdef USE_OPERATION_BATCHING
+  float batch_cost = 0.0f;
+#  endif
+  while (!queue.is_empty()) {
+    OperationNode *operation_node = queue.pop_last();
+    evaluate_node(state, operation_node);
+
+    OperationNode *next_node = nullptr;
+    schedule_children(state, operation_node, [&](OperationNode *node) {
+#  ifdef USE_OPERATION_BATCHING
+      /* Limit the batch size, to keep many cheap operations spread over threads. */
+      if (is_operation_node_cheap(node) &&
+          batch_cost + node->eval_cost < OPERATION_BATCH_COST_MAX)
+      {
+        batch_cost += node->eval_cost;
+        queue.append(node);
+        return;
+      }
+#  endif
+      if (next_node == nullptr) {
+        next_node = node;
+        return;
+      }
+      if (node->critical_path_cost > next_node->critical_path_cost) {
+        std::swap(node, next_node);
+      }
+      BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+    });
+    if (next_node != nullptr) {
+      queue.append(next_node);
+    }
+  }
+}
+
+#  ifdef USE_OPERATION_BATCHING
+struct OperationBatch {
+  Vector<OperationNode *, 16> nodes;
+};
+
+void deg_task_run_batch_func(TaskPool *pool, void *taskdata)
+{
+  DepsgraphEvalState *state = (DepsgraphEvalState *)BLI_task_pool_user_data(pool);
+  OperationBatch *batch = static_cast<OperationBatch *>(taskdata);
+  evaluate_nodes_and_children(pool, state, batch->nodes);
+}
+
+void operation_batch_free(TaskPool * /*pool*/, void *taskdata)
+{
+  MEM_delete(static_cast<OperationBatch *>(taskdata));
+}
+#  endif
+
+#endif
+
 void deg_task_run_func(TaskPool *pool, void *taskdata)
 {
   void *userdata_v = BLI_task_pool_user_data(pool);
@@ -116,19 +238,30 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
 
   /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
+#ifdef USE_CRITICAL_PATH_SCHEDULING
+  Vector<OperationNode *, 16> queue = {operation_node};
+  evaluate_nodes_and_children(pool, state, queue);
+#else
   evaluate_node(state, operation_node);
 
   /* Schedule children. */
   schedule_children(state, operation_node, [&](OperationNode *node) {
     BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
   });
+#endif
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
 {
   const ComponentNode *comp_node = op_node->owner;
   /* Special case for copy on write component: it is to be always evaluated, to keep copied
-   * "database" in a consistent state. */
+   * "database" in a consistent state.
+   *
+   * NOTE: This is also the reason IDs which are only pulled into the graph as dependencies (for
+   * example, a hidden object used as a driver target) are still copied in full. Their other
+   * components are only evaluated when they affect something visible, see
+   * #deg_graph_flush_visibility_flags(), but evaluated data-blocks are accessible from Python
+   * and editors regardless of visibility, so skipping the expansion is not an option. */
   if (comp_node->type == NodeType::COPY_ON_WRITE) {
     return true;
   }
@@ -187,6 +320,66 @@ void calculate_pending_parents_if_needed(DepsgraphEvalState *state)
   state->need_update_pending_parents = false;
 }
 
+#ifdef USE_CRITICAL_PATH_SCHEDULING
+
+bool is_operation_node_pending(const DepsgraphEvalState *state, OperationNode *node)
+{
+  return check_operation_node_visible(state, node) && (node->flag & DEPSOP_FLAG_NEEDS_UPDATE);
+}
+
+/* Calculate #OperationNode.critical_path_cost for all operations which are to be evaluated, by
+ * visiting them in reverse topological order (children before parents). */
+void calculate_critical_path_costs(DepsgraphEvalState *state)
+{
+  Vector<OperationNode *> stack;
+
+  /* Use the custom flags as counter of children which have not been visited yet. */
+  for (OperationNode *node : state->graph->operations) {
+    node->custom_flags = 0;
+    if (!is_operation_node_pending(state, node)) {
+      continue;
+    }
+    for (Relation *rel : node->outlinks) {
+      OperationNode *child = (OperationNode *)rel->to;
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0 && is_operation_node_pending(state, child)) {
+        node->custom_flags++;
+      }
+    }
+    if (node->custom_flags == 0) {
+      stack.append(node);
+    }
+  }
+
+  while (!stack.is_empty()) {
+    OperationNode *node = stack.pop_last();
+
+    float children_cost = 0.0f;
+    for (Relation *rel : node->outlinks) {
+      OperationNode *child = (OperationNode *)rel->to;
+      if ((rel->flag & RELATION_FLAG_CYCLIC) == 0 && is_operation_node_pending(state, child)) {
+        children_cost = std::max(children_cost, child->critical_path_cost);
+      }
+    }
+    node->critical_path_cost = node->eval_cost + children_cost;
+
+    for (Relation *rel : node->inlinks) {
+      if (rel->from->type != NodeType::OPERATION || (rel->flag & RELATION_FLAG_CYCLIC)) {
+        continue;
+      }
+      OperationNode *parent = (OperationNode *)rel->from;
+      if (!is_operation_node_pending(state, parent)) {
+        continue;
+      }
+      BLI_assert(parent->custom_flags > 0);
+      if (--parent->custom_flags == 0) {
+        stack.append(parent);
+      }
+    }
+  }
+}
+
+#endif
+
 void initialize_execution(DepsgraphEvalState *state, Depsgraph *graph)
 {
   /* Clear tags and other things which needs to be clear. */
@@ -251,15 +444,21 @@ void schedule_node(DepsgraphEvalState *state,
   if ((node->flag & DEPSOP_FLAG_NEEDS_UPDATE) == 0) {
     return;
   }
-  /* TODO(sergey): This is not strictly speaking safe to read
-   * num_links_pending. */
+  /* Use the value returned by the atomic operation rather than reading the counter again: this
+   * way only the thread which evaluated the last pending parent continues with the node, and the
+   * other threads do not touch the `scheduled` flag at all, which avoids contention on wide
+   * graphs. */
+  uint32_t num_links_pending;
   if (dec_parents) {
     BLI_assert(node->num_links_pending > 0);
-    atomic_sub_and_fetch_uint32(&node->num_links_pending, 1);
+    num_links_pending = atomic_sub_and_fetch_uint32(&node->num_links_pending, 1);
+  }
+  else {
+    num_links_pending = node->num_links_pending;
   }
   /* Cal not schedule operation while its dependencies are not yet
    * evaluated. */
-  if (node->num_links_pending != 0) {
+  if (num_links_pending != 0) {
     return;
   }
   /* During the COW stage only schedule COW nodes. */
@@ -318,6 +517,52 @@ void evaluate_graph_threaded_stage(DepsgraphEvalState *state,
 
   calculate_pending_parents_if_needed(state);
 
+#ifdef USE_CRITICAL_PATH_SCHEDULING
+  if (stage == EvaluationStage::THREADED_EVALUATION) {
+    calculate_critical_path_costs(state);
+
+    /* Push the operations with the longest chains first, so they are picked up first. */
+    Vector<OperationNode *> nodes;
+    schedule_graph(state, [&](OperationNode *node) { nodes.append(node); });
+    std::stable_sort(nodes.begin(), nodes.end(), [](OperationNode *a, OperationNode *b) {
+      return a->critical_path_cost > b->critical_path_cost;
+    });
+#  ifdef USE_OPERATION_BATCHING
+    /* The pool may start running tasks right away, so only push batches once they are full. */
+    OperationBatch *batch = nullptr;
+    float batch_cost = 0.0f;
+    auto push_batch = [&]() {
+      if (batch != nullptr) {
+        BLI_task_pool_push(task_pool, deg_task_run_batch_func, batch, true, operation_batch_free);
+        batch = nullptr;
+        batch_cost = 0.0f;
+      }
+    };
+#  endif
+    for (OperationNode *node : nodes) {
+#  ifdef USE_OPERATION_BATCHING
+      if (is_operation_node_cheap(node)) {
+        if (batch != nullptr && batch_cost + node->eval_cost >= OPERATION_BATCH_COST_MAX) {
+          push_batch();
+        }
+        if (batch == nullptr) {
+          batch = MEM_new<OperationBatch>(__func__);
+        }
+        batch->nodes.append(node);
+        batch_cost += node->eval_cost;
+        continue;
+      }
+#  endif
+      BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
+    }
+#  ifdef USE_OPERATION_BATCHING
+    push_batch();
+#  endif
+    BLI_task_pool_work_and_wait(task_pool);
+    return;
+  }
+#endif
+
   schedule_graph(state, [&](OperationNode *node) {
     BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
   });
@@ -369,6 +614,29 @@ void depsgraph_ensure_view_layer(Depsgraph *graph)
   deg_update_copy_on_write_datablock(graph, scene_id_node);
 }
 
+void depsgraph_ensure_object_frame_cache(Depsgraph *graph)
+{
+  const bool use_cache = graph->is_active && graph->mode == DAG_EVAL_VIEWPORT &&
+                         USER_EXPERIMENTAL_TEST(&U, use_evaluated_frame_cache);
+  if (!use_cache) {
+    graph->object_frame_cache.reset();
+  }
+  else if (!graph->object_frame_cache) {
+    graph->object_frame_cache = std::make_unique<bke::ObjectFrameCache>();
+  }
+}
+
+void depsgraph_ensure_geometry_nodes_shared_evaluations(Depsgraph *graph)
+{
+  if (!USER_EXPERIMENTAL_TEST(&U, use_geometry_nodes_shared_evaluation)) {
+    graph->geometry_nodes_shared_evaluations.reset();
+  }
+  else if (!graph->geometry_nodes_shared_evaluations) {
+    graph->geometry_nodes_shared_evaluations =
+        std::make_unique<bke::GeometryNodesSharedEvaluations>();
+  }
+}
+
 TaskPool *deg_evaluate_task_pool_create(DepsgraphEvalState *state)
 {
   if (G.debug & G_DEBUG_DEPSGRAPH_NO_THREADS) {
@@ -396,6 +664,8 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
 
   graph->is_evaluating = true;
   depsgraph_ensure_view_layer(graph);
+  depsgraph_ensure_object_frame_cache(graph);
+  depsgraph_ensure_geometry_nodes_shared_evaluations(graph);
 
   /* Set up evaluation state. */
   DepsgraphEvalState state;
@@ -460,6 +730,11 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
   deg_graph_clear_tags(graph);
   graph->is_evaluating = false;
 
+  /* Other data that shared evaluations depend on may change before the next evaluation. */
+  if (graph->geometry_nodes_shared_evaluations) {
+    graph->geometry_nodes_shared_evaluations->clear();
+  }
+
 #ifdef WITH_PYTHON
   BPy_END_ALLOW_THREADS;
 #endif
@@ -265,7 +265,13 @@ struct ValidateData {
 };
 
 /* Similar to generic BKE_id_copy() but does not require main and assumes pointer
- * is already allocated. */
+ * is already allocated.
+ *
+ * NOTE: The cost of the copy is decided by the ID type's copy callback. Geometry stored in
+ * #CustomData and #CurvesGeometry (meshes, curves, point clouds, grease pencil drawings),
+ * volume grids and packed files are implicitly shared, so for those the copy is shallow until
+ * either side modifies the data. Data which is edited in place all over the code base (f-curve
+ * keyframes, shape key blocks, legacy grease pencil strokes) is still duplicated. */
 bool id_copy_inplace_no_main(const ID *id, ID *newid)
 {
   const ID *id_for_copy = id;
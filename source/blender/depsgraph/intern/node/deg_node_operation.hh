@@ -275,6 +275,13 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Estimated time in seconds it takes to evaluate this operation, averaged over previous
+   * evaluations. */
+  float eval_cost;
+  /* Estimated time of the longest chain of operations that depend on this one, including this
+   * operation itself. Used to evaluate operations on the critical path first. */
+  float critical_path_cost;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
@@ -195,6 +195,11 @@ void DRW_blender_gpu_render_context_disable(void *re_gpu_context);
 
 void DRW_deferred_shader_remove(struct GPUMaterial *mat);
 void DRW_deferred_shader_optimize_remove(struct GPUMaterial *mat);
+/**
+ * Move a queued material to the front of the compilation queue.
+ * Used by engines to compile first the materials that cover most of the view.
+ */
+void DRW_deferred_shader_prioritize(struct GPUMaterial *mat);
 
 /**
  * Get DrawData from the given ID-block. In order for this to work, we assume that
@@ -59,7 +59,20 @@ struct SELECTID_Context {
 
   /* To check for updates. */
   float persmat[4][4];
-  bool is_dirty(RegionView3D *rv3d);
+  /** Other view settings the drawn buffer depends on. */
+  struct {
+    int winx, winy;
+    int shading_flag;
+    float xray_alpha, xray_alpha_wire;
+    int overlay_edit_flag;
+    float retopology_offset;
+    short rflag;
+    char shading_type;
+    float clip[6][4];
+  } view_settings;
+
+  void view_settings_store(const ARegion *region, const View3D *v3d);
+  bool is_dirty(const ARegion *region, const View3D *v3d);
 };
 
 /* `draw_select_buffer.cc` */
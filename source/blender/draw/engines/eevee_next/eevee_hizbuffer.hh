@@ -93,6 +93,21 @@ class HiZBuffer {
   {
     pass.bind_texture(HIZ_TEX_SLOT, &hiz_tx_);
   }
+
+  /**
+   * Cull the objects hidden behind the content of the buffer in the next submissions using
+   * \a view. The buffer has to be up to date with the depth buffer the objects are tested
+   * against. Call #occlusion_culling_disable after the submissions.
+   */
+  void occlusion_culling_enable(View &view)
+  {
+    view.visibility_occlusion_test(hiz_tx_, data_.uv_scale);
+  }
+
+  void occlusion_culling_disable(View &view)
+  {
+    view.visibility_occlusion_test(nullptr);
+  }
 };
 
 /** \} */
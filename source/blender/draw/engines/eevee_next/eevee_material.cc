@@ -11,6 +11,7 @@
 #include "BKE_lib_id.h"
 #include "BKE_material.h"
 #include "BKE_node.hh"
+#include "BKE_object.hh"
 #include "NOD_shader.h"
 
 #include "eevee_instance.hh"
@@ -152,6 +153,41 @@ void MaterialModule::begin_sync()
 
   material_map_.clear();
   shader_map_.clear();
+  queued_coverage_.clear();
+}
+
+void MaterialModule::end_sync()
+{
+  if (queued_coverage_.is_empty()) {
+    return;
+  }
+  /* Only reorder a few of them as each move is a linear search inside the compilation queue. */
+  const int64_t max_prioritized = 16;
+
+  Vector<std::pair<float, GPUMaterial *>> queued;
+  for (const auto item : queued_coverage_.items()) {
+    queued.append({item.value, item.key});
+  }
+  std::sort(queued.begin(), queued.end(), [](const auto &a, const auto &b) {
+    return a.first < b.first;
+  });
+  /* Prioritize from least to most covering, so the largest ends up being compiled first. */
+  for (const int64_t i : queued.index_range().take_back(max_prioritized)) {
+    DRW_deferred_shader_prioritize(queued[i].second);
+  }
+}
+
+float MaterialModule::object_coverage_get(Object *ob)
+{
+  float3 dimensions;
+  BKE_object_dimensions_get(ob, dimensions);
+  const float radius_sqr = math::length_squared(dimensions) * 0.25f;
+  if (inst_.camera.is_orthographic()) {
+    return radius_sqr;
+  }
+  const float3 center = float4x4(ob->object_to_world).location();
+  const float dist_sqr = math::distance_squared(center, inst_.camera.position());
+  return radius_sqr / std::max(dist_sqr, radius_sqr);
 }
 
 MaterialPass MaterialModule::material_pass_get(Object *ob,
@@ -184,6 +220,7 @@ MaterialPass MaterialModule::material_pass_get(Object *ob,
     }
     case GPU_MAT_QUEUED:
       queued_shaders_count++;
+      queued_coverage_.lookup_or_add(matpass.gpumat, 0.0f) += object_coverage_get(ob);
       blender_mat = (is_volume) ? BKE_material_default_volume() : BKE_material_default_surface();
       matpass.gpumat = inst_.shaders.material_shader_get(
           blender_mat, blender_mat->nodetree, pipeline_type, geometry_type, false);
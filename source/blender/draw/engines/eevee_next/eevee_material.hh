@@ -315,11 +315,16 @@ class MaterialModule {
 
   ::Material *error_mat_;
 
+  /** Approximate view coverage of the objects using each material still being compiled. */
+  Map<GPUMaterial *, float> queued_coverage_;
+
  public:
   MaterialModule(Instance &inst);
   ~MaterialModule();
 
   void begin_sync();
+  /** Reorder the compilation queue so that shaders covering most of the view are ready first. */
+  void end_sync();
 
   /**
    * Returned Material references are valid until the next call to this function or material_get().
@@ -339,6 +344,8 @@ class MaterialModule {
 
   /** Return correct material or empty default material if slot is empty. */
   ::Material *material_from_slot(Object *ob, int slot);
+  /** Rough estimate of the fraction of the view covered by the object. */
+  float object_coverage_get(Object *ob);
   MaterialPass material_pass_get(Object *ob,
                                  ::Material *blender_mat,
                                  eMaterialPipeline pipeline_type,
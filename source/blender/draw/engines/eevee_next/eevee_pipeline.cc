@@ -601,6 +601,17 @@ void DeferredLayer::render(View &main_view,
   GPU_framebuffer_bind(prepass_fb);
   inst_.manager->submit(prepass_ps_, render_view);
 
+  /* Surfaces entirely behind the depth of the pre-pass can't produce any fragment in the G-buffer
+   * pass. The refraction tracing needs the Hi-Z of the surfaces behind the refractive ones, and
+   * the buffer only matches views that have the size of the render. */
+  const bool use_occlusion_culling = !do_screen_space_refraction &&
+                                     extent == inst_.film.render_extent_get();
+  if (use_occlusion_culling) {
+    inst_.hiz_buffer.set_dirty();
+    inst_.hiz_buffer.update();
+    inst_.hiz_buffer.occlusion_culling_enable(render_view);
+  }
+
   inst_.gbuffer.acquire(extent, closure_bits_);
 
   if (closure_bits_ & CLOSURE_AMBIENT_OCCLUSION) {
@@ -622,6 +633,10 @@ void DeferredLayer::render(View &main_view,
   GPU_framebuffer_bind(combined_fb);
   inst_.manager->submit(gbuffer_ps_, render_view);
 
+  if (use_occlusion_culling) {
+    inst_.hiz_buffer.occlusion_culling_disable(render_view);
+  }
+
   inst_.hiz_buffer.set_dirty();
 
   inst_.irradiance_cache.set_view(render_view);
@@ -906,7 +906,19 @@ void ShadowModule::sync_object(const Object *ob,
   ShadowObject &shadow_ob = objects_.lookup_or_add_default(handle.object_key);
   shadow_ob.used = true;
   const bool is_initialized = shadow_ob.resource_handle.raw != 0;
-  if ((handle.recalc != 0 || !is_initialized) && is_shadow_caster) {
+  const float4x4 object_to_world = float4x4(ob->object_to_world);
+
+  bool caster_updated = handle.recalc != 0 || !is_initialized;
+  /* Objects are often tagged for transform updates on every frame without actually moving (e.g.
+   * because of constraints or drivers). Keep the cached shadow pages of these static casters, so
+   * that only the pages touched by moving geometry are rendered again. */
+  const int transform_recalc = ID_RECALC_TRANSFORM | ID_RECALC_ANIMATION | ID_RECALC_SELECT;
+  if (caster_updated && is_initialized && (handle.recalc & ~transform_recalc) == 0) {
+    caster_updated = object_to_world != shadow_ob.object_to_world;
+  }
+
+  if (caster_updated && is_shadow_caster) {
+    shadow_ob.object_to_world = object_to_world;
     if (shadow_ob.resource_handle.raw != 0) {
       past_casters_updated_.append(shadow_ob.resource_handle.raw);
     }
@@ -178,6 +178,8 @@ struct ShadowTileMapPool {
 /* Can be either a shadow caster or a shadow receiver. */
 struct ShadowObject {
   ResourceHandle resource_handle = {0};
+  /** Transform at the last time the shadow pages of this caster were invalidated. */
+  float4x4 object_to_world = float4x4::identity();
   bool used = true;
 };
 
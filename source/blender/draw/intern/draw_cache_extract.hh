@@ -10,7 +10,9 @@
 
 #include <algorithm>
 
+#include "BLI_implicit_sharing_ptr.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "DNA_customdata_types.h"
 #include "DNA_mesh_types.h"
@@ -305,6 +307,17 @@ struct MeshBatchCache {
 
   eV3DShadingColorType color_type;
   bool pbvh_is_drawing;
+
+  /**
+   * Users of the implicitly shared arrays of the mesh that the buffers were extracted from, except
+   * for the positions, and a hash of the layer names and settings. When the cache is tagged dirty
+   * but none of these changed, only the buffers that depend on positions are extracted again.
+   * Holding a user makes sure that the arrays are not modified in place, so the same pointer
+   * always means the same data.
+   */
+  blender::Vector<blender::ImplicitSharingPtr<const blender::ImplicitSharingInfo>> shared_data;
+  uint64_t shared_data_hash;
+  bool shared_data_valid;
 };
 
 #define MBC_EDITUV \
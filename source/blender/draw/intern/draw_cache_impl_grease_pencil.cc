@@ -8,6 +8,8 @@
  * \brief Grease Pencil API for render engines
  */
 
+#include <mutex>
+
 #include "BKE_curves.hh"
 #include "BKE_grease_pencil.h"
 #include "BKE_grease_pencil.hh"
@@ -277,8 +279,10 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
   int total_verts_num = 0;
   int total_triangles_num = 0;
   int v_offset = 0;
+  int ibo_offset = 0;
   Vector<Array<int>> verts_start_offsets_per_visible_drawing;
   Vector<Array<int>> tris_start_offsets_per_visible_drawing;
+  Vector<Array<int>> ibo_start_offsets_per_visible_drawing;
   for (const ed::greasepencil::DrawingInfo &info : drawings) {
     const bke::CurvesGeometry &curves = info.drawing.strokes();
     const OffsetIndices<int> points_by_curve = curves.points_by_curve();
@@ -288,6 +292,7 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
     int tris_start_offsets_size = curves.curves_num();
     Array<int> verts_start_offsets(verts_start_offsets_size);
     Array<int> tris_start_offsets(tris_start_offsets_size);
+    Array<int> ibo_start_offsets(curves.curves_num());
 
     /* Calculate the vertex and triangle offsets for all the curves. */
     int t_offset = 0;
@@ -301,9 +306,13 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
       }
 
       tris_start_offsets[curve_i] = t_offset;
+      ibo_start_offsets[curve_i] = ibo_offset;
       if (points.size() >= 3) {
         t_offset += points.size() - 2;
+        ibo_offset += points.size() - 2;
       }
+      /* Each point (and the extra cyclic point) is drawn as a quad. */
+      ibo_offset += (points.size() + (is_cyclic ? 1 : 0)) * 2;
 
       verts_start_offsets[curve_i] = v_offset;
       v_offset += 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
@@ -318,7 +327,9 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
 
     verts_start_offsets_per_visible_drawing.append(std::move(verts_start_offsets));
     tris_start_offsets_per_visible_drawing.append(std::move(tris_start_offsets));
+    ibo_start_offsets_per_visible_drawing.append(std::move(ibo_start_offsets));
   }
+  BLI_assert(ibo_offset == total_triangles_num);
 
   static GPUVertFormat format_edit_points_pos = {0};
   if (format_edit_points_pos.attr_len == 0) {
@@ -363,6 +374,7 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
   GPU_indexbuf_init(&ibo, GPU_PRIM_TRIS, total_triangles_num, 0xFFFFFFFFu);
 
   /* Fill buffers with data. */
+  std::mutex ibo_mutex;
   int drawing_start_offset = 0;
   for (const int drawing_i : drawings.index_range()) {
     const ed::greasepencil::DrawingInfo &info = drawings[drawing_i];
@@ -387,6 +399,7 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
     const Span<uint3> triangles = info.drawing.triangles();
     const Span<int> verts_start_offsets = verts_start_offsets_per_visible_drawing[drawing_i];
     const Span<int> tris_start_offsets = tris_start_offsets_per_visible_drawing[drawing_i];
+    const Span<int> ibo_start_offsets = ibo_start_offsets_per_visible_drawing[drawing_i];
 
     edit_points.slice(drawing_start_offset, curves.points_num()).copy_from(curves.positions());
     MutableSpan<float> selection_slice = edit_points_selection.slice(drawing_start_offset,
@@ -394,7 +407,9 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
     selection_float.materialize(selection_slice);
     drawing_start_offset += curves.points_num();
 
-    auto populate_point = [&](IndexRange verts_range,
+    auto populate_point = [&](GPUIndexBufBuilder &ibo_local,
+                              const int quad_elem,
+                              IndexRange verts_range,
                               int curve_i,
                               int8_t start_cap,
                               int8_t end_cap,
@@ -422,16 +437,20 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
       c_vert.fcol[3] = (int(c_vert.fcol[3] * 10000.0f) * 10.0f) + 1.0f;
 
       int v_mat = (verts_range[idx] << GP_VERTEX_ID_SHIFT) | GP_IS_STROKE_VERTEX_BIT;
-      GPU_indexbuf_add_tri_verts(&ibo, v_mat + 0, v_mat + 1, v_mat + 2);
-      GPU_indexbuf_add_tri_verts(&ibo, v_mat + 2, v_mat + 1, v_mat + 3);
+      GPU_indexbuf_set_tri_verts(&ibo_local, quad_elem + 0, v_mat + 0, v_mat + 1, v_mat + 2);
+      GPU_indexbuf_set_tri_verts(&ibo_local, quad_elem + 1, v_mat + 2, v_mat + 1, v_mat + 3);
     };
 
     threading::parallel_for(curves.curves_range(), 512, [&](IndexRange range) {
+      /* Triangles are written at their final position, so that curves can be filled in parallel
+       * without the ordering (fills first, then strokes) depending on the threads. */
+      GPUIndexBufBuilder ibo_local = ibo;
       for (const int curve_i : range) {
         IndexRange points = points_by_curve[curve_i];
         const bool is_cyclic = cyclic[curve_i];
         const int verts_start_offset = verts_start_offsets[curve_i];
         const int tris_start_offset = tris_start_offsets[curve_i];
+        int ibo_elem = ibo_start_offsets[curve_i];
         const int num_verts = 1 + points.size() + (is_cyclic ? 1 : 0) + 1;
         IndexRange verts_range = IndexRange(verts_start_offset, num_verts);
         MutableSpan<GreasePencilStrokeVert> verts_slice = verts.slice(verts_range);
@@ -444,7 +463,8 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
         if (points.size() >= 3) {
           const Span<uint3> tris_slice = triangles.slice(tris_start_offset, points.size() - 2);
           for (const uint3 tri : tris_slice) {
-            GPU_indexbuf_add_tri_verts(&ibo,
+            GPU_indexbuf_set_tri_verts(&ibo_local,
+                                       ibo_elem++,
                                        (verts_range[1] + tri.x) << GP_VERTEX_ID_SHIFT,
                                        (verts_range[1] + tri.y) << GP_VERTEX_ID_SHIFT,
                                        (verts_range[1] + tri.z) << GP_VERTEX_ID_SHIFT);
@@ -454,7 +474,9 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
         /* Write all the point attributes to the vertex buffers. Create a quad for each point. */
         for (const int i : IndexRange(points.size())) {
           const int idx = i + 1;
-          populate_point(verts_range,
+          populate_point(ibo_local,
+                         ibo_elem,
+                         verts_range,
                          curve_i,
                          start_caps[curve_i],
                          end_caps[curve_i],
@@ -462,11 +484,14 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
                          idx,
                          verts_slice[idx],
                          cols_slice[idx]);
+          ibo_elem += 2;
         }
 
         if (is_cyclic) {
           const int idx = points.size() + 1;
-          populate_point(verts_range,
+          populate_point(ibo_local,
+                         ibo_elem,
+                         verts_range,
                          curve_i,
                          start_caps[curve_i],
                          end_caps[curve_i],
@@ -479,6 +504,8 @@ static void grease_pencil_geom_batch_ensure(const GreasePencil &grease_pencil,
         /* Last vertex is not drawn. */
         verts_slice.last().mat = -1;
       }
+      std::scoped_lock lock(ibo_mutex);
+      GPU_indexbuf_join(&ibo, &ibo_local);
     });
   }
 
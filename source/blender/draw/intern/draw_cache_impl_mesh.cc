@@ -14,6 +14,7 @@
 
 #include "BLI_bitmap.h"
 #include "BLI_buffer.h"
+#include "BLI_hash.hh"
 #include "BLI_index_range.hh"
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
@@ -66,10 +67,13 @@
 
 #include "mesh_extractors/extract_mesh.hh"
 
+using blender::ImplicitSharingInfo;
 using blender::IndexRange;
 using blender::Map;
 using blender::Span;
+using blender::StringRef;
 using blender::StringRefNull;
+using blender::Vector;
 
 /* ---------------------------------------------------------------------- */
 /** \name Dependencies between buffer and batch
@@ -609,13 +613,170 @@ static void mesh_batch_cache_init(Object *object, Mesh *me)
   drw_mesh_weight_state_clear(&cache->weight_state);
 }
 
+/**
+ * Gather the implicitly shared arrays of the mesh that the buffers depend on, except for the
+ * positions, and a hash of the layer names and settings. False is returned when some data isn't
+ * shared, so changes can't be detected.
+ */
+static bool mesh_shared_data_gather(const Mesh &mesh,
+                                    Vector<const ImplicitSharingInfo *> &r_data,
+                                    uint64_t &r_hash)
+{
+  const auto string_hash = [](const char *str) {
+    return blender::get_default_hash(StringRef(str ? str : ""));
+  };
+  r_hash = blender::get_default_hash_4(mesh.totvert, mesh.totedge, mesh.faces_num, mesh.totloop);
+  r_hash = blender::get_default_hash_3(r_hash,
+                                       string_hash(mesh.active_color_attribute),
+                                       string_hash(mesh.default_color_attribute));
+  if (mesh.faces_num > 0) {
+    if (mesh.runtime->face_offsets_sharing_info == nullptr) {
+      return false;
+    }
+    r_data.append(mesh.runtime->face_offsets_sharing_info);
+  }
+  for (const CustomData *data :
+       {&mesh.vert_data, &mesh.edge_data, &mesh.face_data, &mesh.loop_data})
+  {
+    for (const CustomDataLayer &layer : Span(data->layers, data->totlayer)) {
+      r_hash = blender::get_default_hash_4(
+          r_hash, layer.type, layer.flag, string_hash(layer.name));
+      r_hash = blender::get_default_hash_4(
+          r_hash, layer.active, layer.active_rnd, layer.active_clone);
+      r_hash = blender::get_default_hash_2(r_hash, layer.active_mask);
+      if (layer.data == nullptr || (layer.type == CD_PROP_FLOAT3 && STREQ(layer.name, "position")))
+      {
+        continue;
+      }
+      if (layer.sharing_info == nullptr) {
+        return false;
+      }
+      r_data.append(layer.sharing_info);
+    }
+  }
+  return true;
+}
+
+static void mesh_batch_cache_shared_data_update(MeshBatchCache &cache, const Mesh &mesh)
+{
+  cache.shared_data.clear();
+  cache.shared_data_valid = false;
+  /* Edit mode and GPU subdivision buffers are not extracted from the mesh arrays directly. */
+  if (mesh.edit_mesh || mesh.runtime->wrapper_type != ME_WRAPPER_TYPE_MDATA) {
+    return;
+  }
+  Vector<const ImplicitSharingInfo *> data;
+  if (!mesh_shared_data_gather(mesh, data, cache.shared_data_hash)) {
+    return;
+  }
+  for (const ImplicitSharingInfo *sharing_info : data) {
+    sharing_info->add_user();
+    cache.shared_data.append(blender::ImplicitSharingPtr<const ImplicitSharingInfo>(sharing_info));
+  }
+  cache.shared_data_valid = true;
+}
+
+/**
+ * Positions are often the only data that changes between evaluations, for example when an object
+ * is deformed without modifiers that change the topology. Then the buffers that only depend on
+ * the topology, the UVs or other attributes can be kept. The triangulation of quads and n-gons
+ * depends on the positions though, so the triangle index buffers have to be rebuilt.
+ */
+static bool mesh_batch_cache_only_positions_changed(const Object *object,
+                                                    const Mesh &mesh,
+                                                    const MeshBatchCache &cache)
+{
+  if (!cache.is_dirty || !cache.shared_data_valid || cache.subdiv_cache != nullptr) {
+    return false;
+  }
+  if (cache.is_editmode || mesh.edit_mesh || mesh.runtime->wrapper_type != ME_WRAPPER_TYPE_MDATA)
+  {
+    return false;
+  }
+  if (cache.mat_len != mesh_render_mat_len_get(object, &mesh)) {
+    return false;
+  }
+  Vector<const ImplicitSharingInfo *> data;
+  uint64_t hash;
+  if (!mesh_shared_data_gather(mesh, data, hash)) {
+    return false;
+  }
+  if (hash != cache.shared_data_hash || data.size() != cache.shared_data.size()) {
+    return false;
+  }
+  for (const int i : data.index_range()) {
+    if (data[i] != cache.shared_data[i].get()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static void mesh_batch_cache_discard_deform(MeshBatchCache &cache)
+{
+  bool position_attribute_used = false;
+  for (const int i : IndexRange(cache.attr_used.num_requests)) {
+    if (STREQ(cache.attr_used.requests[i].attribute_name, "position")) {
+      position_attribute_used = true;
+    }
+  }
+  /* The per material index buffers are sub-ranges of the triangles buffer. */
+  for (int i = 0; i < cache.mat_len; i++) {
+    GPU_INDEXBUF_DISCARD_SAFE(cache.tris_per_mat[i]);
+  }
+  FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.pos_nor);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.lnor);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.tan);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edge_fac);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.mesh_analysis);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_pos);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_nor);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edituv_stretch_area);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edituv_stretch_angle);
+    GPU_INDEXBUF_DISCARD_SAFE(mbc->buff.ibo.tris);
+    GPU_INDEXBUF_DISCARD_SAFE(mbc->buff.ibo.lines_adjacency);
+    if (position_attribute_used) {
+      for (const int i : IndexRange(cache.attr_used.num_requests)) {
+        if (STREQ(cache.attr_used.requests[i].attribute_name, "position")) {
+          GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.attr[i]);
+        }
+      }
+    }
+  }
+  DRWBatchFlag batch_map = BATCH_MAP(vbo.pos_nor,
+                                     vbo.lnor,
+                                     vbo.tan,
+                                     vbo.edge_fac,
+                                     vbo.mesh_analysis,
+                                     vbo.fdots_pos,
+                                     vbo.fdots_nor,
+                                     vbo.edituv_stretch_area,
+                                     vbo.edituv_stretch_angle);
+  batch_map |= BATCH_MAP(ibo.tris, ibo.lines_adjacency) | MBC_SURFACE_PER_MAT;
+  if (position_attribute_used) {
+    batch_map |= BATCH_MAP(vbo.attr[0]);
+  }
+  mesh_batch_cache_discard_batch(cache, batch_map);
+
+  cache.tot_area = 0.0f;
+}
+
 void DRW_mesh_batch_cache_validate(Object *object, Mesh *me)
 {
   if (!mesh_batch_cache_valid(object, me)) {
     if (me->runtime->batch_cache) {
-      mesh_batch_cache_clear(*static_cast<MeshBatchCache *>(me->runtime->batch_cache));
+      MeshBatchCache &cache = *static_cast<MeshBatchCache *>(me->runtime->batch_cache);
+      if (mesh_batch_cache_only_positions_changed(object, *me, cache)) {
+        mesh_batch_cache_discard_deform(cache);
+        cache.is_dirty = false;
+        return;
+      }
+      mesh_batch_cache_clear(cache);
     }
     mesh_batch_cache_init(object, me);
+    mesh_batch_cache_shared_data_update(
+        *static_cast<MeshBatchCache *>(me->runtime->batch_cache), *me);
   }
 }
 
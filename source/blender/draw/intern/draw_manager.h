@@ -72,8 +72,15 @@ struct Object;
 #  define PROFILE_END_UPDATE(time_update, time_start) \
     { \
       double _time_delta = (PIL_check_seconds_timer() - time_start) * 1e3; \
+      PROFILE_END_UPDATE_VALUE(time_update, _time_delta); \
+    } \
+    ((void)0)
+
+/* exp average of an already measured time */
+#  define PROFILE_END_UPDATE_VALUE(time_update, time_delta) \
+    { \
       time_update = (time_update * (1.0 - PROFILE_TIMER_FALLOFF)) + \
-                    (_time_delta * PROFILE_TIMER_FALLOFF); \
+                    ((time_delta)*PROFILE_TIMER_FALLOFF); \
     } \
     ((void)0)
 
@@ -82,6 +89,7 @@ struct Object;
 #  define PROFILE_START(time_start) ((void)0)
 #  define PROFILE_END_ACCUM(time_accum, time_start) ((void)0)
 #  define PROFILE_END_UPDATE(time_update, time_start) ((void)0)
+#  define PROFILE_END_UPDATE_VALUE(time_update, time_delta) ((void)0)
 
 #endif /* USE_PROFILE */
 
@@ -663,6 +671,8 @@ typedef struct DRWManager {
   struct TaskGraph *task_graph;
   /* Contains list of objects that needs to be extracted from other objects. */
   struct GSet *delayed_extraction;
+  /** Time spent in batch cache extraction during this sync (in ms), for profiling. */
+  double extract_time;
 
   /* ---------- Nothing after this point is cleared after use ----------- */
 
@@ -166,6 +166,7 @@ static void drw_task_graph_init()
 
 static void drw_task_graph_deinit()
 {
+  PROFILE_START(stime);
   BLI_task_graph_work_and_wait(DST.task_graph);
 
   BLI_gset_free(DST.delayed_extraction,
@@ -175,6 +176,7 @@ static void drw_task_graph_deinit()
 
   BLI_task_graph_free(DST.task_graph);
   DST.task_graph = nullptr;
+  PROFILE_END_ACCUM(DST.extract_time, stime);
 }
 
 /** \} */
@@ -757,7 +759,9 @@ static void duplidata_key_free(void *key)
 static void drw_duplidata_free()
 {
   if (DST.dupli_ghash != nullptr) {
+    PROFILE_START(stime);
     BLI_ghash_free(DST.dupli_ghash, duplidata_key_free, duplidata_value_free);
+    PROFILE_END_ACCUM(DST.extract_time, stime);
     DST.dupli_ghash = nullptr;
   }
 }
@@ -1043,9 +1047,12 @@ static void drw_engines_cache_init()
       DST.text_store_p = &data->text_draw_cache;
     }
 
+    PROFILE_START(stime);
+    data->cache_time_accum = 0.0;
     if (engine->cache_init) {
       engine->cache_init(data);
     }
+    PROFILE_END_ACCUM(data->cache_time_accum, stime);
   }
 }
 
@@ -1078,6 +1085,7 @@ static void drw_engines_cache_populate(Object *ob)
   }
 
   DRW_ENABLED_ENGINE_ITER (DST.view_data_active, engine, data) {
+    PROFILE_START(stime);
     if (engine->id_update) {
       engine->id_update(data, &ob->id);
     }
@@ -1085,12 +1093,15 @@ static void drw_engines_cache_populate(Object *ob)
     if (engine->cache_populate) {
       engine->cache_populate(data, ob);
     }
+    PROFILE_END_ACCUM(data->cache_time_accum, stime);
   }
 
   /* TODO: in the future it would be nice to generate once for all viewports.
    * But we need threaded DRW manager first. */
   if (!DST.dupli_source) {
+    PROFILE_START(stime);
     drw_batch_cache_generate_requested(ob);
+    PROFILE_END_ACCUM(DST.extract_time, stime);
   }
 
   /* ... and clearing it here too because this draw data is
@@ -1101,9 +1112,12 @@ static void drw_engines_cache_populate(Object *ob)
 static void drw_engines_cache_finish()
 {
   DRW_ENABLED_ENGINE_ITER (DST.view_data_active, engine, data) {
+    PROFILE_START(stime);
     if (engine->cache_finish) {
       engine->cache_finish(data);
     }
+    PROFILE_END_ACCUM(data->cache_time_accum, stime);
+    PROFILE_END_UPDATE_VALUE(data->cache_time, data->cache_time_accum);
   }
 
   DRW_manager_end_sync();
@@ -1743,6 +1757,8 @@ void DRW_draw_render_loop_ex(Depsgraph *depsgraph,
 #ifdef USE_PROFILE
     double *cache_time = DRW_view_data_cache_time_get(DST.view_data_active);
     PROFILE_END_UPDATE(*cache_time, stime);
+    double *extract_time = DRW_view_data_extract_time_get(DST.view_data_active);
+    PROFILE_END_UPDATE_VALUE(*extract_time, DST.extract_time);
 #endif
   }
 
@@ -2256,6 +2272,11 @@ void DRW_draw_render_loop_2d_ex(Depsgraph *depsgraph,
   }
   drw_task_graph_deinit();
 
+#ifdef USE_PROFILE
+  double *extract_time = DRW_view_data_extract_time_get(DST.view_data_active);
+  PROFILE_END_UPDATE_VALUE(*extract_time, DST.extract_time);
+#endif
+
   DRW_stats_begin();
 
   GPU_framebuffer_bind(DST.default_framebuffer);
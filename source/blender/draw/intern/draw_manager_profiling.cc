@@ -213,7 +213,8 @@ void DRW_stats_draw(const rcti *rect)
   int lvl_index[MAX_NESTED_TIMER];
   int v = 0, u = 0;
 
-  double init_tot_time = 0.0, background_tot_time = 0.0, render_tot_time = 0.0, tot_time = 0.0;
+  double init_tot_time = 0.0, cache_tot_time = 0.0, background_tot_time = 0.0,
+         render_tot_time = 0.0, tot_time = 0.0;
 
   int fontid = BLF_default();
   UI_FontThemeColor(fontid, TH_TEXT_HI);
@@ -233,6 +234,8 @@ void DRW_stats_draw(const rcti *rect)
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   STRNCPY(col_label, "Init");
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
+  STRNCPY(col_label, "Cache");
+  draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   STRNCPY(col_label, "Background");
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   STRNCPY(col_label, "Render");
@@ -252,6 +255,10 @@ void DRW_stats_draw(const rcti *rect)
     SNPRINTF(time_to_txt, "%.2fms", data->init_time);
     draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
 
+    cache_tot_time += data->cache_time;
+    SNPRINTF(time_to_txt, "%.2fms", data->cache_time);
+    draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
+
     background_tot_time += data->background_time;
     SNPRINTF(time_to_txt, "%.2fms", data->background_time);
     draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
@@ -272,6 +279,8 @@ void DRW_stats_draw(const rcti *rect)
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   SNPRINTF(time_to_txt, "%.2fms", init_tot_time);
   draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
+  SNPRINTF(time_to_txt, "%.2fms", cache_tot_time);
+  draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
   SNPRINTF(time_to_txt, "%.2fms", background_tot_time);
   draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
   SNPRINTF(time_to_txt, "%.2fms", render_tot_time);
@@ -286,6 +295,15 @@ void DRW_stats_draw(const rcti *rect)
   draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
   SNPRINTF(time_to_txt, "%.2fms", *cache_time);
   draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
+  v++;
+
+  /* Part of the cache time spent creating the requested batches. */
+  u = 0;
+  double *extract_time = DRW_view_data_extract_time_get(DST.view_data_active);
+  STRNCPY(col_label, "Extraction Time");
+  draw_stat_5row(rect, u++, v, col_label, sizeof(col_label));
+  SNPRINTF(time_to_txt, "%.2fms", *extract_time);
+  draw_stat_5row(rect, u++, v, time_to_txt, sizeof(time_to_txt));
   v += 2;
 
   /* ------------------------------------------ */
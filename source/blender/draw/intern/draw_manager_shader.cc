@@ -358,6 +358,26 @@ void DRW_deferred_shader_remove(GPUMaterial *mat)
   }
 }
 
+void DRW_deferred_shader_prioritize(GPUMaterial *mat)
+{
+  LISTBASE_FOREACH (wmWindowManager *, wm, &G_MAIN->wm) {
+    LISTBASE_FOREACH (wmWindow *, win, &wm->windows) {
+      DRWShaderCompiler *comp = (DRWShaderCompiler *)WM_jobs_customdata_from_type(
+          wm, wm, WM_JOB_TYPE_SHADER_COMPILATION);
+      if (comp != nullptr) {
+        BLI_spin_lock(&comp->list_lock);
+        /* The compilation job pops from the tail, move the material there to compile it next. */
+        LinkData *link = (LinkData *)BLI_findptr(&comp->queue, mat, offsetof(LinkData, data));
+        if (link) {
+          BLI_remlink(&comp->queue, link);
+          BLI_addtail(&comp->queue, link);
+        }
+        BLI_spin_unlock(&comp->list_lock);
+      }
+    }
+  }
+}
+
 void DRW_deferred_shader_optimize_remove(GPUMaterial *mat)
 {
   LISTBASE_FOREACH (wmWindowManager *, wm, &G_MAIN->wm) {
@@ -100,6 +100,8 @@ struct PBVHVbo {
   std::string name;
   GPUVertBuf *vert_buf = nullptr;
   std::string key;
+  /** Whether the host data of the buffer is kept after upload, see #PBVHBatches::update. */
+  bool is_dynamic = false;
 
   PBVHVbo(eAttrDomain domain, uint64_t type, std::string name)
       : type(type), domain(domain), name(std::move(name))
@@ -799,6 +801,15 @@ struct PBVHBatches {
     check_index_buffers(args);
 
     for (PBVHVbo &vbo : vbos) {
+      if (!vbo.is_dynamic) {
+        /* The node is updated again, most likely during a stroke. Keep the host copy of its
+         * data from now on so it isn't freed after every upload and reallocated on the next
+         * step. Nodes that are never touched keep static buffers without host memory. */
+        const GPUVertFormat format = *GPU_vertbuf_get_format(vbo.vert_buf);
+        GPU_vertbuf_clear(vbo.vert_buf);
+        GPU_vertbuf_init_with_format_ex(vbo.vert_buf, &format, GPU_USAGE_DYNAMIC);
+        vbo.is_dynamic = true;
+      }
       fill_vbo(vbo, args);
     }
   }
@@ -957,6 +968,9 @@ struct PBVHBatches {
         fill_vbo_bmesh(vbo, args);
         break;
     }
+    /* The host data is kept between updates and refilled in place when the size didn't change,
+     * so the buffer has to be tagged for upload explicitly. */
+    GPU_vertbuf_tag_dirty(vbo.vert_buf);
   }
 
   void create_vbo(eAttrDomain domain,
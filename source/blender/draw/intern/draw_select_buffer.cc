@@ -29,17 +29,48 @@
 
 #include "../engines/select/select_engine.hh"
 
-bool SELECTID_Context::is_dirty(RegionView3D *rv3d)
+void SELECTID_Context::view_settings_store(const ARegion *region, const View3D *v3d)
+{
+  const RegionView3D *rv3d = static_cast<const RegionView3D *>(region->regiondata);
+  copy_m4_m4(this->persmat, rv3d->persmat);
+  this->view_settings.winx = region->winx;
+  this->view_settings.winy = region->winy;
+  this->view_settings.shading_flag = v3d->shading.flag;
+  this->view_settings.xray_alpha = v3d->shading.xray_alpha;
+  this->view_settings.xray_alpha_wire = v3d->shading.xray_alpha_wire;
+  this->view_settings.overlay_edit_flag = v3d->overlay.edit_flag;
+  this->view_settings.retopology_offset = v3d->overlay.retopology_offset;
+  this->view_settings.rflag = rv3d->rflag;
+  this->view_settings.shading_type = v3d->shading.type;
+  memcpy(this->view_settings.clip, rv3d->clip, sizeof(this->view_settings.clip));
+}
+
+bool SELECTID_Context::is_dirty(const ARegion *region, const View3D *v3d)
 {
   /* Check if the viewport has changed. */
-  float(*persmat)[4] = rv3d->persmat;
-  bool is_dirty = !compare_m4m4(this->persmat, persmat, FLT_EPSILON);
+  const RegionView3D *rv3d = static_cast<const RegionView3D *>(region->regiondata);
+  bool is_dirty = !compare_m4m4(this->persmat, rv3d->persmat, FLT_EPSILON);
+
+  if (!is_dirty) {
+    /* Check if any setting used for drawing the buffer has changed. */
+    is_dirty = (this->view_settings.winx != region->winx) ||
+               (this->view_settings.winy != region->winy) ||
+               (this->view_settings.shading_flag != v3d->shading.flag) ||
+               (this->view_settings.xray_alpha != v3d->shading.xray_alpha) ||
+               (this->view_settings.xray_alpha_wire != v3d->shading.xray_alpha_wire) ||
+               (this->view_settings.overlay_edit_flag != v3d->overlay.edit_flag) ||
+               (this->view_settings.retopology_offset != v3d->overlay.retopology_offset) ||
+               (this->view_settings.rflag != rv3d->rflag) ||
+               (this->view_settings.shading_type != v3d->shading.type) ||
+               ((rv3d->rflag & RV3D_CLIPPING) &&
+                memcmp(this->view_settings.clip, rv3d->clip, sizeof(rv3d->clip)) != 0);
+  }
 
   if (!is_dirty) {
     /* Check if any of the drawn objects have been transformed. */
     for (Object *obj_eval : this->objects) {
       DrawData *data = DRW_drawdata_get(&obj_eval->id, &draw_engine_select_type);
-      if (!data || (data->recalc & ID_RECALC_TRANSFORM)) {
+      if (!data || (data->recalc & (ID_RECALC_TRANSFORM | ID_RECALC_GEOMETRY))) {
         is_dirty = true;
         break;
       }
@@ -71,11 +102,10 @@ uint *DRW_select_buffer_read(
   rcti rect_clamp = *rect;
   if (BLI_rcti_isect(&r, &rect_clamp, &rect_clamp)) {
     SELECTID_Context *select_ctx = DRW_select_engine_context_get();
-    RegionView3D *rv3d = static_cast<RegionView3D *>(region->regiondata);
 
     DRW_gpu_context_enable();
 
-    if (select_ctx->is_dirty(rv3d)) {
+    if (select_ctx->is_dirty(region, v3d)) {
       /* Update drawing. */
       DRW_draw_select_id(depsgraph, region, v3d);
     }
@@ -479,6 +509,19 @@ void DRW_select_buffer_context_create(Depsgraph *depsgraph,
 {
   SELECTID_Context *select_ctx = DRW_select_engine_context_get();
 
+  /* Keep the drawn buffer when selecting from the same objects again (repeated box or lasso
+   * selection), #SELECTID_Context::is_dirty detects changes to the view and the objects.
+   * A select mode of -1 is resolved while drawing, so it can't be compared. */
+  bool is_same_context = (select_mode != -1) && (select_mode == select_ctx->select_mode) &&
+                         (bases_len == select_ctx->objects.size());
+  for (uint base_index = 0; is_same_context && base_index < bases_len; base_index++) {
+    Object *obj = bases[base_index]->object;
+    is_same_context = select_ctx->objects[base_index] == DEG_get_evaluated_object(depsgraph, obj);
+  }
+  if (is_same_context) {
+    return;
+  }
+
   select_ctx->objects.reinitialize(bases_len);
   select_ctx->index_offsets.reinitialize(bases_len);
 
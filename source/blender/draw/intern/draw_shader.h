@@ -30,6 +30,7 @@ GPUShader *DRW_shader_curves_refine_get(CurvesEvalShader type, eParticleRefineSh
 GPUShader *DRW_shader_debug_print_display_get();
 GPUShader *DRW_shader_debug_draw_display_get();
 GPUShader *DRW_shader_draw_visibility_compute_get();
+GPUShader *DRW_shader_draw_visibility_occlusion_compute_get();
 GPUShader *DRW_shader_draw_view_finalize_get();
 GPUShader *DRW_shader_draw_resource_finalize_get();
 GPUShader *DRW_shader_draw_command_generate_get();
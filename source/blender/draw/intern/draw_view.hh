@@ -43,6 +43,9 @@ class View {
   UniformArrayBuffer<ViewCullingData, DRW_VIEW_MAX> culling_freeze_;
   /** Result of the visibility computation. 1 bit or 1 or 2 word per resource ID per view. */
   VisibilityBuf visibility_buf_;
+  /** Hierarchical depth buffer used for occlusion culling. Optional. */
+  GPUTexture *occlusion_hiz_tx_ = nullptr;
+  float2 occlusion_uv_scale_ = float2(1.0f);
 
   const char *debug_name_;
 
@@ -82,6 +85,21 @@ class View {
     do_visibility_ = enable;
   }
 
+  /**
+   * Also cull the resources that are entirely behind the depth stored in a hierarchical depth
+   * buffer in the following submissions. Each mip level of the buffer has to contain the maximum
+   * depth of the corresponding texels of the previous level. This is only correct if the buffer
+   * contains the depth that the drawn geometry is tested against, e.g. after a depth pre-pass.
+   * \a uv_scale maps the view to the used area of the buffer. Pass nullptr to disable.
+   * Only supported for single views.
+   */
+  void visibility_occlusion_test(GPUTexture *hiz_tx, float2 uv_scale = float2(1.0f))
+  {
+    BLI_assert(hiz_tx == nullptr || view_len_ == 1);
+    occlusion_hiz_tx_ = hiz_tx;
+    occlusion_uv_scale_ = uv_scale;
+  }
+
   /**
    * Update culling data using a compute shader.
    * This is to be used if the matrices were updated externally
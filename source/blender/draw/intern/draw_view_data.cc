@@ -33,6 +33,7 @@ struct DRWViewData {
   int texture_list_size[2] = {0, 0};
 
   double cache_time = 0.0;
+  double extract_time = 0.0;
 
   Vector<ViewportEngineData> engines;
   Vector<ViewportEngineData *> enabled_engines;
@@ -231,6 +232,11 @@ double *DRW_view_data_cache_time_get(DRWViewData *view_data)
   return &view_data->cache_time;
 }
 
+double *DRW_view_data_extract_time_get(DRWViewData *view_data)
+{
+  return &view_data->extract_time;
+}
+
 DefaultFramebufferList *DRW_view_data_default_framebuffer_list_get(DRWViewData *view_data)
 {
   return &view_data->dfbl;
@@ -62,8 +62,11 @@ typedef struct ViewportEngineData {
 
   /* Profiling data */
   double init_time;
+  double cache_time;
   double render_time;
   double background_time;
+  /** Accumulates #cache_time during a sync. */
+  double cache_time_accum;
 } ViewportEngineData;
 
 typedef struct ViewportEngineData_Info {
@@ -110,6 +113,7 @@ void DRW_view_data_reset(DRWViewData *view_data);
 void DRW_view_data_free_unused(DRWViewData *view_data);
 void DRW_view_data_engines_view_update(DRWViewData *view_data);
 double *DRW_view_data_cache_time_get(DRWViewData *view_data);
+double *DRW_view_data_extract_time_get(DRWViewData *view_data);
 DefaultFramebufferList *DRW_view_data_default_framebuffer_list_get(DRWViewData *view_data);
 DefaultTextureList *DRW_view_data_default_texture_list_get(DRWViewData *view_data);
 
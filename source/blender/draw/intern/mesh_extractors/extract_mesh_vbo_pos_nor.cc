@@ -8,6 +8,8 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_task.hh"
+
 #include "extract_mesh.hh"
 
 #include "draw_subdivision.hh"
@@ -49,19 +51,23 @@ static void extract_pos_nor_init(const MeshRenderData &mr,
   data->vbo_data = static_cast<PosNorLoop *>(GPU_vertbuf_get_data(vbo));
   data->normals = (GPUNormal *)MEM_mallocN(sizeof(GPUNormal) * mr.vert_len, __func__);
 
-  /* Quicker than doing it for each loop. */
+  /* Quicker than doing it for each loop. This runs before the threaded iteration over faces,
+   * so it is multi-threaded as well to avoid a serial step on dense meshes. */
+  GPUNormal *normals = data->normals;
   if (mr.extract_type == MR_EXTRACT_BMESH) {
-    BMIter iter;
-    BMVert *eve;
-    int v;
-    BM_ITER_MESH_INDEX (eve, &iter, mr.bm, BM_VERTS_OF_MESH, v) {
-      data->normals[v].low = GPU_normal_convert_i10_v3(bm_vert_no_get(mr, eve));
-    }
+    threading::parallel_for(IndexRange(mr.vert_len), 4096, [&](const IndexRange range) {
+      for (const int v : range) {
+        const BMVert *eve = BM_vert_at_index(mr.bm, v);
+        normals[v].low = GPU_normal_convert_i10_v3(bm_vert_no_get(mr, eve));
+      }
+    });
   }
   else {
-    for (int v = 0; v < mr.vert_len; v++) {
-      data->normals[v].low = GPU_normal_convert_i10_v3(mr.vert_normals[v]);
-    }
+    threading::parallel_for(IndexRange(mr.vert_len), 4096, [&](const IndexRange range) {
+      for (const int v : range) {
+        normals[v].low = GPU_normal_convert_i10_v3(mr.vert_normals[v]);
+      }
+    });
   }
 }
 
@@ -4,6 +4,8 @@
 
 /**
  * Compute visibility of each resource bounds for a given view.
+ * With `DRW_VISIBILITY_OCCLUSION`, resources hidden behind the content of a hierarchical depth
+ * buffer are culled as well.
  */
 /* TODO(fclem): This could be augmented by a 2 pass occlusion culling system. */
 
@@ -24,6 +26,56 @@ void mask_visibility_bit(uint view_id)
   }
 }
 
+#ifdef DRW_VISIBILITY_OCCLUSION
+/**
+ * Return false if the box is entirely behind the depth stored in #hiz_tx. Each mip level
+ * contains the maximum depth of the previous level, so it is enough to compare the nearest depth
+ * of the box against the texels of the level where its screen rectangle covers at most 2x2
+ * texels.
+ */
+bool intersect_hiz(IsectBox box)
+{
+  vec3 ndc_min = vec3(1e30);
+  vec3 ndc_max = vec3(-1e30);
+  for (int i = 0; i < 8; i++) {
+    vec4 hs_corner = drw_view.winmat * (drw_view.viewmat * vec4(box.corners[i], 1.0));
+    if (hs_corner.w <= 0.0) {
+      /* Crossing the camera plane. */
+      return true;
+    }
+    vec3 ndc_corner = hs_corner.xyz / hs_corner.w;
+    ndc_min = min(ndc_min, ndc_corner);
+    ndc_max = max(ndc_max, ndc_corner);
+  }
+  if (ndc_min.z <= -1.0) {
+    /* Crossing the near clip plane. */
+    return true;
+  }
+  float box_depth = ndc_min.z * 0.5 + 0.5;
+
+  vec2 hiz_size = vec2(textureSize(hiz_tx, 0));
+  vec2 texel_min = saturate(ndc_min.xy * 0.5 + 0.5) * hiz_uv_scale * hiz_size;
+  vec2 texel_max = saturate(ndc_max.xy * 0.5 + 0.5) * hiz_uv_scale * hiz_size;
+  float rect_size = max(texel_max.x - texel_min.x, texel_max.y - texel_min.y);
+  int lod = clamp(int(ceil(log2(max(rect_size, 1.0)))), 0, hiz_mip_count - 1);
+
+  ivec2 mip_size = textureSize(hiz_tx, lod);
+  ivec2 texel_start = min(ivec2(texel_min) >> lod, mip_size - 1);
+  ivec2 texel_end = min(ivec2(texel_max) >> lod, mip_size - 1);
+  if (any(greaterThan(texel_end - texel_start, ivec2(1)))) {
+    /* Rectangle too large for the coarsest level. */
+    return true;
+  }
+  float hiz_depth = 0.0;
+  for (int y = texel_start.y; y <= texel_end.y; y++) {
+    for (int x = texel_start.x; x <= texel_end.x; x++) {
+      hiz_depth = max(hiz_depth, texelFetch(hiz_tx, ivec2(x, y), lod).r);
+    }
+  }
+  return box_depth <= hiz_depth;
+}
+#endif
+
 void main()
 {
   if (int(gl_GlobalInvocationID.x) >= resource_len) {
@@ -42,19 +94,27 @@ void main()
                                            bounds._inner_sphere_radius);
 
     for (drw_view_id = 0u; drw_view_id < uint(view_len); drw_view_id++) {
+      bool is_visible;
       if (drw_view_culling.bound_sphere.w == -1.0) {
         /* View disabled. */
-        mask_visibility_bit(drw_view_id);
+        is_visible = false;
       }
       else if (intersect_view(inscribed_sphere) == true) {
-        /* Visible. */
+        is_visible = true;
       }
       else if (intersect_view(bounding_sphere) == false) {
-        /* Not visible. */
-        mask_visibility_bit(drw_view_id);
+        is_visible = false;
+      }
+      else {
+        is_visible = intersect_view(box);
+      }
+#ifdef DRW_VISIBILITY_OCCLUSION
+      if (is_visible && intersect_hiz(box) == false) {
+        /* Occluded. */
+        is_visible = false;
       }
-      else if (intersect_view(box) == false) {
-        /* Not visible. */
+#endif
+      if (!is_visible) {
         mask_visibility_bit(drw_view_id);
       }
     }
@@ -10,6 +10,7 @@
 #include <fstream>
 #include <iomanip>
 #include <optional>
+#include <thread>
 
 #include "ED_asset_indexer.h"
 
@@ -24,7 +25,9 @@
 #include "BLI_set.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_system.h"
 #include "BLI_uuid.h"
+#include BLI_SYSTEM_PID_H
 
 #include "AS_asset_catalog.hh"
 #include "BKE_appdir.h"
@@ -778,10 +781,25 @@ class AssetIndexFile : public AbstractFile {
       return;
     }
 
+    /* Write to a temporary file first and move it in place afterwards. Other Blender instances
+     * may read the index at the same time and should never see a partially written file. */
+    const std::string filename_temp = filename + "@" + std::to_string(abs(getpid())) + "_" +
+                                      std::to_string(std::hash<std::thread::id>{}(
+                                          std::this_thread::get_id()));
     std::ofstream os;
-    os.open(filename, std::ios::out | std::ios::trunc);
+    os.open(filename_temp, std::ios::out | std::ios::trunc);
     formatter.serialize(os, *content.contents);
     os.close();
+    if (os.fail()) {
+      CLOG_ERROR(&LOG, "Index not created: couldn't write [%s].", filename_temp.c_str());
+      BLI_delete(filename_temp.c_str(), false, false);
+      return;
+    }
+
+    if (BLI_rename_overwrite(filename_temp.c_str(), get_file_path()) != 0) {
+      CLOG_ERROR(&LOG, "Index not created: couldn't move into place [%s].", get_file_path());
+      BLI_delete(filename_temp.c_str(), false, false);
+    }
   }
 };
 
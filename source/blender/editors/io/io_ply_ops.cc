@@ -250,6 +250,7 @@ static int wm_ply_import_exec(bContext *C, wmOperator *op)
   params.global_scale = RNA_float_get(op->ptr, "global_scale");
   params.merge_verts = RNA_boolean_get(op->ptr, "merge_verts");
   params.import_attributes = RNA_boolean_get(op->ptr, "import_attributes");
+  params.import_as_points = RNA_boolean_get(op->ptr, "import_as_points");
   params.vertex_colors = ePLYVertexColorMode(RNA_enum_get(op->ptr, "import_colors"));
 
   int files_len = RNA_collection_length(op->ptr, "files");
@@ -327,6 +328,11 @@ void WM_OT_ply_import(wmOperatorType *ot)
                "Import vertex color attributes");
   RNA_def_boolean(
       ot->srna, "import_attributes", true, "Vertex Attributes", "Import custom vertex attributes");
+  RNA_def_boolean(ot->srna,
+                  "import_as_points",
+                  false,
+                  "Point Cloud",
+                  "Create a point cloud object for files without faces or edges");
 
   /* Only show .ply files by default. */
   prop = RNA_def_string(ot->srna, "filter_glob", "*.ply", 0, "Extension Filter", "");
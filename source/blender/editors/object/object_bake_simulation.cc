@@ -13,6 +13,7 @@
 #include "BLI_serialize.hh"
 #include "BLI_string.h"
 #include "BLI_string_utils.hh"
+#include "BLI_task.h"
 #include "BLI_vector.hh"
 
 #include "PIL_time.h"
@@ -247,6 +248,28 @@ struct BakeSimulationJob {
   Vector<ObjectBakeData> objects;
 };
 
+/**
+ * Writing a baked frame to disk is done in a separate task, so that the next frame can already be
+ * evaluated in the meantime. The frame cache is not modified anymore once it has been created, so
+ * its state can be read while the simulation continues.
+ */
+struct BakeFrameWriteTask {
+  const bake::BakeState *state;
+  bake::BlobSharing *blob_sharing;
+  std::string blob_file_name;
+  std::string blob_path;
+  std::string meta_path;
+};
+
+static void bake_frame_write_task_run(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  const BakeFrameWriteTask &task = *static_cast<const BakeFrameWriteTask *>(taskdata);
+  fstream blob_file{task.blob_path, std::ios::out | std::ios::binary};
+  bake::DiskBlobWriter blob_writer{task.blob_file_name, blob_file, 0};
+  fstream meta_file{task.meta_path, std::ios::out};
+  bake::serialize_bake(*task.state, blob_writer, *task.blob_sharing, meta_file);
+}
+
 static void bake_simulation_job_startjob(void *customdata, wmJobWorkerStatus *worker_status)
 {
   BakeSimulationJob &job = *static_cast<BakeSimulationJob *>(customdata);
@@ -275,6 +298,12 @@ static void bake_simulation_job_startjob(void *customdata, wmJobWorkerStatus *wo
   const float progress_per_frame = frame_step_size / frames_to_bake;
   const int old_frame = job.scene->r.cfra;
 
+  /* Only the frames of one time step are written at the same time. This keeps the number of
+   * frames that are kept in memory only for writing bounded. The blob sharing of a node is not
+   * thread-safe, but every node is only written once per frame. */
+  TaskPool *write_task_pool = BLI_task_pool_create(nullptr, TASK_PRIORITY_LOW);
+  Vector<std::unique_ptr<BakeFrameWriteTask>> write_tasks;
+
   for (float frame_f = global_bake_start_frame; frame_f <= global_bake_end_frame;
        frame_f += frame_step_size)
   {
@@ -289,6 +318,10 @@ static void bake_simulation_job_startjob(void *customdata, wmJobWorkerStatus *wo
 
     BKE_scene_graph_update_for_newframe(job.depsgraph);
 
+    /* Finish writing the previous frame before starting to write the new one. */
+    BLI_task_pool_work_and_wait(write_task_pool);
+    write_tasks.clear();
+
     const std::string frame_file_name = bake::frame_to_file_name(frame);
 
     for (ObjectBakeData &object_bake_data : job.objects) {
@@ -323,11 +356,16 @@ static void bake_simulation_job_startjob(void *customdata, wmJobWorkerStatus *wo
                         (frame_file_name + ".json").c_str());
           BLI_file_ensure_parent_dir_exists(meta_path);
           BLI_file_ensure_parent_dir_exists(blob_path);
-          fstream blob_file{blob_path, std::ios::out | std::ios::binary};
-          bake::DiskBlobWriter blob_writer{blob_file_name, blob_file, 0};
-          fstream meta_file{meta_path, std::ios::out};
-          bake::serialize_bake(
-              frame_cache.state, blob_writer, *node_bake_data.blob_sharing, meta_file);
+
+          auto write_task = std::make_unique<BakeFrameWriteTask>();
+          write_task->state = &frame_cache.state;
+          write_task->blob_sharing = node_bake_data.blob_sharing.get();
+          write_task->blob_file_name = blob_file_name;
+          write_task->blob_path = blob_path;
+          write_task->meta_path = meta_path;
+          BLI_task_pool_push(
+              write_task_pool, bake_frame_write_task_run, write_task.get(), false, nullptr);
+          write_tasks.append(std::move(write_task));
         }
       }
     }
@@ -336,6 +374,10 @@ static void bake_simulation_job_startjob(void *customdata, wmJobWorkerStatus *wo
     worker_status->do_update = true;
   }
 
+  BLI_task_pool_work_and_wait(write_task_pool);
+  BLI_task_pool_free(write_task_pool);
+  write_tasks.clear();
+
   for (ObjectBakeData &object_bake_data : job.objects) {
     for (ModifierBakeData &modifier_bake_data : object_bake_data.modifiers) {
       NodesModifierData &nmd = *modifier_bake_data.nmd;
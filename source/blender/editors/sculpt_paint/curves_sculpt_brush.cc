@@ -471,7 +471,7 @@ void CurvesConstraintSolver::solve_step(bke::CurvesGeometry &curves,
     geometry::curve_constraints::solve_length_constraints(
         curves.points_by_curve(), curve_selection, segment_lengths_, curves.positions_for_write());
   }
-  curves.tag_positions_changed();
+  curves.tag_positions_changed(curve_selection);
 }
 
 }  // namespace blender::ed::sculpt_paint
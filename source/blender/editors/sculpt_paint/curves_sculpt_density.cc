@@ -484,8 +484,20 @@ class DensitySubtractOperation : public CurvesSculptStrokeOperation {
    * is moved quickly and the brush spacing is small.
    */
   Vector<float3> deformed_root_positions_;
+  /**
+   * Contains the deformed roots of the selected curves. It is only rebuilt when curves have been
+   * removed, because otherwise the positions and indices stay the same between stroke steps.
+   */
+  KDTree_3d *root_points_kdtree_ = nullptr;
 
  public:
+  ~DensitySubtractOperation() override
+  {
+    if (root_points_kdtree_ != nullptr) {
+      BLI_kdtree_3d_free(root_points_kdtree_);
+    }
+  }
+
   void on_stroke_extended(const bContext &C, const StrokeExtension &stroke_extension) override;
 };
 
@@ -573,19 +585,25 @@ struct DensitySubtractOperationExecutor {
     if (stroke_extension.is_first) {
       const bke::crazyspace::GeometryDeformation deformation =
           bke::crazyspace::get_evaluated_curves_deformation(*ctx_.depsgraph, *object_);
-      for (const int curve_i : curves_->curves_range()) {
-        const int first_point_i = curves_->offsets()[curve_i];
-        self_->deformed_root_positions_.append(deformation.positions[first_point_i]);
-      }
+      const OffsetIndices points_by_curve = curves_->points_by_curve();
+      self_->deformed_root_positions_.reinitialize(curves_->curves_num());
+      threading::parallel_for(curves_->curves_range(), 4096, [&](const IndexRange range) {
+        for (const int curve_i : range) {
+          self_->deformed_root_positions_[curve_i] =
+              deformation.positions[points_by_curve[curve_i].first()];
+        }
+      });
     }
 
-    root_points_kdtree_ = BLI_kdtree_3d_new(curve_selection_.size());
-    BLI_SCOPED_DEFER([&]() { BLI_kdtree_3d_free(root_points_kdtree_); });
-    curve_selection_.foreach_index([&](const int curve_i) {
-      const float3 &pos_cu = self_->deformed_root_positions_[curve_i];
-      BLI_kdtree_3d_insert(root_points_kdtree_, curve_i, pos_cu);
-    });
-    BLI_kdtree_3d_balance(root_points_kdtree_);
+    if (self_->root_points_kdtree_ == nullptr) {
+      self_->root_points_kdtree_ = BLI_kdtree_3d_new(curve_selection_.size());
+      curve_selection_.foreach_index([&](const int curve_i) {
+        const float3 &pos_cu = self_->deformed_root_positions_[curve_i];
+        BLI_kdtree_3d_insert(self_->root_points_kdtree_, curve_i, pos_cu);
+      });
+      BLI_kdtree_3d_balance(self_->root_points_kdtree_);
+    }
+    root_points_kdtree_ = self_->root_points_kdtree_;
 
     /* Find all curves that should be deleted. */
     Array<bool> curves_to_keep(curves_->curves_num(), true);
@@ -601,6 +619,13 @@ struct DensitySubtractOperationExecutor {
 
     IndexMaskMemory mask_memory;
     const IndexMask mask_to_keep = IndexMask::from_bools(curves_to_keep, mask_memory);
+    if (mask_to_keep.size() == curves_->curves_num()) {
+      return;
+    }
+
+    /* Curve indices change when curves are removed. */
+    BLI_kdtree_3d_free(self_->root_points_kdtree_);
+    self_->root_points_kdtree_ = nullptr;
 
     /* Remove deleted curves from the stored deformed root positions. */
     BLI_assert(curves_->curves_num() == self_->deformed_root_positions_.size());
@@ -5236,6 +5236,12 @@ static void do_projectpaint_thread(TaskPool *__restrict /*pool*/, void *ph_v)
                               false :
                               (brush->flag & BRUSH_LOCK_ALPHA) != 0;
 
+  /* Constant for the whole stroke step, look it up once instead of for every pixel. */
+  const MTex *color_mtex = ps->is_texbrush ?
+                               BKE_brush_color_texture_get(brush, OB_MODE_TEXTURE_PAINT) :
+                               nullptr;
+  const bool color_mtex_3d = color_mtex && color_mtex->brush_map_mode == MTEX_MAP_MODE_3D;
+
   LinkNode *smearPixels = nullptr;
   LinkNode *smearPixels_f = nullptr;
   /* mem arena for this brush projection only */
@@ -5445,13 +5451,12 @@ static void do_projectpaint_thread(TaskPool *__restrict /*pool*/, void *ph_v)
 
             /* Color texture (alpha used as mask). */
             if (ps->is_texbrush) {
-              const MTex *mtex = BKE_brush_color_texture_get(brush, OB_MODE_TEXTURE_PAINT);
               float samplecos[3];
               float texrgba[4];
 
               /* taking 3d copy to account for 3D mapping too.
                * It gets concatenated during sampling */
-              if (mtex->brush_map_mode == MTEX_MAP_MODE_3D) {
+              if (color_mtex_3d) {
                 copy_v3_v3(samplecos, projPixel->worldCoSS);
               }
               else {
@@ -5462,7 +5467,7 @@ static void do_projectpaint_thread(TaskPool *__restrict /*pool*/, void *ph_v)
               /* NOTE: for clone and smear,
                * we only use the alpha, could be a special function */
               BKE_brush_sample_tex_3d(
-                  ps->scene, brush, mtex, samplecos, texrgba, thread_index, pool);
+                  ps->scene, brush, color_mtex, samplecos, texrgba, thread_index, pool);
 
               copy_v3_v3(texrgb, texrgba);
               custom_mask *= texrgba[3];
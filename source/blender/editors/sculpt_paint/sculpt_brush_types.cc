@@ -260,6 +260,11 @@ static void do_draw_brush_task(Object *ob, const Brush *brush, const float *offs
   AutomaskingNodeData automask_data;
   SCULPT_automasking_node_begin(ob, ss->cache->automasking, &automask_data, node);
 
+  /* Constant for the whole node, don't re-check it for every vertex. */
+  const bool use_color_as_displacement = (ss->cache->brush->flag2 &
+                                          BRUSH_USE_COLOR_AS_DISPLACEMENT) &&
+                                         (brush->mtex.brush_map_mode == MTEX_MAP_MODE_AREA);
+
   BKE_pbvh_vertex_iter_begin (ss->pbvh, node, vd, PBVH_ITER_UNIQUE) {
     if (!sculpt_brush_test_sq_fn(&test, vd.co)) {
       continue;
@@ -268,9 +273,7 @@ static void do_draw_brush_task(Object *ob, const Brush *brush, const float *offs
     SCULPT_automasking_node_update(&automask_data, &vd);
 
     /* Offset vertex. */
-    if (ss->cache->brush->flag2 & BRUSH_USE_COLOR_AS_DISPLACEMENT &&
-        (brush->mtex.brush_map_mode == MTEX_MAP_MODE_AREA))
-    {
+    if (use_color_as_displacement) {
       float r_rgba[4];
       SCULPT_brush_strength_color(ss,
                                   brush,
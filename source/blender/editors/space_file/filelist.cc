@@ -2643,6 +2643,11 @@ bool filelist_cache_previews_update(FileList *filelist)
 
     MEM_freeN(preview);
     cache->previews_todo_count--;
+
+    if (cache->previews_todo_count == 0) {
+      /* Don't keep `.blend` files opened for reading previews once all previews are loaded. */
+      IMB_thumb_blend_handles_clear();
+    }
   }
 
   return changed;
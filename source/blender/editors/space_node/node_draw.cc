@@ -3193,6 +3193,13 @@ static void node_draw_hidden(const bContext &C,
                              uiBlock &block)
 {
   const rctf &rct = node.runtime->totr;
+
+  /* Skip if out of view. */
+  if (BLI_rctf_isect(&rct, &v2d.cur, nullptr) == false) {
+    UI_block_end(&C, &block);
+    return;
+  }
+
   float centy = BLI_rctf_cent_y(&rct);
   float hiddenrad = BLI_rctf_size_y(&rct) / 2.0f;
 
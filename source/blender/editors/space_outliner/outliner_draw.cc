@@ -3344,12 +3344,13 @@ static void outliner_draw_tree_element(bContext *C,
   float ufac = UI_UNIT_X / 20.0f;
   int offsx = 0;
   eOLDrawState active = OL_DRAWSEL_NONE;
-  uchar text_color[4];
-  UI_GetThemeColor4ubv(TH_TEXT, text_color);
-  float icon_bgcolor[4], icon_border[4];
-  outliner_icon_background_colors(icon_bgcolor, icon_border);
 
   if (*starty + 2 * UI_UNIT_Y >= region->v2d.cur.ymin && *starty <= region->v2d.cur.ymax) {
+    uchar text_color[4];
+    UI_GetThemeColor4ubv(TH_TEXT, text_color);
+    float icon_bgcolor[4], icon_border[4];
+    outliner_icon_background_colors(icon_bgcolor, icon_border);
+
     const float alpha_fac = element_should_draw_faded(tvc, te, tselem) ? 0.5f : 1.0f;
     int xmax = region->v2d.cur.xmax;
 
@@ -3582,6 +3583,7 @@ static void outliner_draw_hierarchy_line(
 }
 
 static void outliner_draw_hierarchy_lines_recursive(uint pos,
+                                                    const View2D *v2d,
                                                     SpaceOutliner *space_outliner,
                                                     ListBase *lb,
                                                     int startx,
@@ -3628,8 +3630,19 @@ static void outliner_draw_hierarchy_lines_recursive(uint pos,
         }
       }
 
-      outliner_draw_hierarchy_lines_recursive(
-          pos, space_outliner, &te->subtree, startx + UI_UNIT_X, col, draw_grayed_out, starty);
+      outliner_draw_hierarchy_lines_recursive(pos,
+                                              v2d,
+                                              space_outliner,
+                                              &te->subtree,
+                                              startx + UI_UNIT_X,
+                                              col,
+                                              draw_grayed_out,
+                                              starty);
+    }
+
+    /* Skip lines that are entirely outside of the view, the line goes down from `y`. */
+    if (draw_hierarchy_line && (y < v2d->cur.ymin - UI_UNIT_Y || *starty > v2d->cur.ymax)) {
+      draw_hierarchy_line = false;
     }
 
     if (draw_hierarchy_line) {
@@ -3645,7 +3658,8 @@ static void outliner_draw_hierarchy_lines_recursive(uint pos,
   }
 }
 
-static void outliner_draw_hierarchy_lines(SpaceOutliner *space_outliner,
+static void outliner_draw_hierarchy_lines(const View2D *v2d,
+                                          SpaceOutliner *space_outliner,
                                           ListBase *lb,
                                           int startx,
                                           int *starty)
@@ -3666,7 +3680,8 @@ static void outliner_draw_hierarchy_lines(SpaceOutliner *space_outliner,
 
   GPU_line_width(1.0f);
   GPU_blend(GPU_BLEND_ALPHA);
-  outliner_draw_hierarchy_lines_recursive(pos, space_outliner, lb, startx, col, false, starty);
+  outliner_draw_hierarchy_lines_recursive(
+      pos, v2d, space_outliner, lb, startx, col, false, starty);
   GPU_blend(GPU_BLEND_NONE);
 
   immUnbindProgram();
@@ -3730,6 +3745,13 @@ static void outliner_draw_highlights(uint pos,
     const TreeStoreElem *tselem = TREESTORE(te);
     const int start_y = *io_start_y;
 
+    /* Only rows in view are drawn, with many selected elements this avoids drawing (and
+     * uploading) highlights that can't be seen. */
+    if (start_y + 2 * UI_UNIT_Y < region->v2d.cur.ymin || start_y > region->v2d.cur.ymax) {
+      *io_start_y -= UI_UNIT_Y;
+      return;
+    }
+
     /* Selection status. */
     if ((tselem->flag & TSE_ACTIVE) && (tselem->flag & TSE_SELECTED)) {
       immUniformColor4fv(col_active);
@@ -3868,7 +3890,8 @@ static void outliner_draw_tree(bContext *C,
   /* Draw hierarchy lines for collections and object children. */
   starty = int(region->v2d.tot.ymax) - OL_Y_OFFSET;
   startx = columns_offset + UI_UNIT_X / 2 - (U.pixelsize + 1) / 2;
-  outliner_draw_hierarchy_lines(space_outliner, &space_outliner->tree, startx, &starty);
+  outliner_draw_hierarchy_lines(
+      &region->v2d, space_outliner, &space_outliner->tree, startx, &starty);
 
   /* Items themselves. */
   starty = int(region->v2d.tot.ymax) - UI_UNIT_Y - OL_Y_OFFSET;
@@ -104,15 +104,17 @@ static bool raycastMesh(SnapObjectContext *sctx,
     local_depth *= local_scale;
   }
 
-  /* Test bounding box */
-  if (ob_eval->data == me_eval) {
-    const Bounds<float3> bounds = *me_eval->bounds_min_max();
-    /* was BKE_boundbox_ray_hit_check, see: cf6ca226fa58 */
-    if (!isect_ray_aabb_v3_simple(
-            ray_start_local, ray_normal_local, bounds.min, bounds.max, &len_diff, nullptr))
-    {
-      return retval;
-    }
+  /* Test bounding box. The bounds are cached on the mesh, so this is also done for instances
+   * (which don't match `ob_eval->data`), skipping most of them cheaply in dense scenes. */
+  const std::optional<Bounds<float3>> bounds = me_eval->bounds_min_max();
+  if (!bounds) {
+    return retval;
+  }
+  /* was BKE_boundbox_ray_hit_check, see: cf6ca226fa58 */
+  if (!isect_ray_aabb_v3_simple(
+          ray_start_local, ray_normal_local, bounds->min, bounds->max, &len_diff, nullptr))
+  {
+    return retval;
   }
 
   /* We pass a temp ray_start, set from object's boundbox, to avoid precision issues with
@@ -446,11 +448,11 @@ static eSnapMode snapMesh(SnapObjectContext *sctx,
   BLI_assert(snap_to != SCE_SNAP_TO_FACE);
   SnapData_Mesh nearest2d(sctx, me_eval, obmat);
 
-  if (ob_eval->data == me_eval) {
-    const Bounds<float3> bounds = *me_eval->bounds_min_max();
-    if (!nearest2d.snap_boundbox(bounds.min, bounds.max)) {
-      return SCE_SNAP_TO_NONE;
-    }
+  /* Cull meshes outside of the snapping distance before touching their BVH trees, including
+   * instanced meshes. */
+  const std::optional<Bounds<float3>> bounds = me_eval->bounds_min_max();
+  if (!bounds || !nearest2d.snap_boundbox(bounds->min, bounds->max)) {
+    return SCE_SNAP_TO_NONE;
   }
 
   snap_to &= mesh_snap_mode_supported(me_eval) & (SNAP_TO_EDGE_ELEMENTS | SCE_SNAP_TO_POINT);
@@ -114,6 +114,12 @@ class MultiFunction : NonCopyable, NonMovable {
      * memory usage.
      */
     bool allocates_array = false;
+    /**
+     * Suggested maximum number of indices that are processed at once when #allocates_array is
+     * true. Functions allocating many or large arrays can lower this, so that the arrays still
+     * fit into the CPU cache while processing a chunk.
+     */
+    int64_t max_grain_size = 10000;
     /**
      * Tells the caller that every execution takes about the same time. This helps making a more
      * educated guess about a good grain size.
@@ -17,6 +17,8 @@ class ProcedureExecutor : public MultiFunction {
  private:
   Signature signature_;
   const Procedure &procedure_;
+  /** Size of one element of all intermediate single value variables in the procedure. */
+  int64_t intermediate_bytes_per_element_ = 0;
 
  public:
   ProcedureExecutor(const Procedure &procedure);
@@ -371,6 +371,10 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
     mf::Procedure procedure;
     build_multi_function_procedure_for_fields(
         procedure, scope, field_tree_info, varying_fields_to_evaluate);
+    /* NOTE: The procedure is interpreted. Compiling it to native code is not possible currently,
+     * because the multi-functions it calls are opaque compiled C++ code (often templated element
+     * lambdas) which could only be inlined if they had a separate IR representation. The
+     * interpreter overhead is amortized by processing many elements per call instead. */
     mf::ProcedureExecutor procedure_executor{procedure};
 
     mf::ParamsBuilder mf_params{procedure_executor, &mask};
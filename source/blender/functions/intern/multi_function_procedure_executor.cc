@@ -4,6 +4,7 @@
 
 #include "FN_multi_function_procedure_executor.hh"
 
+#include "BLI_set.hh"
 #include "BLI_stack.hh"
 
 namespace blender::fn::multi_function {
@@ -17,6 +18,16 @@ ProcedureExecutor::ProcedureExecutor(const Procedure &procedure) : procedure_(pr
   }
 
   this->set_signature(&signature_);
+
+  Set<const Variable *> param_variables;
+  for (const ConstParameter &param : procedure.params()) {
+    param_variables.add(param.variable);
+  }
+  for (const Variable *variable : procedure.variables()) {
+    if (variable->data_type().is_single() && !param_variables.contains(variable)) {
+      intermediate_bytes_per_element_ += variable->data_type().single_type().size();
+    }
+  }
 }
 
 using IndicesSplitVectors = std::array<Vector<int64_t>, 2>;
@@ -1246,6 +1257,14 @@ MultiFunction::ExecutionHints ProcedureExecutor::get_execution_hints() const
   ExecutionHints hints;
   hints.allocates_array = true;
   hints.min_grain_size = 10000;
+  /* Large procedures (e.g. from field trees with many math nodes) would otherwise process chunks
+   * whose intermediate arrays don't fit into the CPU cache anymore, making the evaluation memory
+   * bandwidth bound. Not all variables are alive at the same time, so this is conservative. */
+  const int64_t cache_budget_bytes = 256 * 1024;
+  if (intermediate_bytes_per_element_ > 0) {
+    hints.max_grain_size = std::clamp<int64_t>(
+        cache_budget_bytes / intermediate_bytes_per_element_, 1024, hints.max_grain_size);
+  }
   return hints;
 }
 
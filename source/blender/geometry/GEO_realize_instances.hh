@@ -34,6 +34,12 @@ struct RealizeInstancesOptions {
  * The `id` attribute has special handling. If there is an id attribute on any component, the
  * output will contain an `id` attribute as well. The output id is generated by mixing/hashing ids
  * of instances and of the instanced geometry data.
+ *
+ * \note The realized geometry is always fully allocated upfront and filled in parallel, so the
+ * peak memory usage is the size of the input plus the output. The result can't be produced in
+ * batches, because geometry nodes pass complete geometries between nodes and fields are evaluated
+ * on entire domains. When memory is the limiting factor, it's best to keep the data instanced
+ * (render engines support instancing directly) and to only realize what has to be modified.
  */
 bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
                                    const RealizeInstancesOptions &options);
@@ -0,0 +1,51 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+#include "BLI_array.hh"
+#include "BLI_math_vector_types.hh"
+#include "BLI_span.hh"
+
+struct Mesh;
+struct PointCloud;
+namespace blender::bke {
+class CurvesGeometry;
+class Instances;
+}  // namespace blender::bke
+
+/** \file
+ * \ingroup geo
+ */
+
+namespace blender::geometry {
+
+/**
+ * Compute the order of the positions along a Morton (Z-order) space-filling curve. Elements that
+ * are close in space are close in memory in that order, which improves cache locality of
+ * algorithms that process neighboring elements together.
+ *
+ * \return The old index for every new index.
+ */
+Array<int> spatial_sort_order(Span<float3> positions);
+
+/**
+ * Change the order of elements, reordering all attributes and remapping the topology that refers
+ * to them. The maps contain the new index for every old index.
+ */
+void reorder_mesh_verts(Mesh &mesh, Span<int> new_by_old_map);
+void reorder_mesh_edges(Mesh &mesh, Span<int> new_by_old_map);
+void reorder_mesh_faces(Mesh &mesh, Span<int> new_by_old_map);
+void reorder_points(PointCloud &pointcloud, Span<int> new_by_old_map);
+void reorder_curves(bke::CurvesGeometry &curves, Span<int> new_by_old_map);
+void reorder_instances(bke::Instances &instances, Span<int> new_by_old_map);
+
+/**
+ * Reorder vertices, edges and faces along a space-filling curve, based on vertex positions, edge
+ * midpoints and face centers. The order of corners within each face is not changed.
+ */
+void spatially_reorder_mesh(Mesh &mesh);
+void spatially_reorder_points(PointCloud &pointcloud);
+
+}  // namespace blender::geometry
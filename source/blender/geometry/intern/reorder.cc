@@ -0,0 +1,334 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include <cmath>
+#include <limits>
+
+#include "GEO_reorder.hh"
+
+#include "DNA_mesh_types.h"
+#include "DNA_meshdata_types.h"
+#include "DNA_pointcloud_types.h"
+
+#include "BKE_curves.hh"
+#include "BKE_customdata.hh"
+#include "BKE_geometry_set.hh"
+#include "BKE_instances.hh"
+#include "BKE_mesh.hh"
+
+#include "BLI_array_utils.hh"
+#include "BLI_bounds.hh"
+#include "BLI_sort.hh"
+#include "BLI_task.hh"
+
+namespace blender::geometry {
+
+/* -------------------------------------------------------------------- */
+/** \name Spatial Sort Order
+ * \{ */
+
+/** Spread the lower 21 bits of the value so that there are two zero bits between each bit. */
+static uint64_t morton_spread_bits(uint64_t value)
+{
+  value &= 0x1fffff;
+  value = (value | (value << 32)) & 0x001f00000000ffff;
+  value = (value | (value << 16)) & 0x001f0000ff0000ff;
+  value = (value | (value << 8)) & 0x100f00f00f00f00f;
+  value = (value | (value << 4)) & 0x10c30c30c30c30c3;
+  value = (value | (value << 2)) & 0x1249249249249249;
+  return value;
+}
+
+/**
+ * Bounds of the finite coordinates, computed per axis so that one infinite or NaN component
+ * doesn't affect the other axes.
+ */
+static Bounds<float3> finite_bounds(const Span<float3> positions)
+{
+  const Bounds<float3> init{float3(std::numeric_limits<float>::max()),
+                            float3(std::numeric_limits<float>::lowest())};
+  Bounds<float3> bounds = threading::parallel_reduce(
+      positions.index_range(),
+      1024,
+      init,
+      [&](const IndexRange range, const Bounds<float3> &init) {
+        Bounds<float3> result = init;
+        for (const int i : range) {
+          for (const int axis : IndexRange(3)) {
+            const float value = positions[i][axis];
+            if (std::isfinite(value)) {
+              result.min[axis] = std::min(result.min[axis], value);
+              result.max[axis] = std::max(result.max[axis], value);
+            }
+          }
+        }
+        return result;
+      },
+      [](const Bounds<float3> &a, const Bounds<float3> &b) { return bounds::merge(a, b); });
+  for (const int axis : IndexRange(3)) {
+    if (bounds.min[axis] > bounds.max[axis]) {
+      /* No finite coordinate on this axis, it doesn't contribute to the order. */
+      bounds.min[axis] = 0.0f;
+      bounds.max[axis] = 0.0f;
+    }
+  }
+  return bounds;
+}
+
+/**
+ * Map a coordinate to the quantization grid. Non-finite values are placed at the start of the
+ * grid, converting them to an integer directly would be undefined behavior.
+ */
+static uint64_t quantize_coordinate(const float value,
+                                    const float min,
+                                    const float scale,
+                                    const float grid_max)
+{
+  const float grid_value = (value - min) * scale;
+  if (!(grid_value >= 0.0f)) {
+    /* Also catches NaN. */
+    return 0;
+  }
+  /* Clamp to avoid wrapping around because of floating point precision at the maximum. */
+  return uint64_t(std::min(grid_value, grid_max));
+}
+
+Array<int> spatial_sort_order(const Span<float3> positions)
+{
+  Array<int> old_by_new_map(positions.size());
+  if (positions.is_empty()) {
+    return old_by_new_map;
+  }
+  const Bounds<float3> bounds = finite_bounds(positions);
+
+  /* Quantize the positions to 21 bits per axis, so that the interleaved codes fit in 64 bits. */
+  constexpr float grid_max = float((1 << 21) - 1);
+  const float3 size = bounds.max - bounds.min;
+  /* The size can overflow to infinity for very large coordinates, the scale is zero then. */
+  const float3 scale(size.x > 0.0f ? grid_max / size.x : 0.0f,
+                     size.y > 0.0f ? grid_max / size.y : 0.0f,
+                     size.z > 0.0f ? grid_max / size.z : 0.0f);
+
+  Array<uint64_t> codes(positions.size());
+  threading::parallel_for(positions.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      const float3 &position = positions[i];
+      codes[i] =
+          morton_spread_bits(quantize_coordinate(position.x, bounds.min.x, scale.x, grid_max)) |
+          (morton_spread_bits(quantize_coordinate(position.y, bounds.min.y, scale.y, grid_max))
+           << 1) |
+          (morton_spread_bits(quantize_coordinate(position.z, bounds.min.z, scale.z, grid_max))
+           << 2);
+    }
+  });
+
+  radix_sort_indices(codes.as_span(), old_by_new_map);
+  return old_by_new_map;
+}
+
+static Array<int> invert_permutation(const Span<int> permutation)
+{
+  Array<int> data(permutation.size());
+  threading::parallel_for(permutation.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      data[permutation[i]] = i;
+    }
+  });
+  return data;
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Reorder Elements
+ * \{ */
+
+static void reorder_customdata(CustomData &data, const Span<int> new_by_old_map)
+{
+  CustomData new_data;
+  CustomData_copy_layout(&data, &new_data, CD_MASK_ALL, CD_CONSTRUCT, new_by_old_map.size());
+
+  /* Every element is copied to a different destination, so the copies can run in parallel. */
+  threading::parallel_for(new_by_old_map.index_range(), 1024, [&](const IndexRange range) {
+    for (const int old_i : range) {
+      const int new_i = new_by_old_map[old_i];
+      CustomData_copy_data(&data, &new_data, old_i, new_i, 1);
+    }
+  });
+  CustomData_free(&data, new_by_old_map.size());
+  data = new_data;
+}
+
+static Array<int> make_new_offset_indices(const OffsetIndices<int> old_offsets,
+                                          const Span<int> old_by_new_map)
+{
+  Array<int> new_offsets(old_offsets.data().size());
+  new_offsets[0] = 0;
+  for (const int new_i : old_offsets.index_range()) {
+    const int old_i = old_by_new_map[new_i];
+    new_offsets[new_i + 1] = new_offsets[new_i] + old_offsets[old_i].size();
+  }
+  return new_offsets;
+}
+
+static void reorder_customdata_groups(CustomData &data,
+                                      const OffsetIndices<int> old_offsets,
+                                      const OffsetIndices<int> new_offsets,
+                                      const Span<int> new_by_old_map)
+{
+  const int elements_num = new_offsets.total_size();
+  const int groups_num = new_by_old_map.size();
+  CustomData new_data;
+  CustomData_copy_layout(&data, &new_data, CD_MASK_ALL, CD_CONSTRUCT, elements_num);
+  threading::parallel_for(IndexRange(groups_num), 512, [&](const IndexRange range) {
+    for (const int old_i : range) {
+      const int new_i = new_by_old_map[old_i];
+      const IndexRange old_range = old_offsets[old_i];
+      const IndexRange new_range = new_offsets[new_i];
+      BLI_assert(old_range.size() == new_range.size());
+      CustomData_copy_data(
+          &data, &new_data, old_range.start(), new_range.start(), old_range.size());
+    }
+  });
+  CustomData_free(&data, elements_num);
+  data = new_data;
+}
+
+static void remap_indices(MutableSpan<int> indices, const Span<int> new_by_old_map)
+{
+  threading::parallel_for(indices.index_range(), 4096, [&](const IndexRange range) {
+    for (int &index : indices.slice(range)) {
+      index = new_by_old_map[index];
+    }
+  });
+}
+
+void reorder_mesh_verts(Mesh &mesh, const Span<int> new_by_old_map)
+{
+  BLI_assert(new_by_old_map.size() == mesh.totvert);
+  reorder_customdata(mesh.vert_data, new_by_old_map);
+  remap_indices(mesh.edges_for_write().cast<int>(), new_by_old_map);
+  remap_indices(mesh.corner_verts_for_write(), new_by_old_map);
+  BKE_mesh_tag_topology_changed(&mesh);
+}
+
+void reorder_mesh_edges(Mesh &mesh, const Span<int> new_by_old_map)
+{
+  BLI_assert(new_by_old_map.size() == mesh.totedge);
+  reorder_customdata(mesh.edge_data, new_by_old_map);
+  remap_indices(mesh.corner_edges_for_write(), new_by_old_map);
+  BKE_mesh_tag_topology_changed(&mesh);
+}
+
+void reorder_mesh_faces(Mesh &mesh, const Span<int> new_by_old_map)
+{
+  BLI_assert(new_by_old_map.size() == mesh.faces_num);
+  const Array<int> old_by_new_map = invert_permutation(new_by_old_map);
+
+  reorder_customdata(mesh.face_data, new_by_old_map);
+
+  const OffsetIndices old_faces = mesh.faces();
+  Array<int> new_face_offsets = make_new_offset_indices(old_faces, old_by_new_map);
+  const OffsetIndices<int> new_faces = new_face_offsets.as_span();
+
+  reorder_customdata_groups(mesh.loop_data, old_faces, new_faces, new_by_old_map);
+
+  mesh.face_offsets_for_write().copy_from(new_face_offsets);
+
+  BKE_mesh_tag_topology_changed(&mesh);
+}
+
+void reorder_points(PointCloud &pointcloud, const Span<int> new_by_old_map)
+{
+  BLI_assert(new_by_old_map.size() == pointcloud.totpoint);
+  reorder_customdata(pointcloud.pdata, new_by_old_map);
+  pointcloud.tag_positions_changed();
+  pointcloud.tag_radii_changed();
+}
+
+void reorder_curves(bke::CurvesGeometry &curves, const Span<int> new_by_old_map)
+{
+  BLI_assert(new_by_old_map.size() == curves.curve_num);
+  const Array<int> old_by_new_map = invert_permutation(new_by_old_map);
+
+  reorder_customdata(curves.curve_data, new_by_old_map);
+
+  const OffsetIndices old_points_by_curve = curves.points_by_curve();
+  Array<int> new_curve_offsets = make_new_offset_indices(old_points_by_curve, old_by_new_map);
+  const OffsetIndices<int> new_points_by_curve = new_curve_offsets.as_span();
+
+  reorder_customdata_groups(
+      curves.point_data, old_points_by_curve, new_points_by_curve, new_by_old_map);
+
+  curves.offsets_for_write().copy_from(new_curve_offsets);
+
+  curves.tag_topology_changed();
+}
+
+void reorder_instances(bke::Instances &instances, const Span<int> new_by_old_map)
+{
+  const int instances_num = instances.instances_num();
+  BLI_assert(new_by_old_map.size() == instances_num);
+
+  reorder_customdata(instances.custom_data_attributes(), new_by_old_map);
+
+  const Span<int> old_reference_handles = instances.reference_handles();
+  const Span<float4x4> old_transforms = instances.transforms();
+
+  Vector<int> new_reference_handles(instances_num);
+  Vector<float4x4> new_transforms(instances_num);
+
+  for (const int old_i : new_by_old_map.index_range()) {
+    const int new_i = new_by_old_map[old_i];
+    new_reference_handles[new_i] = old_reference_handles[old_i];
+    new_transforms[new_i] = old_transforms[old_i];
+  }
+
+  instances.reference_handles().copy_from(new_reference_handles);
+  instances.transforms().copy_from(new_transforms);
+}
+
+/** \} */
+
+/* -------------------------------------------------------------------- */
+/** \name Spatial Reordering
+ * \{ */
+
+void spatially_reorder_mesh(Mesh &mesh)
+{
+  reorder_mesh_verts(mesh, invert_permutation(spatial_sort_order(mesh.vert_positions())));
+
+  /* Edges and faces are sorted with the already reordered vertex positions. */
+  const Span<float3> positions = mesh.vert_positions();
+  {
+    const Span<int2> edges = mesh.edges();
+    Array<float3> midpoints(edges.size());
+    threading::parallel_for(edges.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        midpoints[i] = math::midpoint(positions[edges[i][0]], positions[edges[i][1]]);
+      }
+    });
+    reorder_mesh_edges(mesh, invert_permutation(spatial_sort_order(midpoints)));
+  }
+  {
+    const OffsetIndices faces = mesh.faces();
+    const Span<int> corner_verts = mesh.corner_verts();
+    Array<float3> centers(faces.size());
+    threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
+      for (const int i : range) {
+        centers[i] = bke::mesh::face_center_calc(positions, corner_verts.slice(faces[i]));
+      }
+    });
+    reorder_mesh_faces(mesh, invert_permutation(spatial_sort_order(centers)));
+  }
+}
+
+void spatially_reorder_points(PointCloud &pointcloud)
+{
+  reorder_points(pointcloud, invert_permutation(spatial_sort_order(pointcloud.positions())));
+}
+
+/** \} */
+
+}  // namespace blender::geometry
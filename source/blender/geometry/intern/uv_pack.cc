@@ -22,6 +22,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_rect.h"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "DNA_meshdata_types.h"
@@ -1925,16 +1926,29 @@ static float pack_islands_scale_margin(const Span<PackIsland *> islands,
     pack_islands_optimal_pack(slow_aabbs, params, r_phis, &extent);
   }
 
-  /* Call box_pack_2d (slow for large N.) */
-  if (locked_island_count == 0) { /* box_pack_2d doesn't yet support locked islands. */
-    pack_island_box_pack_2d(slow_aabbs, params, r_phis, &extent);
-  }
-
-  /* Call xatlas (slow for large N.) */
-  int64_t max_xatlas = pack_island_xatlas(
-      slow_aabbs, islands, scale, margin, params, r_phis, &extent);
-  if (max_xatlas) {
+  /* Call box_pack_2d and xatlas (both slow for large N.) at the same time. xatlas writes to its
+   * own layout, which is used when it's better than the box_pack_2d layout. This gives the same
+   * result as calling them one after the other, xatlas just can't exit early as often. */
+  rctf xatlas_extent = extent;
+  Array<UVPhi> xatlas_phis(r_phis.size());
+  int64_t max_xatlas = 0;
+  threading::parallel_invoke(
+      slow_aabbs.size() > 64,
+      [&]() {
+        if (locked_island_count == 0) { /* box_pack_2d doesn't yet support locked islands. */
+          pack_island_box_pack_2d(slow_aabbs, params, r_phis, &extent);
+        }
+      },
+      [&]() {
+        max_xatlas = pack_island_xatlas(
+            slow_aabbs, islands, scale, margin, params, xatlas_phis, &xatlas_extent);
+      });
+  if (max_xatlas && is_larger(extent, xatlas_extent, params)) {
+    extent = xatlas_extent;
     slow_aabbs = aabbs.as_span().take_front(max_xatlas);
+    for (const std::unique_ptr<UVAABBIsland> &aabb : slow_aabbs) {
+      r_phis[aabb->index] = xatlas_phis[aabb->index];
+    }
   }
 
   /* At this stage, `extent` contains the fast/optimal/box_pack/xatlas UVs. */
@@ -2234,15 +2248,18 @@ class OverlapMerger {
 
 static void finalize_geometry(const Span<PackIsland *> &islands, const UVPackIsland_Params &params)
 {
-  MemArena *arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
-  Heap *heap = BLI_heap_new();
-  for (const int64_t i : islands.index_range()) {
-    islands[i]->finalize_geometry_(params, arena, heap);
-    BLI_memarena_clear(arena);
-  }
-
-  BLI_heap_free(heap, nullptr);
-  BLI_memarena_free(arena);
+  /* Islands are independent, finalize them in parallel, with scratch storage for each task. */
+  threading::parallel_for(islands.index_range(), 16, [&](const IndexRange range) {
+    MemArena *arena = BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, __func__);
+    Heap *heap = BLI_heap_new();
+    for (const int64_t i : range) {
+      islands[i]->finalize_geometry_(params, arena, heap);
+      BLI_memarena_clear(arena);
+    }
+
+    BLI_heap_free(heap, nullptr);
+    BLI_memarena_free(arena);
+  });
 }
 
 float pack_islands(const Span<PackIsland *> &islands, const UVPackIsland_Params &params)
@@ -18,6 +18,7 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 
 #include "GEO_uv_pack.hh"
 
@@ -3961,45 +3962,60 @@ void uv_parametrizer_lscm_begin(ParamHandle *phandle, bool live, bool abf)
   BLI_assert(phandle->state == PHANDLE_STATE_CONSTRUCTED);
   phandle->state = PHANDLE_STATE_LSCM;
 
-  for (int i = 0; i < phandle->ncharts; i++) {
-    for (PFace *f = phandle->charts[i]->faces; f; f = f->nextlink) {
-      p_face_backup_uvs(f);
+  /* Charts don't share any data, so they can be set up independently. The grain size is small
+   * because the cost of a chart (especially with ABF) varies a lot with its size. */
+  threading::parallel_for(IndexRange(phandle->ncharts), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      for (PFace *f = phandle->charts[i]->faces; f; f = f->nextlink) {
+        p_face_backup_uvs(f);
+      }
+      p_chart_lscm_begin(phandle->charts[i], live, abf);
     }
-    p_chart_lscm_begin(phandle->charts[i], live, abf);
-  }
+  });
 }
 
 void uv_parametrizer_lscm_solve(ParamHandle *phandle, int *count_changed, int *count_failed)
 {
   BLI_assert(phandle->state == PHANDLE_STATE_LSCM);
 
-  for (int i = 0; i < phandle->ncharts; i++) {
-    PChart *chart = phandle->charts[i];
+  enum class SolveResult : int8_t { Skipped, Changed, Failed };
+  Array<SolveResult> results(phandle->ncharts, SolveResult::Skipped);
 
-    if (!chart->context) {
-      continue;
-    }
-    const bool result = p_chart_lscm_solve(phandle, chart);
+  /* Every chart has its own linear solver, so the charts can be solved in parallel. */
+  threading::parallel_for(IndexRange(phandle->ncharts), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      PChart *chart = phandle->charts[i];
 
-    if (result && !chart->has_pins) {
-      /* Every call to LSCM will eventually call uv_pack, so rotating here might be redundant. */
-      p_chart_rotate_minimum_area(chart);
-    }
-    else if (result && chart->single_pin) {
-      p_chart_rotate_fit_aabb(chart);
-      p_chart_lscm_transform_single_pin(chart);
-    }
+      if (!chart->context) {
+        continue;
+      }
+      const bool result = p_chart_lscm_solve(phandle, chart);
 
-    if (!result || !chart->has_pins) {
-      p_chart_lscm_end(chart);
+      if (result && !chart->has_pins) {
+        /* Every call to LSCM will eventually call uv_pack, so rotating here might be
+         * redundant. */
+        p_chart_rotate_minimum_area(chart);
+      }
+      else if (result && chart->single_pin) {
+        p_chart_rotate_fit_aabb(chart);
+        p_chart_lscm_transform_single_pin(chart);
+      }
+
+      if (!result || !chart->has_pins) {
+        p_chart_lscm_end(chart);
+      }
+
+      results[i] = result ? SolveResult::Changed : SolveResult::Failed;
     }
+  });
 
-    if (result) {
+  for (const SolveResult result : results) {
+    if (result == SolveResult::Changed) {
       if (count_changed != nullptr) {
         *count_changed += 1;
       }
     }
-    else {
+    else if (result == SolveResult::Failed) {
       if (count_failed != nullptr) {
         *count_failed += 1;
       }
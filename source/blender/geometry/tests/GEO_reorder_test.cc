@@ -0,0 +1,71 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <limits>
+
+#include "BLI_array.hh"
+#include "BLI_index_range.hh"
+
+#include "GEO_reorder.hh"
+
+namespace blender::geometry::tests {
+
+/** Check that every index appears exactly once. */
+static void expect_permutation(const Span<int> indices)
+{
+  Array<bool> found(indices.size(), false);
+  for (const int index : indices) {
+    ASSERT_GE(index, 0);
+    ASSERT_LT(index, indices.size());
+    EXPECT_FALSE(found[index]);
+    found[index] = true;
+  }
+}
+
+TEST(spatial_sort_order, Empty)
+{
+  EXPECT_TRUE(spatial_sort_order({}).is_empty());
+}
+
+TEST(spatial_sort_order, Permutation)
+{
+  Array<float3> positions(1000);
+  for (const int i : positions.index_range()) {
+    positions[i] = float3((i * 7) % 10, (i * 13) % 10, (i * 17) % 10);
+  }
+  expect_permutation(spatial_sort_order(positions));
+}
+
+TEST(spatial_sort_order, Order)
+{
+  /* Points along a line in reverse order. */
+  const Array<float3> positions = {float3(3, 0, 0), float3(2, 0, 0), float3(1, 0, 0)};
+  const Array<int> order = spatial_sort_order(positions);
+  EXPECT_EQ_ARRAY(order.data(), Span<int>({2, 1, 0}).data(), 3);
+}
+
+TEST(spatial_sort_order, NonFinite)
+{
+  const float inf = std::numeric_limits<float>::infinity();
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const Array<float3> positions = {float3(1, 0, 0),
+                                   float3(nan, 0, 0),
+                                   float3(-inf, 2, 0),
+                                   float3(0, inf, nan),
+                                   float3(0, 0, 0),
+                                   float3(std::numeric_limits<float>::max(), 0, 0),
+                                   float3(std::numeric_limits<float>::lowest(), 1, 0)};
+  expect_permutation(spatial_sort_order(positions));
+}
+
+TEST(spatial_sort_order, AllNonFinite)
+{
+  const float nan = std::numeric_limits<float>::quiet_NaN();
+  const Array<float3> positions = {float3(nan), float3(nan), float3(nan)};
+  expect_permutation(spatial_sort_order(positions));
+}
+
+}  // namespace blender::geometry::tests
@@ -61,6 +61,7 @@ class GLContext : public Context {
   static bool multi_bind_support;
   static bool multi_bind_image_support;
   static bool multi_draw_indirect_support;
+  static bool program_binary_support;
   static bool shader_draw_parameters_support;
   static bool stencil_texturing_support;
   static bool texture_barrier_support;
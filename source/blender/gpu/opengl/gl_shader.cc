@@ -6,11 +6,20 @@
  * \ingroup gpu
  */
 
+#include "BKE_appdir.h"
 #include "BKE_global.h"
 
+#include "BLI_array.hh"
+#include "BLI_fileops.h"
+#include "BLI_fileops.hh"
+#include "BLI_fileops_types.h"
+#include "BLI_hash_md5.h"
+#include "BLI_path_util.h"
 #include "BLI_string.h"
 #include "BLI_vector.hh"
 
+#include "DNA_userdef_types.h"
+
 #include "GPU_capabilities.h"
 #include "GPU_platform.h"
 
@@ -20,7 +29,10 @@
 #include "gl_shader.hh"
 #include "gl_shader_interface.hh"
 
+#include <algorithm>
+#include <ctime>
 #include <sstream>
+#include <thread>
 
 using namespace blender;
 using namespace blender::gpu;
@@ -39,6 +51,8 @@ GLShader::GLShader(const char *name) : Shader(name)
   BLI_assert(GLContext::get() != nullptr);
 #endif
   shader_program_ = glCreateProgram();
+  use_binary_cache_ = GLContext::program_binary_support &&
+                      USER_EXPERIMENTAL_TEST(&U, use_shader_binary_cache);
 
   debug::object_label(GL_PROGRAM, shader_program_, name);
 }
@@ -1126,7 +1140,219 @@ char *GLShader::glsl_patch_get(GLenum gl_stage)
   return glsl_patch_default_get();
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Program Binary Cache
+ *
+ * Linked programs are stored on disk with `GL_ARB_get_program_binary`, so that the same shaders
+ * don't have to be compiled again in later sessions. Files are identified by a hash of the
+ * sources of all stages and the driver identification strings. When the driver rejects a binary
+ * (e.g. after a driver update that didn't change the version string), the program is compiled as
+ * usual and the file is replaced.
+ *
+ * Files are touched when they are used. Once per session, files that weren't used for a while
+ * are removed, and the least recently used files are removed when the cache grows too large.
+ * \{ */
+
+struct ProgramBinaryHeader {
+  char magic[4];
+  GLenum format;
+  GLint length;
+};
+
+static const char program_binary_magic[4] = {'B', 'G', 'L', 'P'};
+
+static constexpr int64_t program_binary_cache_max_size = int64_t(256) * 1024 * 1024;
+static constexpr int64_t program_binary_cache_max_age_seconds = int64_t(30) * 24 * 60 * 60;
+
+/** Remove old and least recently used files, to keep the cache below its size limit. */
+static void program_binary_cache_cleanup(const char *dir)
+{
+  if (!BLI_is_dir(dir)) {
+    return;
+  }
+  direntry *dir_entries = nullptr;
+  const int dir_entries_num = BLI_filelist_dir_contents(dir, &dir_entries);
+  const int64_t now = int64_t(time(nullptr));
+
+  Vector<const direntry *> files;
+  for (int i = 0; i < dir_entries_num; i++) {
+    const direntry &entry = dir_entries[i];
+    /* Also handles temporary files left over by a crash while writing. */
+    if (!BLI_str_endswith(entry.relname, ".bin") && !BLI_str_endswith(entry.relname, ".tmp")) {
+      continue;
+    }
+    if (now - int64_t(entry.s.st_mtime) > program_binary_cache_max_age_seconds) {
+      BLI_delete(entry.path, false, false);
+      continue;
+    }
+    files.append(&entry);
+  }
+
+  /* Keep the most recently used files. */
+  std::sort(files.begin(), files.end(), [](const direntry *a, const direntry *b) {
+    return a->s.st_mtime > b->s.st_mtime;
+  });
+  int64_t size = 0;
+  for (const direntry *entry : files) {
+    size += int64_t(entry->s.st_size);
+    if (size > program_binary_cache_max_size) {
+      BLI_delete(entry->path, false, false);
+    }
+  }
+
+  BLI_filelist_free(dir_entries, dir_entries_num);
+}
+
+static const std::string &program_binary_cache_dir()
+{
+  static const std::string dir = []() -> std::string {
+    char caches_dir[FILE_MAX];
+    if (!BKE_appdir_folder_caches(caches_dir, sizeof(caches_dir))) {
+      return "";
+    }
+    char dir[FILE_MAX];
+    BLI_path_join(dir, sizeof(dir), caches_dir, "shaders");
+    program_binary_cache_cleanup(dir);
+    return dir;
+  }();
+  return dir;
+}
+
+static std::string program_binary_cache_key(Span<std::pair<GLenum, std::string>> stages)
+{
+  if (program_binary_cache_dir().empty()) {
+    return "";
+  }
+  std::string data;
+  for (const GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION}) {
+    data += reinterpret_cast<const char *>(glGetString(name));
+    data += '\n';
+  }
+  for (const std::pair<GLenum, std::string> &stage : stages) {
+    data += std::to_string(stage.first);
+    data += '\n';
+    data += stage.second;
+  }
+  uint8_t digest[16];
+  BLI_hash_md5_buffer(data.data(), data.size(), digest);
+  char hex_digest[33];
+  BLI_hash_md5_to_hexdigest(digest, hex_digest);
+  return hex_digest;
+}
+
+static std::string program_binary_cache_filepath(StringRefNull key)
+{
+  char filepath[FILE_MAX];
+  BLI_path_join(
+      filepath, sizeof(filepath), program_binary_cache_dir().c_str(), (key + ".bin").c_str());
+  return filepath;
+}
+
+static bool program_binary_cache_load(const GLuint program, StringRefNull key)
+{
+  if (key.is_empty()) {
+    return false;
+  }
+  const std::string filepath = program_binary_cache_filepath(key);
+  fstream file(filepath, std::ios::in | std::ios::binary);
+  if (!file) {
+    return false;
+  }
+  ProgramBinaryHeader header;
+  if (!file.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+      memcmp(header.magic, program_binary_magic, sizeof(header.magic)) != 0 || header.length <= 0)
+  {
+    return false;
+  }
+  Array<char> binary(header.length);
+  if (!file.read(binary.data(), binary.size())) {
+    return false;
+  }
+  file.close();
+  glProgramBinary(program, header.format, binary.data(), header.length);
+  GLint status;
+  glGetProgramiv(program, GL_LINK_STATUS, &status);
+  if (status != GL_TRUE) {
+    return false;
+  }
+  /* Update the modification time, which is used to find the least recently used files. */
+  BLI_file_touch(filepath.c_str());
+  return true;
+}
+
+static void program_binary_cache_store(const GLuint program, StringRefNull key)
+{
+  GLint length = 0;
+  glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+  if (length <= 0) {
+    return;
+  }
+  ProgramBinaryHeader header;
+  memcpy(header.magic, program_binary_magic, sizeof(header.magic));
+  Array<char> binary(length);
+  glGetProgramBinary(program, length, &header.length, &header.format, binary.data());
+  if (header.length <= 0) {
+    return;
+  }
+
+  const std::string filepath = program_binary_cache_filepath(key);
+  if (!BLI_file_ensure_parent_dir_exists(filepath.c_str())) {
+    return;
+  }
+  /* Write to a file that is unique to this thread first, so that other threads and instances of
+   * Blender never read an incomplete file. */
+  const std::string temp_filepath =
+      filepath + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) +
+      ".tmp";
+  {
+    fstream file(temp_filepath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.write(reinterpret_cast<const char *>(&header), sizeof(header)) ||
+        !file.write(binary.data(), header.length))
+    {
+      file.close();
+      BLI_delete(temp_filepath.c_str(), false, false);
+      return;
+    }
+  }
+  if (BLI_rename_overwrite(temp_filepath.c_str(), filepath.c_str()) != 0) {
+    BLI_delete(temp_filepath.c_str(), false, false);
+  }
+}
+
+/** \} */
+
 GLuint GLShader::create_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources)
+{
+  /* Patch the shader code using the first source slot. */
+  sources[0] = glsl_patch_get(gl_stage);
+
+  if (use_binary_cache_) {
+    std::string source;
+    for (const char *src : sources) {
+      source += src;
+    }
+    deferred_stages_.append({gl_stage, std::move(source)});
+    return 0;
+  }
+  return this->compile_shader_stage(gl_stage, sources);
+}
+
+GLuint &GLShader::stage_handle(const GLenum gl_stage)
+{
+  switch (gl_stage) {
+    case GL_VERTEX_SHADER:
+      return vert_shader_;
+    case GL_GEOMETRY_SHADER:
+      return geom_shader_;
+    case GL_FRAGMENT_SHADER:
+      return frag_shader_;
+    default:
+      BLI_assert(gl_stage == GL_COMPUTE_SHADER);
+      return compute_shader_;
+  }
+}
+
+GLuint GLShader::compile_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources)
 {
   GLuint shader = glCreateShader(gl_stage);
   if (shader == 0) {
@@ -1134,9 +1360,6 @@ GLuint GLShader::create_shader_stage(GLenum gl_stage, MutableSpan<const char *>
     return 0;
   }
 
-  /* Patch the shader code using the first source slot. */
-  sources[0] = glsl_patch_get(gl_stage);
-
   glShaderSource(shader, sources.size(), sources.data(), nullptr);
   glCompileShader(shader);
 
@@ -1192,6 +1415,7 @@ void GLShader::fragment_shader_from_glsl(MutableSpan<const char *> sources)
 
 void GLShader::compute_shader_from_glsl(MutableSpan<const char *> sources)
 {
+  is_compute_ = true;
   compute_shader_ = this->create_shader_stage(GL_COMPUTE_SHADER, sources);
 }
 
@@ -1209,17 +1433,46 @@ bool GLShader::finalize(const shader::ShaderCreateInfo *info)
     geometry_shader_from_glsl(sources);
   }
 
-  glLinkProgram(shader_program_);
+  bool is_linked = false;
+  std::string binary_cache_key;
+  if (use_binary_cache_) {
+    /* Transform feedback varyings are part of the program but not of the sources. */
+    if (transform_feedback_type_ == GPU_SHADER_TFB_NONE) {
+      binary_cache_key = program_binary_cache_key(deferred_stages_);
+      is_linked = program_binary_cache_load(shader_program_, binary_cache_key);
+    }
+    if (!is_linked) {
+      for (const std::pair<GLenum, std::string> &stage : deferred_stages_) {
+        const char *source = stage.second.c_str();
+        this->stage_handle(stage.first) = this->compile_shader_stage(
+            stage.first, MutableSpan<const char *>(&source, 1));
+      }
+    }
+    deferred_stages_.clear_and_shrink();
+    if (compilation_failed_) {
+      return false;
+    }
+  }
 
-  GLint status;
-  glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
-  if (!status) {
-    char log[5000];
-    glGetProgramInfoLog(shader_program_, sizeof(log), nullptr, log);
-    Span<const char *> sources;
-    GLLogParser parser;
-    this->print_log(sources, log, "Linking", true, &parser);
-    return false;
+  if (!is_linked) {
+    if (!binary_cache_key.empty()) {
+      glProgramParameteri(shader_program_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
+    glLinkProgram(shader_program_);
+
+    GLint status;
+    glGetProgramiv(shader_program_, GL_LINK_STATUS, &status);
+    if (!status) {
+      char log[5000];
+      glGetProgramInfoLog(shader_program_, sizeof(log), nullptr, log);
+      Span<const char *> sources;
+      GLLogParser parser;
+      this->print_log(sources, log, "Linking", true, &parser);
+      return false;
+    }
+    if (!binary_cache_key.empty()) {
+      program_binary_cache_store(shader_program_, binary_cache_key);
+    }
   }
 
   if (info != nullptr && info->legacy_resource_location_ == false) {
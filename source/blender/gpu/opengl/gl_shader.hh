@@ -35,6 +35,14 @@ class GLShader : public Shader {
   GLuint compute_shader_ = 0;
   /** True if any shader failed to compile. */
   bool compilation_failed_ = false;
+  bool is_compute_ = false;
+
+  /**
+   * When the program binary cache is used, compilation of the stages is deferred to #finalize,
+   * so that it can be skipped when the linked program is found in the cache.
+   */
+  bool use_binary_cache_ = false;
+  Vector<std::pair<GLenum, std::string>> deferred_stages_;
 
   eGPUShaderTFBType transform_feedback_type_ = GPU_SHADER_TFB_NONE;
 
@@ -84,14 +92,19 @@ class GLShader : public Shader {
 
   bool is_compute() const
   {
-    return compute_shader_ != 0;
+    return is_compute_;
   }
 
  private:
   char *glsl_patch_get(GLenum gl_stage);
 
-  /** Create, compile and attach the shader stage to the shader program. */
+  /**
+   * Create, compile and attach the shader stage to the shader program. Returns 0 when the
+   * compilation is deferred, see #use_binary_cache_.
+   */
   GLuint create_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources);
+  GLuint compile_shader_stage(GLenum gl_stage, MutableSpan<const char *> sources);
+  GLuint &stage_handle(GLenum gl_stage);
 
   /**
    * \brief features available on newer implementation such as native barycentric coordinates
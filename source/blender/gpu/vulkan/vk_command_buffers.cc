@@ -131,7 +131,12 @@ static void submit_command_buffers(const VKDevice &device,
   submit_info.commandBufferCount = num_command_buffers;
   submit_info.pCommandBuffers = handles;
 
-  vkQueueSubmit(device.queue_get(), 1, &submit_info, vk_fence);
+  {
+    /* Only the submission is serialized, other contexts can keep recording while the work of
+     * this context is being executed. */
+    std::scoped_lock lock(device.queue_mutex_get());
+    vkQueueSubmit(device.queue_get(), 1, &submit_info, vk_fence);
+  }
 
   vkWaitForFences(device.device_get(), 1, &vk_fence, VK_TRUE, timeout);
   vkResetFences(device.device_get(), 1, &vk_fence);
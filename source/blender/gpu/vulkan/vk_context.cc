@@ -116,6 +116,13 @@ void VKContext::begin_frame() {}
 
 void VKContext::end_frame()
 {
+  /* Don't keep memory of large transfers around, they are unlikely to happen every frame. */
+  if (staging_buffer_.is_allocated() &&
+      staging_buffer_.size_in_bytes() > STAGING_BUFFER_KEEP_SIZE)
+  {
+    staging_buffer_.free();
+  }
+
   VKDevice &device = VKBackend::get().device_get();
   device.destroy_discarded_resources();
 }
@@ -147,6 +154,32 @@ VKStateManager &VKContext::state_manager_get() const
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Staging buffer
+ * \{ */
+
+VKBuffer &VKContext::staging_buffer_get(int64_t size_in_bytes)
+{
+  int64_t allocation_size = size_in_bytes;
+  if (staging_buffer_.is_allocated()) {
+    if (staging_buffer_.size_in_bytes() >= size_in_bytes) {
+      return staging_buffer_;
+    }
+    /* Grow at least by a factor of two, to avoid reallocating for every slightly larger
+     * transfer. */
+    allocation_size = std::max(allocation_size, staging_buffer_.size_in_bytes() * 2);
+    staging_buffer_.free();
+  }
+
+  staging_buffer_.create(allocation_size,
+                         GPU_USAGE_DYNAMIC,
+                         VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+  debug::object_label(staging_buffer_.vk_handle(), "StagingBuffer");
+  return staging_buffer_;
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Frame-buffer
  * \{ */
@@ -12,6 +12,7 @@
 
 #include "GHOST_Types.h"
 
+#include "vk_buffer.hh"
 #include "vk_command_buffers.hh"
 #include "vk_common.hh"
 #include "vk_debug.hh"
@@ -25,9 +26,17 @@ class VKStateManager;
 
 class VKContext : public Context, NonCopyable {
  private:
+  /** Staging buffers up to this size are kept between frames. */
+  static constexpr int64_t STAGING_BUFFER_KEEP_SIZE = 16 * 1024 * 1024;
+
   VKCommandBuffers command_buffers_;
   VKDescriptorPools descriptor_pools_;
   VKDescriptorSetTracker descriptor_set_;
+  /**
+   * Staging buffer reused by texture uploads and downloads. Transfers are flushed and waited
+   * upon before they return, so the buffer is available again for the next transfer.
+   */
+  VKBuffer staging_buffer_;
 
   VkExtent2D vk_extent_ = {};
   VkFormat swap_chain_format_ = {};
@@ -88,6 +97,12 @@ class VKContext : public Context, NonCopyable {
 
   VKStateManager &state_manager_get() const;
 
+  /**
+   * Get a host visible buffer of at least the given size that can be used as source and
+   * destination of transfers. The buffer must not be used after the context has been flushed.
+   */
+  VKBuffer &staging_buffer_get(int64_t size_in_bytes);
+
   static void swap_buffers_pre_callback(const GHOST_VulkanSwapChainData *data);
   static void swap_buffers_post_callback();
 
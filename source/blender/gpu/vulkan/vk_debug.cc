@@ -188,6 +188,7 @@ void push_marker(const VKDevice &device, const char *name)
       VkDebugUtilsLabelEXT info = {};
       info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
       info.pLabelName = name;
+      std::scoped_lock lock(device.queue_mutex_get());
       debugging_tools.vkQueueBeginDebugUtilsLabelEXT_r(device.queue_get(), &info);
     }
   }
@@ -201,6 +202,7 @@ void set_marker(const VKDevice &device, const char *name)
       VkDebugUtilsLabelEXT info = {};
       info.sType = VK_STRUCTURE_TYPE_DEBUG_UTILS_LABEL_EXT;
       info.pLabelName = name;
+      std::scoped_lock lock(device.queue_mutex_get());
       debugging_tools.vkQueueInsertDebugUtilsLabelEXT_r(device.queue_get(), &info);
     }
   }
@@ -211,6 +213,7 @@ void pop_marker(const VKDevice &device)
   if (G.debug & G_DEBUG_GPU) {
     const VKDebuggingTools &debugging_tools = device.debugging_tools_get();
     if (debugging_tools.enabled) {
+      std::scoped_lock lock(device.queue_mutex_get());
       debugging_tools.vkQueueEndDebugUtilsLabelEXT_r(device.queue_get());
     }
   }
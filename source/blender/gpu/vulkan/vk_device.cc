@@ -263,31 +263,37 @@ const Vector<std::reference_wrapper<VKContext>> &VKDevice::contexts_get() const
 
 void VKDevice::discard_image(VkImage vk_image, VmaAllocation vma_allocation)
 {
+  std::scoped_lock lock(discarded_resources_mutex_);
   discarded_images_.append(std::pair(vk_image, vma_allocation));
 }
 
 void VKDevice::discard_image_view(VkImageView vk_image_view)
 {
+  std::scoped_lock lock(discarded_resources_mutex_);
   discarded_image_views_.append(vk_image_view);
 }
 
 void VKDevice::discard_buffer(VkBuffer vk_buffer, VmaAllocation vma_allocation)
 {
+  std::scoped_lock lock(discarded_resources_mutex_);
   discarded_buffers_.append(std::pair(vk_buffer, vma_allocation));
 }
 
 void VKDevice::discard_render_pass(VkRenderPass vk_render_pass)
 {
+  std::scoped_lock lock(discarded_resources_mutex_);
   discarded_render_passes_.append(vk_render_pass);
 }
 void VKDevice::discard_frame_buffer(VkFramebuffer vk_frame_buffer)
 {
+  std::scoped_lock lock(discarded_resources_mutex_);
   discarded_frame_buffers_.append(vk_frame_buffer);
 }
 
 void VKDevice::destroy_discarded_resources()
 {
   VK_ALLOCATION_CALLBACKS
+  std::scoped_lock lock(discarded_resources_mutex_);
 
   while (!discarded_image_views_.is_empty()) {
     VkImageView vk_image_view = discarded_image_views_.pop_last();
@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include <mutex>
+
 #include "BLI_utility_mixins.hh"
 #include "BLI_vector.hh"
 
@@ -58,6 +60,12 @@ class VKDevice : public NonCopyable {
   VkDevice vk_device_ = VK_NULL_HANDLE;
   uint32_t vk_queue_family_ = 0;
   VkQueue vk_queue_ = VK_NULL_HANDLE;
+  /**
+   * Access to the queue must be externally synchronized. Each context records its own command
+   * buffers, so contexts can record in parallel on different threads, but submissions to the
+   * shared queue are serialized.
+   */
+  mutable std::mutex queue_mutex_;
 
   VKSamplers samplers_;
 
@@ -93,6 +101,8 @@ class VKDevice : public NonCopyable {
   VKBuffer dummy_buffer_;
   std::optional<std::reference_wrapper<VKTexture>> dummy_color_attachment_;
 
+  /** Resources can be discarded by any context, protects the discarded resource lists. */
+  std::mutex discarded_resources_mutex_;
   Vector<std::pair<VkImage, VmaAllocation>> discarded_images_;
   Vector<std::pair<VkBuffer, VmaAllocation>> discarded_buffers_;
   Vector<VkRenderPass> discarded_render_passes_;
@@ -140,6 +150,12 @@ class VKDevice : public NonCopyable {
     return vk_queue_;
   }
 
+  /** Lock that must be held when submitting work to, or labeling #queue_get. */
+  std::mutex &queue_mutex_get() const
+  {
+    return queue_mutex_;
+  }
+
   const uint32_t queue_family_get() const
   {
     return vk_queue_family_;
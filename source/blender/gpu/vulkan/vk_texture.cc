@@ -221,12 +221,10 @@ void VKTexture::read_sub(
   layout_ensure(context, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
 
   /* Vulkan images cannot be directly mapped to host memory and requires a staging buffer. */
-  VKBuffer staging_buffer;
-
   size_t sample_len = (region[2] - region[0]) * (region[3] - region[1]) * layers.size();
   size_t device_memory_size = sample_len * to_bytesize(device_format_);
 
-  staging_buffer.create(device_memory_size, GPU_USAGE_DYNAMIC, VK_BUFFER_USAGE_TRANSFER_DST_BIT);
+  VKBuffer &staging_buffer = context.staging_buffer_get(device_memory_size);
 
   VkBufferImageCopy buffer_image_copy = {};
   buffer_image_copy.imageOffset.x = region[0];
@@ -281,8 +279,7 @@ void VKTexture::update_sub(
     extent.z = 1;
   }
 
-  VKBuffer staging_buffer;
-  staging_buffer.create(device_memory_size, GPU_USAGE_DYNAMIC, VK_BUFFER_USAGE_TRANSFER_SRC_BIT);
+  VKBuffer &staging_buffer = context.staging_buffer_get(device_memory_size);
   convert_host_to_device(
       staging_buffer.mapped_memory_get(), data, sample_len, format, format_, device_format_);
 
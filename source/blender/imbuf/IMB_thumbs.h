@@ -93,6 +93,12 @@ void IMB_thumb_makedirs(void);
 struct ImBuf *IMB_thumb_load_blend(const char *blen_path,
                                    const char *blen_group,
                                    const char *blen_id);
+/**
+ * Close the `.blend` files kept open to speed up loading many ID previews with
+ * #IMB_thumb_load_blend. Should be called once no more previews are expected to be loaded soon,
+ * so the files aren't kept open (and locked on some platforms).
+ */
+void IMB_thumb_blend_handles_clear(void);
 
 /**
  * Special function for previewing fonts.
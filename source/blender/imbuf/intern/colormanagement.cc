@@ -32,6 +32,7 @@
 #include "BLI_rect.h"
 #include "BLI_string.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 
 #include "BKE_appdir.h"
@@ -2241,34 +2242,37 @@ void IMB_colormanagement_imbuf_to_byte_texture(uchar *out_buffer,
              IMB_colormanagement_space_is_scene_linear(ibuf->byte_buffer.colorspace) ||
              IMB_colormanagement_space_is_data(ibuf->byte_buffer.colorspace));
 
+  using namespace blender;
   const uchar *in_buffer = ibuf->byte_buffer.data;
   const bool use_premultiply = IMB_alpha_affects_rgb(ibuf) && store_premultiplied;
 
-  for (int y = 0; y < height; y++) {
-    const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
-    const size_t out_offset = y * width;
-    const uchar *in = in_buffer + in_offset * 4;
-    uchar *out = out_buffer + out_offset * 4;
-
-    if (use_premultiply) {
-      /* Premultiply only. */
-      for (int x = 0; x < width; x++, in += 4, out += 4) {
-        out[0] = (in[0] * in[3]) >> 8;
-        out[1] = (in[1] * in[3]) >> 8;
-        out[2] = (in[2] * in[3]) >> 8;
-        out[3] = in[3];
+  threading::parallel_for(IndexRange(height), 64, [&](const IndexRange rows) {
+    for (const int y : rows) {
+      const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
+      const size_t out_offset = y * width;
+      const uchar *in = in_buffer + in_offset * 4;
+      uchar *out = out_buffer + out_offset * 4;
+
+      if (use_premultiply) {
+        /* Premultiply only. */
+        for (int x = 0; x < width; x++, in += 4, out += 4) {
+          out[0] = (in[0] * in[3]) >> 8;
+          out[1] = (in[1] * in[3]) >> 8;
+          out[2] = (in[2] * in[3]) >> 8;
+          out[3] = in[3];
+        }
       }
-    }
-    else {
-      /* Copy only. */
-      for (int x = 0; x < width; x++, in += 4, out += 4) {
-        out[0] = in[0];
-        out[1] = in[1];
-        out[2] = in[2];
-        out[3] = in[3];
+      else {
+        /* Copy only. */
+        for (int x = 0; x < width; x++, in += 4, out += 4) {
+          out[0] = in[0];
+          out[1] = in[1];
+          out[2] = in[2];
+          out[3] = in[3];
+        }
       }
     }
-  }
+  });
 }
 
 struct ImbufByteToFloatData {
@@ -2316,6 +2320,7 @@ void IMB_colormanagement_imbuf_to_float_texture(float *out_buffer,
                                                 const ImBuf *ibuf,
                                                 const bool store_premultiplied)
 {
+  using namespace blender;
   /* Float texture are stored in scene linear color space, with premultiplied
    * alpha depending on the image alpha mode. */
   if (ibuf->float_buffer.data) {
@@ -2324,42 +2329,44 @@ void IMB_colormanagement_imbuf_to_float_texture(float *out_buffer,
     const int in_channels = ibuf->channels;
     const bool use_unpremultiply = IMB_alpha_affects_rgb(ibuf) && !store_premultiplied;
 
-    for (int y = 0; y < height; y++) {
-      const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
-      const size_t out_offset = y * width;
-      const float *in = in_buffer + in_offset * in_channels;
-      float *out = out_buffer + out_offset * 4;
-
-      if (in_channels == 1) {
-        /* Copy single channel. */
-        for (int x = 0; x < width; x++, in += 1, out += 4) {
-          out[0] = in[0];
-          out[1] = in[0];
-          out[2] = in[0];
-          out[3] = in[0];
-        }
-      }
-      else if (in_channels == 3) {
-        /* Copy RGB. */
-        for (int x = 0; x < width; x++, in += 3, out += 4) {
-          out[0] = in[0];
-          out[1] = in[1];
-          out[2] = in[2];
-          out[3] = 1.0f;
+    threading::parallel_for(IndexRange(height), 64, [&](const IndexRange rows) {
+      for (const int y : rows) {
+        const size_t in_offset = (offset_y + y) * ibuf->x + offset_x;
+        const size_t out_offset = y * width;
+        const float *in = in_buffer + in_offset * in_channels;
+        float *out = out_buffer + out_offset * 4;
+
+        if (in_channels == 1) {
+          /* Copy single channel. */
+          for (int x = 0; x < width; x++, in += 1, out += 4) {
+            out[0] = in[0];
+            out[1] = in[0];
+            out[2] = in[0];
+            out[3] = in[0];
+          }
         }
-      }
-      else if (in_channels == 4) {
-        /* Copy or convert RGBA. */
-        if (use_unpremultiply) {
-          for (int x = 0; x < width; x++, in += 4, out += 4) {
-            premul_to_straight_v4_v4(out, in);
+        else if (in_channels == 3) {
+          /* Copy RGB. */
+          for (int x = 0; x < width; x++, in += 3, out += 4) {
+            out[0] = in[0];
+            out[1] = in[1];
+            out[2] = in[2];
+            out[3] = 1.0f;
           }
         }
-        else {
-          memcpy(out, in, sizeof(float[4]) * width);
+        else if (in_channels == 4) {
+          /* Copy or convert RGBA. */
+          if (use_unpremultiply) {
+            for (int x = 0; x < width; x++, in += 4, out += 4) {
+              premul_to_straight_v4_v4(out, in);
+            }
+          }
+          else {
+            memcpy(out, in, sizeof(float[4]) * width);
+          }
         }
       }
-    }
+    });
   }
   else {
     /* Byte source buffer. */
@@ -2671,13 +2678,13 @@ ImBuf *IMB_colormanagement_imbuf_for_write(ImBuf *ibuf,
 
         if (colormanaged_ibuf->float_buffer.data) {
           /* Float to float. */
-          IMB_colormanagement_transform(colormanaged_ibuf->float_buffer.data,
-                                        colormanaged_ibuf->x,
-                                        colormanaged_ibuf->y,
-                                        colormanaged_ibuf->channels,
-                                        from_colorspace,
-                                        to_colorspace,
-                                        false);
+          IMB_colormanagement_transform_threaded(colormanaged_ibuf->float_buffer.data,
+                                                 colormanaged_ibuf->x,
+                                                 colormanaged_ibuf->y,
+                                                 colormanaged_ibuf->channels,
+                                                 from_colorspace,
+                                                 to_colorspace,
+                                                 false);
 
           colormanaged_ibuf->float_buffer.colorspace = colormanage_colorspace_get_named(
               to_colorspace);
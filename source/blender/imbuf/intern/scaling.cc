@@ -10,6 +10,7 @@
 
 #include "BLI_math_color.h"
 #include "BLI_math_interp.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "MEM_guardedalloc.h"
 
@@ -1610,18 +1611,10 @@ bool IMB_scalefastImBuf(ImBuf *ibuf, uint newx, uint newy)
 {
   BLI_assert_msg(newx > 0 && newy > 0, "Images must be at least 1 on both dimensions!");
 
-  uint *rect, *_newrect, *newrect;
-  imbufRGBA *rectf, *_newrectf, *newrectf;
-  int x, y;
+  uint *_newrect = nullptr;
+  imbufRGBA *_newrectf = nullptr;
   bool do_float = false, do_rect = false;
-  size_t ofsx, ofsy, stepx, stepy;
-
-  rect = nullptr;
-  _newrect = nullptr;
-  newrect = nullptr;
-  rectf = nullptr;
-  _newrectf = nullptr;
-  newrectf = nullptr;
+  size_t stepx, stepy;
 
   if (ibuf == nullptr) {
     return false;
@@ -1645,7 +1638,6 @@ bool IMB_scalefastImBuf(ImBuf *ibuf, uint newx, uint newy)
     if (_newrect == nullptr) {
       return false;
     }
-    newrect = _newrect;
   }
 
   if (do_float) {
@@ -1657,34 +1649,39 @@ bool IMB_scalefastImBuf(ImBuf *ibuf, uint newx, uint newy)
       }
       return false;
     }
-    newrectf = _newrectf;
   }
 
   stepx = round(65536.0 * (ibuf->x - 1.0) / (newx - 1.0));
   stepy = round(65536.0 * (ibuf->y - 1.0) / (newy - 1.0));
-  ofsy = 32768;
 
-  for (y = newy; y > 0; y--, ofsy += stepy) {
-    if (do_rect) {
-      rect = (uint *)ibuf->byte_buffer.data;
-      rect += (ofsy >> 16) * ibuf->x;
-      ofsx = 32768;
+  /* Rows are independent, scale them on multiple threads. */
+  blender::threading::parallel_for(
+      blender::IndexRange(newy), 64, [&](const blender::IndexRange y_range) {
+        for (const int64_t y : y_range) {
+          const size_t ofsy = 32768 + y * stepy;
 
-      for (x = newx; x > 0; x--, ofsx += stepx) {
-        *newrect++ = rect[ofsx >> 16];
-      }
-    }
+          if (do_rect) {
+            const uint *rect = (const uint *)ibuf->byte_buffer.data + (ofsy >> 16) * ibuf->x;
+            uint *newrect = _newrect + y * newx;
+            size_t ofsx = 32768;
 
-    if (do_float) {
-      rectf = (imbufRGBA *)ibuf->float_buffer.data;
-      rectf += (ofsy >> 16) * ibuf->x;
-      ofsx = 32768;
+            for (uint x = 0; x < newx; x++, ofsx += stepx) {
+              newrect[x] = rect[ofsx >> 16];
+            }
+          }
 
-      for (x = newx; x > 0; x--, ofsx += stepx) {
-        *newrectf++ = rectf[ofsx >> 16];
-      }
-    }
-  }
+          if (do_float) {
+            const imbufRGBA *rectf = (const imbufRGBA *)ibuf->float_buffer.data +
+                                     (ofsy >> 16) * ibuf->x;
+            imbufRGBA *newrectf = _newrectf + y * newx;
+            size_t ofsx = 32768;
+
+            for (uint x = 0; x < newx; x++, ofsx += stepx) {
+              newrectf[x] = rectf[ofsx >> 16];
+            }
+          }
+        }
+      });
 
   if (do_rect) {
     imb_freerectImBuf(ibuf);
@@ -689,13 +689,19 @@ void IMB_thumb_locks_release()
   BLI_assert((thumb_locks.locked_paths != nullptr) && (thumb_locks.lock_counter > 0));
 
   thumb_locks.lock_counter--;
-  if (thumb_locks.lock_counter == 0) {
+  const bool is_last_user = (thumb_locks.lock_counter == 0);
+  if (is_last_user) {
     BLI_gset_free(thumb_locks.locked_paths, MEM_freeN);
     thumb_locks.locked_paths = nullptr;
     BLI_condition_end(&thumb_locks.cond);
   }
 
   BLI_thread_unlock(LOCK_IMAGE);
+
+  if (is_last_user) {
+    /* Nobody is generating thumbnails any more. */
+    IMB_thumb_blend_handles_clear();
+  }
 }
 
 void IMB_thumb_path_lock(const char *path)
@@ -9,10 +9,15 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
+#include <memory>
+#include <mutex>
+#include <string>
 
+#include "BLI_fileops.h"
 #include "BLI_linklist.h"
 #include "BLI_listbase.h" /* Needed due to import of BLO_readfile.h */
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BLO_blend_defs.hh"
 #include "BLO_readfile.h"
@@ -29,25 +34,101 @@
 
 #include "MEM_guardedalloc.h"
 
-/* NOTE: we should handle all previews for a same group at once, would avoid reopening
- * `.blend` file for each and every ID. However, this adds some complexity,
- * so keep it for later. */
+/* -------------------------------------------------------------------- */
+/** \name Blend File Handle Cache
+ *
+ * Loading the previews of many IDs (e.g. browsing an asset library) would otherwise open and
+ * parse the same `.blend` file for each and every ID. Instead keep the last few files open, so
+ * that previews are read from a single handle using its ID name lookup table.
+ * \{ */
+
+/** Number of `.blend` files kept open. */
+#define THUMB_BLEND_HANDLE_CACHE_SIZE 4
+
+struct ThumbBlendHandle {
+  std::string filepath;
+  int64_t mtime = 0;
+  BlendHandle *handle = nullptr;
+  /** Reading from a #BlendHandle is not thread-safe. */
+  std::mutex mutex;
+
+  ~ThumbBlendHandle()
+  {
+    if (handle) {
+      BLO_blendhandle_close(handle);
+    }
+  }
+};
+
+/** Most recently used handles are at the end. */
+static blender::Vector<std::shared_ptr<ThumbBlendHandle>> thumb_blend_handles;
+static std::mutex thumb_blend_handles_mutex;
+
+static std::shared_ptr<ThumbBlendHandle> thumb_blend_handle_get(const char *blen_path)
+{
+  BLI_stat_t st;
+  if (BLI_stat(blen_path, &st) == -1) {
+    return nullptr;
+  }
+
+  std::shared_ptr<ThumbBlendHandle> result;
+  {
+    std::lock_guard lock(thumb_blend_handles_mutex);
+    for (const int64_t i : thumb_blend_handles.index_range()) {
+      if (thumb_blend_handles[i]->filepath == blen_path) {
+        result = thumb_blend_handles[i];
+        thumb_blend_handles.remove(i);
+        break;
+      }
+    }
+    /* Reopen files that were modified since they have been opened. */
+    if (!result || result->mtime != int64_t(st.st_mtime)) {
+      result = std::make_shared<ThumbBlendHandle>();
+      result->filepath = blen_path;
+      result->mtime = int64_t(st.st_mtime);
+    }
+    thumb_blend_handles.append(result);
+    if (thumb_blend_handles.size() > THUMB_BLEND_HANDLE_CACHE_SIZE) {
+      thumb_blend_handles.remove(0);
+    }
+  }
+  return result;
+}
+
+void IMB_thumb_blend_handles_clear()
+{
+  /* Handles still in use by other threads are closed once they are done with them. */
+  std::lock_guard lock(thumb_blend_handles_mutex);
+  thumb_blend_handles.clear_and_shrink();
+}
+
+/** \} */
+
 static ImBuf *imb_thumb_load_from_blend_id(const char *blen_path,
                                            const char *blen_group,
                                            const char *blen_id)
 {
   ImBuf *ima = nullptr;
-  BlendFileReadReport bf_reports = {};
-  bf_reports.reports = nullptr;
 
-  BlendHandle *libfiledata = BLO_blendhandle_from_file(blen_path, &bf_reports);
-  if (libfiledata == nullptr) {
+  std::shared_ptr<ThumbBlendHandle> blend_handle = thumb_blend_handle_get(blen_path);
+  if (!blend_handle) {
     return nullptr;
   }
 
-  int idcode = BKE_idtype_idcode_from_name(blen_group);
-  PreviewImage *preview = BLO_blendhandle_get_preview_for_id(libfiledata, idcode, blen_id);
-  BLO_blendhandle_close(libfiledata);
+  const int idcode = BKE_idtype_idcode_from_name(blen_group);
+  PreviewImage *preview = nullptr;
+  {
+    std::lock_guard lock(blend_handle->mutex);
+    if (blend_handle->handle == nullptr) {
+      BlendFileReadReport bf_reports = {};
+      bf_reports.reports = nullptr;
+      blend_handle->handle = BLO_blendhandle_from_file(blen_path, &bf_reports);
+      if (blend_handle->handle == nullptr) {
+        return nullptr;
+      }
+    }
+    preview = BLO_blendhandle_get_preview_for_id(blend_handle->handle, idcode, blen_id);
+  }
 
   if (preview) {
     ima = BKE_previewimg_to_imbuf(preview, ICON_SIZE_PREVIEW);
@@ -54,6 +54,10 @@ struct CDStreamConfig {
 
   const char **modifier_error_message;
 
+  /* The mesh already has the topology of the sample being read, so it is not written again. This
+   * keeps the topology arrays shared with the previously evaluated mesh. */
+  bool use_existing_topology;
+
   /* Alembic needs Blender to keep references to C++ objects (the destructors finalize the writing
    * to ABC). The following fields are all used to keep these references. */
 
@@ -77,7 +81,8 @@ struct CDStreamConfig {
         mesh(NULL),
         add_customdata_cb(NULL),
         time(0.0),
-        modifier_error_message(NULL)
+        modifier_error_message(NULL),
+        use_existing_topology(false)
   {
   }
 };
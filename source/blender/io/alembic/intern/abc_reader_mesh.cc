@@ -26,6 +26,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_geom.h"
 #include "BLI_ordered_edge.hh"
+#include "BLI_task.h"
 
 #include "BLT_translation.h"
 
@@ -198,6 +199,10 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
 
   const bool do_uvs = (mloopuvs && uvs && uvs_indices);
   const bool do_uvs_per_loop = do_uvs && mesh_data.uv_scope == ABC_UV_SCOPE_LOOP;
+  const bool write_topology = !config.use_existing_topology;
+  if (!write_topology && !do_uvs) {
+    return;
+  }
   BLI_assert(!do_uvs || mesh_data.uv_scope != ABC_UV_SCOPE_NONE);
   uint loop_index = 0;
   uint rev_loop_index = 0;
@@ -207,7 +212,9 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
   for (int i = 0; i < face_counts->size(); i++) {
     const int face_size = (*face_counts)[i];
 
-    face_offsets[i] = loop_index;
+    if (write_topology) {
+      face_offsets[i] = loop_index;
+    }
 
     /* Polygons are always assumed to be smooth-shaded. If the Alembic mesh should be flat-shaded,
      * this is encoded in custom loop normals. See #71246. */
@@ -218,7 +225,9 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
     uint last_vertex_index = 0;
     for (int f = 0; f < face_size; f++, loop_index++, rev_loop_index--) {
       const int vert = (*face_indices)[loop_index];
-      corner_verts[rev_loop_index] = vert;
+      if (write_topology) {
+        corner_verts[rev_loop_index] = vert;
+      }
 
       if (f > 0 && vert == last_vertex_index) {
         /* This face is invalid, as it has consecutive loops from the same vertex. This is caused
@@ -241,6 +250,10 @@ static void read_mpolys(CDStreamConfig &config, const AbcMeshData &mesh_data)
     }
   }
 
+  if (!write_topology) {
+    return;
+  }
+
   BKE_mesh_calc_edges(config.mesh, false, false);
   if (seen_invalid_geometry) {
     if (config.modifier_error_message) {
@@ -547,13 +560,21 @@ static void read_mesh_sample(const std::string &iobject_full_name,
   }
 }
 
-CDStreamConfig get_config(Mesh *mesh)
+CDStreamConfig get_config(Mesh *mesh, const bool use_existing_topology)
 {
   CDStreamConfig config;
   config.mesh = mesh;
   config.positions = mesh->vert_positions_for_write().data();
-  config.corner_verts = mesh->corner_verts_for_write().data();
-  config.face_offsets = mesh->face_offsets_for_write().data();
+  if (use_existing_topology) {
+    /* Only read from, the arrays must not be un-shared. */
+    config.corner_verts = const_cast<int *>(mesh->corner_verts().data());
+    config.face_offsets = const_cast<int *>(mesh->face_offsets().data());
+  }
+  else {
+    config.corner_verts = mesh->corner_verts_for_write().data();
+    config.face_offsets = mesh->face_offsets_for_write().data();
+  }
+  config.use_existing_topology = use_existing_topology;
   config.totvert = mesh->totvert;
   config.totloop = mesh->totloop;
   config.faces_num = mesh->faces_num;
@@ -576,6 +597,14 @@ AbcMeshReader::AbcMeshReader(const IObject &object, ImportSettings &settings)
   get_min_max_time(m_iobject, m_schema, m_min_time, m_max_time);
 }
 
+AbcMeshReader::~AbcMeshReader()
+{
+  if (m_prefetch_pool) {
+    BLI_task_pool_cancel(m_prefetch_pool);
+    BLI_task_pool_free(m_prefetch_pool);
+  }
+}
+
 bool AbcMeshReader::valid() const
 {
   return m_schema.valid();
@@ -818,8 +847,10 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
     }
   }
 
+  /* With unchanged topology only positions and attributes have to be written, the face and edge
+   * arrays remain implicitly shared with the previously evaluated mesh. */
   Mesh *mesh_to_export = new_mesh ? new_mesh : existing_mesh;
-  CDStreamConfig config = get_config(mesh_to_export);
+  CDStreamConfig config = get_config(mesh_to_export, new_mesh == nullptr);
   config.time = sample_sel.getRequestedTime();
   config.modifier_error_message = err_str;
 
@@ -845,6 +876,61 @@ Mesh *AbcMeshReader::read_mesh(Mesh *existing_mesh,
   return existing_mesh;
 }
 
+struct MeshSamplePrefetch {
+  IPolyMeshSchema schema;
+  Alembic::AbcCoreAbstract::index_t index;
+};
+
+static void prefetch_sample_task(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  const MeshSamplePrefetch *prefetch = static_cast<const MeshSamplePrefetch *>(taskdata);
+  const ISampleSelector sample_sel(prefetch->index);
+  try {
+    /* The data itself is discarded, reading it is enough to have it cached by the file system
+     * (which matters most for network storage). */
+    IPolyMeshSchema::Sample sample;
+    prefetch->schema.get(sample, sample_sel);
+    const IN3fGeomParam normals = prefetch->schema.getNormalsParam();
+    if (normals.valid()) {
+      normals.getIndexedValue(sample_sel);
+    }
+    const IV2fGeomParam uvs = prefetch->schema.getUVsParam();
+    if (uvs.valid()) {
+      uvs.getIndexedValue(sample_sel);
+    }
+  }
+  catch (Alembic::Util::Exception & /*ex*/) {
+    /* Errors are reported when the sample is actually read. */
+  }
+}
+
+static void prefetch_sample_free(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  MEM_delete(static_cast<MeshSamplePrefetch *>(taskdata));
+}
+
+void AbcMeshReader::prefetch_next_sample(const ISampleSelector &sample_sel)
+{
+  if (m_schema.isConstant()) {
+    return;
+  }
+  const Alembic::AbcCoreAbstract::index_t samples_num = m_schema.getNumSamples();
+  const Alembic::AbcCoreAbstract::index_t next_index =
+      sample_sel.getIndex(m_schema.getTimeSampling(), samples_num) + 1;
+  if (next_index >= samples_num || next_index == m_prefetch_index) {
+    return;
+  }
+  if (m_prefetch_pool == nullptr) {
+    m_prefetch_pool = BLI_task_pool_create_background_serial(nullptr, TASK_PRIORITY_LOW);
+  }
+  m_prefetch_index = next_index;
+
+  MeshSamplePrefetch *prefetch = MEM_new<MeshSamplePrefetch>(__func__);
+  prefetch->schema = m_schema;
+  prefetch->index = next_index;
+  BLI_task_pool_push(m_prefetch_pool, prefetch_sample_task, prefetch, true, prefetch_sample_free);
+}
+
 void AbcMeshReader::assign_facesets_to_material_indices(const ISampleSelector &sample_sel,
                                                         MutableSpan<int> material_indices,
                                                         std::map<std::string, int> &r_mat_map)
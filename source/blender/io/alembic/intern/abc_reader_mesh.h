@@ -13,14 +13,20 @@
 #include "abc_reader_object.h"
 
 struct Mesh;
+struct TaskPool;
 
 namespace blender::io::alembic {
 
 class AbcMeshReader final : public AbcObjectReader {
   Alembic::AbcGeom::IPolyMeshSchema m_schema;
 
+  /** Background pool reading upcoming samples, see #prefetch_next_sample. */
+  TaskPool *m_prefetch_pool = nullptr;
+  Alembic::AbcCoreAbstract::index_t m_prefetch_index = -1;
+
  public:
   AbcMeshReader(const Alembic::Abc::IObject &object, ImportSettings &settings);
+  ~AbcMeshReader() override;
 
   bool valid() const override;
   bool accepts_object_type(const Alembic::AbcCoreAbstract::ObjectHeader &alembic_header,
@@ -36,6 +42,7 @@ class AbcMeshReader final : public AbcObjectReader {
                          const char **err_str) override;
   bool topology_changed(const Mesh *existing_mesh,
                         const Alembic::Abc::ISampleSelector &sample_sel) override;
+  void prefetch_next_sample(const Alembic::Abc::ISampleSelector &sample_sel) override;
 
  private:
   void readFaceSetsSample(Main *bmain,
@@ -70,6 +77,6 @@ void read_mverts(Mesh &mesh,
                  const Alembic::AbcGeom::P3fArraySamplePtr positions,
                  const Alembic::AbcGeom::N3fArraySamplePtr normals);
 
-CDStreamConfig get_config(struct Mesh *mesh);
+CDStreamConfig get_config(struct Mesh *mesh, bool use_existing_topology = false);
 
 }  // namespace blender::io::alembic
@@ -147,6 +147,11 @@ class AbcObjectReader {
                                  const char **err_str);
   virtual bool topology_changed(const Mesh *existing_mesh,
                                 const Alembic::Abc::ISampleSelector &sample_sel);
+  /**
+   * Start reading the sample following \a sample_sel in the background, so that it is served
+   * from the file system caches when playback reaches it.
+   */
+  virtual void prefetch_next_sample(const Alembic::Abc::ISampleSelector & /*sample_sel*/) {}
 
   /** Reads the object matrix and sets up an object transform if animated. */
   void setupObjectTransform(chrono_t time);
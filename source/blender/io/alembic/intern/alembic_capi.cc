@@ -804,12 +804,14 @@ Mesh *ABC_read_mesh(CacheReader *reader,
   }
 
   ISampleSelector sample_sel = sample_selector_for_time(params->time);
-  return abc_reader->read_mesh(existing_mesh,
-                               sample_sel,
-                               params->read_flags,
-                               params->velocity_name,
-                               params->velocity_scale,
-                               err_str);
+  Mesh *mesh = abc_reader->read_mesh(existing_mesh,
+                                     sample_sel,
+                                     params->read_flags,
+                                     params->velocity_name,
+                                     params->velocity_scale,
+                                     err_str);
+  abc_reader->prefetch_next_sample(sample_sel);
+  return mesh;
 }
 
 bool ABC_mesh_topology_changed(CacheReader *reader,
@@ -57,6 +57,8 @@ struct PLYImportParams {
   ePLYVertexColorMode vertex_colors;
   bool import_attributes;
   bool merge_verts;
+  /** Create a point cloud instead of a mesh when the file has no faces or edges. */
+  bool import_as_points;
 };
 
 /**
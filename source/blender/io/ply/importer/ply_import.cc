@@ -10,6 +10,7 @@
 #include "BKE_lib_id.h"
 #include "BKE_mesh.hh"
 #include "BKE_object.hh"
+#include "BKE_pointcloud.h"
 #include "BKE_report.h"
 
 #include "DNA_collection_types.h"
@@ -208,20 +209,38 @@ void importer_main(Main *bmain,
     return;
   }
 
-  /* Create mesh and do all prep work. */
-  Mesh *mesh_in_main = BKE_mesh_add(bmain, ob_name);
+  /* Scans without faces or edges can become point clouds, which are much lighter than meshes
+   * with loose vertices. */
+  const bool use_pointcloud = import_params.import_as_points && data->face_sizes.is_empty() &&
+                              data->edges.is_empty();
+
+  /* Create object data and do all prep work. */
   BKE_view_layer_base_deselect_all(scene, view_layer);
   LayerCollection *lc = BKE_layer_collection_get_active(view_layer);
-  Object *obj = BKE_object_add_only_object(bmain, OB_MESH, ob_name);
-  BKE_mesh_assign_object(bmain, obj, mesh_in_main);
+  Object *obj;
+  if (use_pointcloud) {
+    obj = BKE_object_add_only_object(bmain, OB_POINTCLOUD, ob_name);
+    obj->data = BKE_pointcloud_add(bmain, ob_name);
+  }
+  else {
+    Mesh *mesh_in_main = BKE_mesh_add(bmain, ob_name);
+    obj = BKE_object_add_only_object(bmain, OB_MESH, ob_name);
+    BKE_mesh_assign_object(bmain, obj, mesh_in_main);
+  }
   BKE_collection_object_add(bmain, lc->collection, obj);
   BKE_view_layer_synced_ensure(scene, view_layer);
   Base *base = BKE_view_layer_base_find(view_layer, obj);
   BKE_view_layer_base_select_and_set_active(view_layer, base);
 
-  /* Stuff ply data into the mesh. */
-  Mesh *mesh = convert_ply_to_mesh(*data, import_params);
-  BKE_mesh_nomain_to_mesh(mesh, mesh_in_main, obj);
+  /* Stuff ply data into the object data. */
+  if (use_pointcloud) {
+    PointCloud *pointcloud = convert_ply_to_pointcloud(*data, import_params);
+    BKE_pointcloud_nomain_to_pointcloud(pointcloud, static_cast<PointCloud *>(obj->data));
+  }
+  else {
+    Mesh *mesh = convert_ply_to_mesh(*data, import_params);
+    BKE_mesh_nomain_to_mesh(mesh, static_cast<Mesh *>(obj->data), obj);
+  }
 
   /* Object matrix and finishing up. */
   float global_scale = import_params.global_scale;
@@ -12,6 +12,7 @@
 
 #include "BLI_endian_switch.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 
 #include "fast_float.h"
 
@@ -230,6 +231,44 @@ static const char *parse_row_binary(PlyReadBuffer &file,
   return nullptr;
 }
 
+/**
+ * Read a block of binary rows at once and convert all their properties to floats, in parallel.
+ * Much faster than reading and converting row by row for large scans.
+ */
+static const char *parse_rows_binary(PlyReadBuffer &file,
+                                     const PlyHeader &header,
+                                     const PlyElement &element,
+                                     const int64_t rows_num,
+                                     Vector<uint8_t> &r_scratch,
+                                     Array<float> &r_values)
+{
+  if (element.stride == 0) {
+    return "Vertex/Edge element contains list properties, this is not supported";
+  }
+  r_scratch.resize(rows_num * element.stride);
+  if (!file.read_bytes(r_scratch.data(), r_scratch.size())) {
+    return "Could not read row of binary property";
+  }
+
+  const int64_t props_num = element.properties.size();
+  const bool big_endian = header.type == PlyFormatType::BINARY_BE;
+  r_values.reinitialize(rows_num * props_num);
+  threading::parallel_for(IndexRange(rows_num), 1024, [&](const IndexRange range) {
+    for (const int64_t row : range) {
+      const uint8_t *ptr = r_scratch.data() + row * element.stride;
+      float *values = r_values.data() + row * props_num;
+      for (const int64_t i : IndexRange(props_num)) {
+        const PlyProperty &prop = element.properties[i];
+        if (big_endian) {
+          endian_switch((uint8_t *)ptr, data_type_size[prop.type]);
+        }
+        values[i] = get_binary_value<float>(prop.type, ptr);
+      }
+    }
+  });
+  return nullptr;
+}
+
 static const char *load_vertex_element(PlyReadBuffer &file,
                                        const PlyHeader &header,
                                        const PlyElement &element,
@@ -288,20 +327,29 @@ static const char *load_vertex_element(PlyReadBuffer &file,
     color_norm.w = data_type_normalizer[element.properties[alpha_index].type];
   }
 
-  Vector<float> value_vec(element.properties.size());
+  const int64_t props_num = element.properties.size();
+  Vector<float> value_vec(props_num);
+  /* Binary rows are read and converted in blocks. */
+  const int64_t block_rows_num = 16 * 1024;
   Vector<uint8_t> scratch;
-  if (header.type != PlyFormatType::ASCII) {
-    scratch.resize(element.stride);
-  }
+  Array<float> block_values;
+  int64_t block_start = 0;
+  int64_t block_size = 0;
 
   for (int i = 0; i < element.count; i++) {
 
     const char *error = nullptr;
+    Span<float> values = value_vec;
     if (header.type == PlyFormatType::ASCII) {
       error = parse_row_ascii(file, value_vec);
     }
     else {
-      error = parse_row_binary(file, header, element, scratch, value_vec);
+      if (i >= block_start + block_size) {
+        block_start = i;
+        block_size = std::min<int64_t>(block_rows_num, element.count - i);
+        error = parse_rows_binary(file, header, element, block_size, scratch, block_values);
+      }
+      values = block_values.as_span().slice((i - block_start) * props_num, props_num);
     }
     if (error != nullptr) {
       return error;
@@ -309,19 +357,19 @@ static const char *load_vertex_element(PlyReadBuffer &file,
 
     /* Vertex coord */
     float3 vertex3;
-    vertex3.x = value_vec[vertex_index.x];
-    vertex3.y = value_vec[vertex_index.y];
-    vertex3.z = value_vec[vertex_index.z];
+    vertex3.x = values[vertex_index.x];
+    vertex3.y = values[vertex_index.y];
+    vertex3.z = values[vertex_index.z];
     data->vertices.append(vertex3);
 
     /* Vertex color */
     if (has_color) {
       float4 colors4;
-      colors4.x = value_vec[color_index.x] / color_norm.x;
-      colors4.y = value_vec[color_index.y] / color_norm.y;
-      colors4.z = value_vec[color_index.z] / color_norm.z;
+      colors4.x = values[color_index.x] / color_norm.x;
+      colors4.y = values[color_index.y] / color_norm.y;
+      colors4.z = values[color_index.z] / color_norm.z;
       if (has_alpha) {
-        colors4.w = value_vec[alpha_index] / color_norm.w;
+        colors4.w = values[alpha_index] / color_norm.w;
       }
       else {
         colors4.w = 1.0f;
@@ -332,23 +380,23 @@ static const char *load_vertex_element(PlyReadBuffer &file,
     /* If normals */
     if (has_normal) {
       float3 normals3;
-      normals3.x = value_vec[normal_index.x];
-      normals3.y = value_vec[normal_index.y];
-      normals3.z = value_vec[normal_index.z];
+      normals3.x = values[normal_index.x];
+      normals3.y = values[normal_index.y];
+      normals3.z = values[normal_index.z];
       data->vertex_normals.append(normals3);
     }
 
     /* If uv */
     if (has_uv) {
       float2 uvmap;
-      uvmap.x = value_vec[uv_index.x];
-      uvmap.y = value_vec[uv_index.y];
+      uvmap.x = values[uv_index.x];
+      uvmap.y = values[uv_index.y];
       data->uv_coordinates.append(uvmap);
     }
 
     /* Custom attributes */
     for (const int64_t ci : custom_attr_indices.index_range()) {
-      float value = value_vec[custom_attr_indices[ci]];
+      float value = values[custom_attr_indices[ci]];
       data->vertex_custom_attr[ci].data[i] = value;
     }
   }
@@ -12,11 +12,15 @@
 #include "BKE_lib_id.h"
 #include "BKE_mesh.hh"
 #include "BKE_mesh_runtime.hh"
+#include "BKE_pointcloud.h"
 
 #include "GEO_mesh_merge_by_distance.hh"
 
 #include "BLI_math_color.hh"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
+
+#include "DNA_pointcloud_types.h"
 
 #include "ply_import_mesh.hh"
 
@@ -26,7 +30,10 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
   Mesh *mesh = BKE_mesh_new_nomain(
       data.vertices.size(), data.edges.size(), data.face_sizes.size(), data.face_vertices.size());
 
+  /* Release each part of the PLY data as soon as it is copied into the mesh, to keep the peak
+   * memory usage of large scans down. */
   mesh->vert_positions_for_write().copy_from(data.vertices);
+  data.vertices.clear_and_shrink();
 
   bke::MutableAttributeAccessor attributes = mesh->attributes_for_write();
 
@@ -45,6 +52,7 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
       }
       edges[i] = {v1, v2};
     }
+    data.edges.clear_and_shrink();
   }
 
   /* Add faces to the mesh. */
@@ -55,18 +63,27 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
     /* Fill in face data. */
     uint32_t offset = 0;
     for (const int i : data.face_sizes.index_range()) {
-      uint32_t size = data.face_sizes[i];
       face_offsets[i] = offset;
-      for (int j = 0; j < size; j++) {
-        uint32_t v = data.face_vertices[offset + j];
-        if (v >= mesh->totvert) {
-          fprintf(stderr, "Invalid PLY vertex index in face %i loop %i: %u\n", i, j, v);
-          v = 0;
+      offset += data.face_sizes[i];
+    }
+    data.face_sizes.clear_and_shrink();
+    const OffsetIndices faces = mesh->faces();
+    threading::parallel_for(faces.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        for (const int corner : faces[i]) {
+          uint32_t v = data.face_vertices[corner];
+          if (v >= mesh->totvert) {
+            fprintf(stderr,
+                    "Invalid PLY vertex index in face %i loop %i: %u\n",
+                    i,
+                    corner - faces[i].start(),
+                    v);
+            v = 0;
+          }
+          corner_verts[corner] = v;
         }
-        corner_verts[offset + j] = data.face_vertices[offset + j];
       }
-      offset += size;
-    }
+    });
   }
 
   /* Vertex colors */
@@ -76,16 +93,17 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
         attributes.lookup_or_add_for_write_span<ColorGeometry4f>("Col", ATTR_DOMAIN_POINT);
 
     if (params.vertex_colors == PLY_VERTEX_COLOR_SRGB) {
-      for (const int i : data.vertex_colors.index_range()) {
-        srgb_to_linearrgb_v4(colors.span[i], data.vertex_colors[i]);
-      }
+      threading::parallel_for(data.vertex_colors.index_range(), 4096, [&](IndexRange range) {
+        for (const int i : range) {
+          srgb_to_linearrgb_v4(colors.span[i], data.vertex_colors[i]);
+        }
+      });
     }
     else {
-      for (const int i : data.vertex_colors.index_range()) {
-        copy_v4_v4(colors.span[i], data.vertex_colors[i]);
-      }
+      colors.span.copy_from(data.vertex_colors.as_span().cast<ColorGeometry4f>());
     }
     colors.finish();
+    data.vertex_colors.clear_and_shrink();
     BKE_id_attributes_active_color_set(&mesh->id, "Col");
     BKE_id_attributes_default_color_set(&mesh->id, "Col");
   }
@@ -94,11 +112,15 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
   if (!data.uv_coordinates.is_empty()) {
     bke::SpanAttributeWriter<float2> uv_map = attributes.lookup_or_add_for_write_only_span<float2>(
         "UVMap", ATTR_DOMAIN_CORNER);
-    for (const int i : data.face_vertices.index_range()) {
-      uv_map.span[i] = data.uv_coordinates[data.face_vertices[i]];
-    }
+    threading::parallel_for(data.face_vertices.index_range(), 4096, [&](IndexRange range) {
+      for (const int i : range) {
+        uv_map.span[i] = data.uv_coordinates[data.face_vertices[i]];
+      }
+    });
     uv_map.finish();
   }
+  data.uv_coordinates.clear_and_shrink();
+  data.face_vertices.clear_and_shrink();
 
   /* Calculate edges from the rest of the mesh. */
   BKE_mesh_calc_edges(mesh, true, false);
@@ -118,6 +140,7 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
           ATTR_DOMAIN_POINT,
           bke::AttributeInitVArray(VArray<float3>::ForSpan(data.vertex_normals)));
     }
+    data.vertex_normals.clear_and_shrink();
   }
   else {
     /* No vertex normals: set faces to sharp. */
@@ -126,10 +149,11 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
 
   /* Custom attributes: add them after anything above. */
   if (params.import_attributes && !data.vertex_custom_attr.is_empty()) {
-    for (const PlyCustomAttribute &attr : data.vertex_custom_attr) {
+    for (PlyCustomAttribute &attr : data.vertex_custom_attr) {
       attributes.add<float>(attr.name,
                             ATTR_DOMAIN_POINT,
                             bke::AttributeInitVArray(VArray<float>::ForSpan(attr.data)));
+      attr.data.clear_and_shrink();
     }
   }
 
@@ -145,4 +169,49 @@ Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params)
 
   return mesh;
 }
+
+PointCloud *convert_ply_to_pointcloud(PlyData &data, const PLYImportParams &params)
+{
+  BLI_assert(data.face_sizes.is_empty() && data.edges.is_empty());
+  PointCloud *pointcloud = BKE_pointcloud_new_nomain(data.vertices.size());
+  pointcloud->positions_for_write().copy_from(data.vertices);
+  data.vertices.clear_and_shrink();
+
+  bke::MutableAttributeAccessor attributes = pointcloud->attributes_for_write();
+
+  if (!data.vertex_colors.is_empty() && params.vertex_colors != PLY_VERTEX_COLOR_NONE) {
+    bke::SpanAttributeWriter<ColorGeometry4f> colors =
+        attributes.lookup_or_add_for_write_only_span<ColorGeometry4f>("Col", ATTR_DOMAIN_POINT);
+    if (params.vertex_colors == PLY_VERTEX_COLOR_SRGB) {
+      threading::parallel_for(data.vertex_colors.index_range(), 4096, [&](IndexRange range) {
+        for (const int i : range) {
+          srgb_to_linearrgb_v4(colors.span[i], data.vertex_colors[i]);
+        }
+      });
+    }
+    else {
+      colors.span.copy_from(data.vertex_colors.as_span().cast<ColorGeometry4f>());
+    }
+    colors.finish();
+    data.vertex_colors.clear_and_shrink();
+  }
+
+  if (params.import_attributes) {
+    if (!data.vertex_normals.is_empty()) {
+      attributes.add<float3>(
+          "normal",
+          ATTR_DOMAIN_POINT,
+          bke::AttributeInitVArray(VArray<float3>::ForSpan(data.vertex_normals)));
+      data.vertex_normals.clear_and_shrink();
+    }
+    for (PlyCustomAttribute &attr : data.vertex_custom_attr) {
+      attributes.add<float>(attr.name,
+                            ATTR_DOMAIN_POINT,
+                            bke::AttributeInitVArray(VArray<float>::ForSpan(attr.data)));
+      attr.data.clear_and_shrink();
+    }
+  }
+
+  return pointcloud;
+}
 }  // namespace blender::io::ply
@@ -11,12 +11,22 @@
 #include "IO_ply.hh"
 #include "ply_data.hh"
 
+struct PointCloud;
+
 namespace blender::io::ply {
 
 /**
- * Converts the #PlyData data-structure to a mesh.
+ * Converts the #PlyData data-structure to a mesh. The data arrays are freed while they are
+ * copied into the mesh, so \a data is left empty afterwards.
  * \return A new mesh that can be used inside blender.
  */
 Mesh *convert_ply_to_mesh(PlyData &data, const PLYImportParams &params);
 
+/**
+ * Converts the vertices of #PlyData (which must not have faces or edges) to a point cloud,
+ * with the same attributes as #convert_ply_to_mesh creates for them. Like for meshes, the
+ * data arrays are freed as they are copied.
+ */
+PointCloud *convert_ply_to_pointcloud(PlyData &data, const PLYImportParams &params);
+
 }  // namespace blender::io::ply
@@ -31,6 +31,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_path_util.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_timeit.hh"
 
 #include "BLT_translation.h"
@@ -327,6 +328,15 @@ static void import_startjob(void *customdata, wmJobWorkerStatus *worker_status)
     }
   }
 
+  /* Read the geometry of all prims in parallel, it doesn't depend on Main. */
+  threading::parallel_for(IndexRange(archive->readers().size()), 1, [&](const IndexRange range) {
+    for (const int64_t index : range) {
+      if (USDPrimReader *reader = archive->readers()[index]) {
+        reader->read_geometry_data(0.0);
+      }
+    }
+  });
+
   /* Setup parenthood and read actual object data. */
   i = 0;
   for (USDPrimReader *reader : archive->readers()) {
@@ -249,7 +249,7 @@ void USDMeshReader::create_object(Main *bmain, const double /*motionSampleTime*/
   object_->data = mesh;
 }
 
-void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+void USDMeshReader::read_geometry_data(const double motionSampleTime)
 {
   Mesh *mesh = (Mesh *)object_->data;
 
@@ -257,9 +257,23 @@ void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
   const USDMeshReadParams params = create_mesh_read_params(motionSampleTime,
                                                            import_params_.mesh_read_flag);
 
-  Mesh *read_mesh = this->read_mesh(mesh, params, nullptr);
+  geometry_mesh_ = this->read_mesh(mesh, params, nullptr);
+  has_geometry_mesh_ = true;
 
   is_initial_load_ = false;
+}
+
+void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+{
+  Mesh *mesh = (Mesh *)object_->data;
+
+  if (!has_geometry_mesh_) {
+    this->read_geometry_data(motionSampleTime);
+  }
+  Mesh *read_mesh = geometry_mesh_;
+  geometry_mesh_ = nullptr;
+  has_geometry_mesh_ = false;
+
   if (read_mesh != mesh) {
     BKE_mesh_nomain_to_mesh(read_mesh, mesh, object_);
   }
@@ -859,7 +873,14 @@ void USDMeshReader::read_mesh_sample(ImportSettings *settings,
   }
 
   if (new_mesh || (settings->read_flag & MOD_MESHSEQ_READ_POLY) != 0) {
-    read_mpolys(mesh);
+    /* When the topology is constant, the existing mesh already has it. Not writing it again keeps
+     * the arrays shared with the previously evaluated mesh and avoids recomputing edges. */
+    const bool topology_is_constant =
+        !mesh_prim_.GetFaceVertexIndicesAttr().ValueMightBeTimeVarying() &&
+        !mesh_prim_.GetFaceVertexCountsAttr().ValueMightBeTimeVarying();
+    if (new_mesh || !topology_is_constant) {
+      read_mpolys(mesh);
+    }
     if (normal_interpolation_ == pxr::UsdGeomTokens->faceVarying) {
       process_normals_face_varying(mesh);
     }
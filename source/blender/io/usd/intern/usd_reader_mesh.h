@@ -40,6 +40,10 @@ class USDMeshReader : public USDGeomReader {
    * implemented.  Note this will break if faces or positions vary. */
   bool is_initial_load_;
 
+  /** Mesh read ahead of #read_object_data by #read_geometry_data. */
+  Mesh *geometry_mesh_ = nullptr;
+  bool has_geometry_mesh_ = false;
+
  public:
   USDMeshReader(const pxr::UsdPrim &prim,
                 const USDImportParams &import_params,
@@ -49,6 +53,7 @@ class USDMeshReader : public USDGeomReader {
 
   void create_object(Main *bmain, double motionSampleTime) override;
   void read_object_data(Main *bmain, double motionSampleTime) override;
+  void read_geometry_data(double motionSampleTime) override;
 
   struct Mesh *read_mesh(struct Mesh *existing_mesh,
                          USDMeshReadParams params,
@@ -106,6 +106,11 @@ class USDPrimReader {
 
   virtual void create_object(Main *bmain, double motionSampleTime) = 0;
   virtual void read_object_data(Main * /*bmain*/, double /*motionSampleTime*/){};
+  /**
+   * Read the parts of the prim data that don't touch Main, before #read_object_data is called.
+   * This is called for many readers in parallel, so it must not modify any shared state.
+   */
+  virtual void read_geometry_data(double /*motionSampleTime*/){};
 
   Object *object() const;
   void object(Object *ob);
@@ -376,6 +376,21 @@ struct USDMeshData {
   pxr::VtFloatArray corner_sharpnesses;
 };
 
+static void get_face_groups(const Mesh *mesh, USDMeshData &usd_mesh_data)
+{
+  /* Only construct face groups (a.k.a. geometry subsets) when we need them for material
+   * assignments. */
+  const bke::AttributeAccessor attributes = mesh->attributes();
+  const VArray<int> material_indices = *attributes.lookup_or_default<int>(
+      "material_index", ATTR_DOMAIN_FACE, 0);
+  if (!material_indices.is_single() && mesh->totcol > 1) {
+    const VArraySpan<int> indices_span(material_indices);
+    for (const int i : indices_span.index_range()) {
+      usd_mesh_data.face_groups.lookup_or_add_default(indices_span[i]).push_back(i);
+    }
+  }
+}
+
 void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
 {
   pxr::UsdTimeCode timecode = get_export_time_code();
@@ -388,9 +403,10 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
   USDMeshData usd_mesh_data;
   /* Ensure data exists if currently in edit mode. */
   BKE_mesh_wrapper_ensure_mdata(mesh);
-  get_geometry_data(mesh, usd_mesh_data);
+  get_face_groups(mesh, usd_mesh_data);
 
   if (usd_export_context_.export_params.use_instancing && context.is_instance()) {
+    /* Instances reference the prototype's geometry, so only the face groups are needed. */
     if (!mark_as_instance(context, usd_mesh.GetPrim())) {
       return;
     }
@@ -406,6 +422,8 @@ void USDGenericMeshWriter::write_mesh(HierarchyContext &context, Mesh *mesh)
     return;
   }
 
+  get_geometry_data(mesh, usd_mesh_data);
+
   pxr::UsdAttribute attr_points = usd_mesh.CreatePointsAttr(pxr::VtValue(), true);
   pxr::UsdAttribute attr_face_vertex_counts = usd_mesh.CreateFaceVertexCountsAttr(pxr::VtValue(),
                                                                                   true);
@@ -499,18 +517,6 @@ static void get_positions(const Mesh *mesh, USDMeshData &usd_mesh_data)
 
 static void get_loops_polys(const Mesh *mesh, USDMeshData &usd_mesh_data)
 {
-  /* Only construct face groups (a.k.a. geometry subsets) when we need them for material
-   * assignments. */
-  const bke::AttributeAccessor attributes = mesh->attributes();
-  const VArray<int> material_indices = *attributes.lookup_or_default<int>(
-      "material_index", ATTR_DOMAIN_FACE, 0);
-  if (!material_indices.is_single() && mesh->totcol > 1) {
-    const VArraySpan<int> indices_span(material_indices);
-    for (const int i : indices_span.index_range()) {
-      usd_mesh_data.face_groups.lookup_or_add_default(indices_span[i]).push_back(i);
-    }
-  }
-
   usd_mesh_data.face_vertex_counts.resize(mesh->faces_num);
   const OffsetIndices faces = mesh->faces();
   offset_indices::copy_group_sizes(
@@ -35,6 +35,8 @@ class FormatHandler : NonCopyable, NonMovable {
   using VectorChar = Vector<char>;
   Vector<VectorChar> blocks_;
   size_t buffer_chunk_size_;
+  /** Free space to ensure before formatting a line straight into the last block. */
+  static constexpr size_t direct_format_size = 256;
 
  public:
   FormatHandler(size_t buffer_chunk_size = 64 * 1024) : buffer_chunk_size_(buffer_chunk_size) {}
@@ -210,7 +212,18 @@ class FormatHandler : NonCopyable, NonMovable {
 
   template<typename... T> void write_impl(const char *fmt, T &&...args)
   {
-    /* Format into a local buffer. */
+    /* Format directly into the free space of the last block, which is enough for nearly all
+     * lines; this avoids formatting into a temporary buffer and copying it. */
+    ensure_space(direct_format_size);
+    VectorChar &last = blocks_.last();
+    const size_t free_size = last.capacity() - last.size();
+    const auto result = fmt::format_to_n(last.end(), free_size, fmt, args...);
+    if (result.size <= free_size) {
+      last.increase_size_by_unchecked(result.size);
+      return;
+    }
+
+    /* Long line: format into a local buffer. */
     fmt::memory_buffer buf;
     fmt::format_to(fmt::appender(buf), fmt, std::forward<T>(args)...);
     size_t len = buf.size();
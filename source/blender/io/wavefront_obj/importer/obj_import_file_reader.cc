@@ -11,6 +11,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "obj_export_mtl.hh"
@@ -68,32 +69,55 @@ static Geometry *create_geometry(Geometry *const prev_geometry,
   return new_geometry();
 }
 
-static void geom_add_vertex(const char *p, const char *end, GlobalVertices &r_global_vertices)
+static void geom_add_vertex_color(const float3 &srgb,
+                                  const int64_t vertex_index,
+                                  GlobalVertices &r_global_vertices)
 {
-  float3 vert;
-  p = parse_floats(p, end, 0.0f, vert, 3);
-  r_global_vertices.vertices.append(vert);
-  /* OBJ extension: `xyzrgb` vertex colors, when the vertex position
-   * is followed by 3 more RGB color components. See
-   * http://paulbourke.net/dataformats/obj/colour.html */
-  if (p < end) {
-    float3 srgb;
-    p = parse_floats(p, end, -1.0f, srgb, 3);
-    if (srgb.x >= 0 && srgb.y >= 0 && srgb.z >= 0) {
-      float3 linear;
-      srgb_to_linearrgb_v3_v3(linear, srgb);
-
-      auto &blocks = r_global_vertices.vertex_colors;
-      /* If we don't have vertex colors yet, or the previous vertex
-       * was without color, we need to start a new vertex colors block. */
-      if (blocks.is_empty() || (blocks.last().start_vertex_index + blocks.last().colors.size() !=
-                                r_global_vertices.vertices.size() - 1))
-      {
-        GlobalVertices::VertexColorsBlock block;
-        block.start_vertex_index = r_global_vertices.vertices.size() - 1;
-        blocks.append(block);
+  float3 linear;
+  srgb_to_linearrgb_v3_v3(linear, srgb);
+
+  auto &blocks = r_global_vertices.vertex_colors;
+  /* If we don't have vertex colors yet, or the previous vertex
+   * was without color, we need to start a new vertex colors block. */
+  if (blocks.is_empty() ||
+      (blocks.last().start_vertex_index + blocks.last().colors.size() != vertex_index))
+  {
+    GlobalVertices::VertexColorsBlock block;
+    block.start_vertex_index = vertex_index;
+    blocks.append(block);
+  }
+  blocks.last().colors.append(linear);
+}
+
+/**
+ * Add the vertices of consecutive `v` lines (with the keyword already dropped).
+ * Parsing the numbers dominates the import time of large files, so the lines are parsed on
+ * multiple threads; vertex colors are appended afterwards, in order.
+ */
+static void geom_add_vertices(const Span<StringRef> lines, GlobalVertices &r_global_vertices)
+{
+  const int64_t start = r_global_vertices.vertices.size();
+  r_global_vertices.vertices.resize(start + lines.size());
+  MutableSpan<float3> verts = r_global_vertices.vertices.as_mutable_span().slice(start,
+                                                                                lines.size());
+  Array<float3> colors(lines.size());
+  threading::parallel_for(lines.index_range(), 1024, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const char *p = lines[i].begin(), *end = lines[i].end();
+      p = parse_floats(p, end, 0.0f, verts[i], 3);
+      colors[i] = float3(-1.0f);
+      /* OBJ extension: `xyzrgb` vertex colors, when the vertex position
+       * is followed by 3 more RGB color components. See
+       * http://paulbourke.net/dataformats/obj/colour.html */
+      if (p < end) {
+        parse_floats(p, end, -1.0f, colors[i], 3);
       }
-      blocks.last().colors.append(linear);
+    }
+  });
+  for (const int64_t i : lines.index_range()) {
+    const float3 &srgb = colors[i];
+    if (srgb.x >= 0 && srgb.y >= 0 && srgb.z >= 0) {
+      geom_add_vertex_color(srgb, start + i, r_global_vertices);
     }
   }
 }
@@ -515,6 +539,7 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
 
   size_t buffer_offset = 0;
   size_t line_number = 0;
+  Vector<StringRef> vertex_lines;
   while (true) {
     /* Read a chunk of input from the file. */
     size_t bytes_read = fread(buffer.data() + buffer_offset, 1, read_buffer_size_, obj_file_);
@@ -572,7 +597,21 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
       /* Most common things that start with 'v': vertices, normals, UVs. */
       if (*p == 'v') {
         if (parse_keyword(p, end, "v")) {
-          geom_add_vertex(p, end, r_global_vertices);
+          /* Gather the following vertex lines too, to parse them all at once. */
+          vertex_lines.clear();
+          vertex_lines.append(StringRef(p, end));
+          while (!buffer_str.is_empty()) {
+            StringRef next_str = buffer_str;
+            const StringRef next_line = read_next_line(next_str);
+            const char *next_p = drop_whitespace(next_line.begin(), next_line.end());
+            if (!parse_keyword(next_p, next_line.end(), "v")) {
+              break;
+            }
+            vertex_lines.append(StringRef(next_p, next_line.end()));
+            buffer_str = next_str;
+            ++line_number;
+          }
+          geom_add_vertices(vertex_lines, r_global_vertices);
         }
         else if (parse_keyword(p, end, "vn")) {
           geom_add_vertex_normal(p, end, r_global_vertices);
@@ -158,6 +158,26 @@ void *DNA_struct_reconstruct(const struct DNA_ReconstructInfo *reconstruct_info,
                              int old_struct_nr,
                              int blocks,
                              const void *old_blocks);
+/**
+ * \return The size in bytes of a single reconstructed struct, or 0 when the struct does not
+ * exist in the new SDNA anymore.
+ */
+int DNA_struct_reconstruct_size(const struct DNA_ReconstructInfo *reconstruct_info,
+                                int old_struct_nr);
+/**
+ * Reconstruct only the elements `[start, start + count)` of an array of structs. This allows
+ * converting large arrays on multiple threads.
+ *
+ * \param old_blocks: The whole array of struct data.
+ * \param new_blocks: The whole (zero initialized) array in the new format, with the size given by
+ * #DNA_struct_reconstruct_size.
+ */
+void DNA_struct_reconstruct_range(const struct DNA_ReconstructInfo *reconstruct_info,
+                                  int old_struct_nr,
+                                  int start,
+                                  int count,
+                                  const void *old_blocks,
+                                  void *new_blocks);
 
 /**
  * A version of #DNA_struct_member_offset_by_name_with_alias that uses the non-aliased name.
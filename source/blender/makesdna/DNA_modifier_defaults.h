@@ -612,6 +612,7 @@
     .uv_smooth = SUBSURF_UV_SMOOTH_PRESERVE_BOUNDARIES, \
     .quality = 3, \
     .boundary_smooth = SUBSURF_BOUNDARY_SMOOTH_ALL, \
+    .adaptive_edge_length = 1.0f, \
     .emCache = NULL, \
     .mCache = NULL, \
   }
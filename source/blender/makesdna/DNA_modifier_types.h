@@ -174,6 +174,7 @@ typedef enum {
   eSubsurfModifierFlag_UseCrease = (1 << 4),
   eSubsurfModifierFlag_UseCustomNormals = (1 << 5),
   eSubsurfModifierFlag_UseRecursiveSubdivision = (1 << 6),
+  eSubsurfModifierFlag_UseAdaptiveLevels = (1 << 7),
 } SubsurfModifierFlag;
 
 typedef enum {
@@ -203,6 +204,12 @@ typedef struct SubsurfModifierData {
   short quality;
   short boundary_smooth;
   char _pad[2];
+  /**
+   * Target length of subdivided edges in pixels of the scene camera, used to lower the number of
+   * levels with #eSubsurfModifierFlag_UseAdaptiveLevels.
+   */
+  float adaptive_edge_length;
+  char _pad1[4];
 
   /* TODO(sergey): Get rid of those with the old CCG subdivision code. */
   void *emCache, *mCache;
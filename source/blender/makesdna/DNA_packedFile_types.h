@@ -8,8 +8,15 @@
 
 #pragma once
 
+#include "BLI_implicit_sharing.h"
+
 typedef struct PackedFile {
   int size;
   int seek;
   void *data;
+  /**
+   * Run-time data that allows sharing `data` between packed files (duplicated IDs, or identical
+   * files packed in different libraries). When null, `data` is owned by this packed file only.
+   */
+  const ImplicitSharingInfoHandle *sharing_info;
 } PackedFile;
@@ -711,8 +711,12 @@ typedef struct UserDef_Experimental {
   char use_new_volume_nodes;
   char use_shader_node_previews;
   char use_extension_repos;
+  char use_evaluated_frame_cache;
+  char use_geometry_nodes_result_cache;
+  char use_geometry_nodes_shared_evaluation;
+  char use_shader_binary_cache;
 
-  char _pad[3];
+  char _pad[6];
   /** `makesdna` does not allow empty structs. */
 } UserDef_Experimental;
 
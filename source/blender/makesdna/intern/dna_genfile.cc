@@ -1154,6 +1154,9 @@ struct DNA_ReconstructInfo {
 
   int *step_counts;
   ReconstructStep **steps;
+
+  /** Index in `newsdna->structs` for every struct in `oldsdna`, -1 when it was removed. */
+  int *new_struct_nrs;
 };
 
 static void reconstruct_structs(const DNA_ReconstructInfo *reconstruct_info,
@@ -1239,8 +1242,8 @@ static void reconstruct_structs(const DNA_ReconstructInfo *reconstruct_info,
   const int new_block_size = reconstruct_info->newsdna->types_size[new_struct->type];
 
   for (int a = 0; a < blocks; a++) {
-    const char *old_block = old_blocks + a * old_block_size;
-    char *new_block = new_blocks + a * new_block_size;
+    const char *old_block = old_blocks + size_t(a) * old_block_size;
+    char *new_block = new_blocks + size_t(a) * new_block_size;
     reconstruct_struct(reconstruct_info, new_struct_nr, old_block, new_block);
   }
 }
@@ -1250,12 +1253,8 @@ void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
                              int blocks,
                              const void *old_blocks)
 {
-  const SDNA *oldsdna = reconstruct_info->oldsdna;
   const SDNA *newsdna = reconstruct_info->newsdna;
-
-  const SDNA_Struct *old_struct = oldsdna->structs[old_struct_nr];
-  const char *type_name = oldsdna->types[old_struct->type];
-  const int new_struct_nr = DNA_struct_find_without_alias(newsdna, type_name);
+  const int new_struct_nr = reconstruct_info->new_struct_nrs[old_struct_nr];
 
   if (new_struct_nr == -1) {
     return nullptr;
@@ -1264,7 +1263,8 @@ void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
   const SDNA_Struct *new_struct = newsdna->structs[new_struct_nr];
   const int new_block_size = newsdna->types_size[new_struct->type];
 
-  char *new_blocks = static_cast<char *>(MEM_callocN(blocks * new_block_size, "reconstruct"));
+  char *new_blocks = static_cast<char *>(
+      MEM_calloc_arrayN(size_t(blocks), size_t(new_block_size), "reconstruct"));
   reconstruct_structs(reconstruct_info,
                       blocks,
                       old_struct_nr,
@@ -1274,6 +1274,41 @@ void *DNA_struct_reconstruct(const DNA_ReconstructInfo *reconstruct_info,
   return new_blocks;
 }
 
+int DNA_struct_reconstruct_size(const DNA_ReconstructInfo *reconstruct_info,
+                                const int old_struct_nr)
+{
+  const int new_struct_nr = reconstruct_info->new_struct_nrs[old_struct_nr];
+  if (new_struct_nr == -1) {
+    return 0;
+  }
+  const SDNA *newsdna = reconstruct_info->newsdna;
+  return newsdna->types_size[newsdna->structs[new_struct_nr]->type];
+}
+
+void DNA_struct_reconstruct_range(const DNA_ReconstructInfo *reconstruct_info,
+                                  const int old_struct_nr,
+                                  const int start,
+                                  const int count,
+                                  const void *old_blocks,
+                                  void *new_blocks)
+{
+  const int new_struct_nr = reconstruct_info->new_struct_nrs[old_struct_nr];
+  if (new_struct_nr == -1) {
+    return;
+  }
+  const SDNA *oldsdna = reconstruct_info->oldsdna;
+  const SDNA *newsdna = reconstruct_info->newsdna;
+  const int old_block_size = oldsdna->types_size[oldsdna->structs[old_struct_nr]->type];
+  const int new_block_size = newsdna->types_size[newsdna->structs[new_struct_nr]->type];
+
+  reconstruct_structs(reconstruct_info,
+                      count,
+                      old_struct_nr,
+                      new_struct_nr,
+                      static_cast<const char *>(old_blocks) + size_t(start) * old_block_size,
+                      static_cast<char *>(new_blocks) + size_t(start) * new_block_size);
+}
+
 /** Finds a member in the given struct with the given name. */
 static const SDNA_StructMember *find_member_with_matching_name(const SDNA *sdna,
                                                                const SDNA_Struct *struct_info,
@@ -1562,6 +1597,15 @@ DNA_ReconstructInfo *DNA_reconstruct_info_create(const SDNA *oldsdna,
       MEM_malloc_arrayN(newsdna->structs_len, sizeof(int), __func__));
   reconstruct_info->steps = static_cast<ReconstructStep **>(
       MEM_malloc_arrayN(newsdna->structs_len, sizeof(ReconstructStep *), __func__));
+  reconstruct_info->new_struct_nrs = static_cast<int *>(
+      MEM_malloc_arrayN(oldsdna->structs_len, sizeof(int), __func__));
+
+  /* Cache the struct mapping, to avoid a name lookup for every reconstructed block. */
+  for (int old_struct_nr = 0; old_struct_nr < oldsdna->structs_len; old_struct_nr++) {
+    const SDNA_Struct *old_struct = oldsdna->structs[old_struct_nr];
+    reconstruct_info->new_struct_nrs[old_struct_nr] = DNA_struct_find_without_alias(
+        newsdna, oldsdna->types[old_struct->type]);
+  }
 
   /* Generate reconstruct steps for all structs. */
   for (int new_struct_nr = 0; new_struct_nr < newsdna->structs_len; new_struct_nr++) {
@@ -1606,6 +1650,7 @@ void DNA_reconstruct_info_free(DNA_ReconstructInfo *reconstruct_info)
   }
   MEM_freeN(reconstruct_info->steps);
   MEM_freeN(reconstruct_info->step_counts);
+  MEM_freeN(reconstruct_info->new_struct_nrs);
   MEM_freeN(reconstruct_info);
 }
 
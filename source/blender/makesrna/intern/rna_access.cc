@@ -4604,6 +4604,17 @@ static int rna_raw_access(ReportList *reports,
 
         size = RNA_raw_type_sizeof(out.type) * arraylen;
 
+        if (out.stride == size) {
+          /* The items are tightly packed, copy all of them at once. */
+          if (set) {
+            memcpy(outp, inp, size_t(size) * size_t(out.len));
+          }
+          else {
+            memcpy(inp, outp, size_t(size) * size_t(out.len));
+          }
+          return 1;
+        }
+
         for (a = 0; a < out.len; a++) {
           if (set) {
             memcpy(outp, inp, size);
@@ -4619,8 +4630,28 @@ static int rna_raw_access(ReportList *reports,
         return 1;
       }
 
-      /* Could also be faster with non-matching types,
-       * for now we just do slower loop. */
+      /* Convert floating point values directly between the raw arrays (e.g. double precision
+       * buffers for single precision properties), instead of accessing every item through RNA.
+       * Other types use the slower loop, which handles range and boolean conversions. */
+      if (itemtype == PROP_FLOAT && ELEM(in.type, PROP_RAW_FLOAT, PROP_RAW_DOUBLE)) {
+        RawArray out_item = out;
+        for (int item = 0; item < out.len; item++) {
+          out_item.array = (char *)out.array + size_t(item) * size_t(out.stride);
+          for (int j = 0; j < arraylen; j++) {
+            const int in_index = item * arraylen + j;
+            double value;
+            if (set) {
+              RAW_GET(double, value, in, in_index);
+              RAW_SET(double, out_item, j, value);
+            }
+            else {
+              RAW_GET(double, value, out_item, j);
+              RAW_SET(double, in, in_index, value);
+            }
+          }
+        }
+        return 1;
+      }
     }
   }
 
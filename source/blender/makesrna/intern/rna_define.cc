@@ -196,6 +196,10 @@ static void rna_brna_structs_remove_and_free(BlenderRNA *brna, StructRNA *srna)
   RNA_def_struct_free_pointers(nullptr, srna);
 
   if (srna->flag & STRUCT_RUNTIME) {
+    if (srna->cont.prophash) {
+      BLI_ghash_free(srna->cont.prophash, nullptr, nullptr);
+      srna->cont.prophash = nullptr;
+    }
     rna_freelinkN(&brna->structs, srna);
   }
   brna->structs_len -= 1;
@@ -1058,6 +1062,16 @@ StructRNA *RNA_def_struct_ptr(BlenderRNA *brna, const char *identifier, StructRN
     }
   }
 
+#ifdef RNA_RUNTIME
+  if (!DefRNA.preprocess) {
+    /* Structs defined at runtime (operator properties, types registered from Python, etc.) are
+     * not handled by #RNA_init, create the property hash here so that looking up their properties
+     * by name does not have to compare against every property. Properties added afterwards are
+     * added to the hash in #RNA_def_property. */
+    srna->cont.prophash = BLI_ghash_str_new("RNA_def_struct_ptr gh");
+  }
+#endif
+
   return srna;
 }
 
@@ -20,6 +20,8 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_path_util.h"
+
 #include "BLT_translation.h"
 
 #include "BKE_animsys.h"
@@ -677,12 +679,15 @@ const EnumPropertyItem rna_enum_subdivision_boundary_smooth_items[] = {
 #  include "BKE_object.hh"
 #  include "BKE_particle.h"
 
+#  include "BLI_fileops.hh"
 #  include "BLI_sort_utils.h"
 
 #  include "DEG_depsgraph.hh"
 #  include "DEG_depsgraph_build.hh"
 #  include "DEG_depsgraph_query.hh"
 
+#  include "NOD_geometry_nodes_log.hh"
+
 #  ifdef WITH_ALEMBIC
 #    include "ABC_alembic.h"
 #  endif
@@ -1702,6 +1707,22 @@ static IDProperty **rna_NodesModifier_properties(PointerRNA *ptr)
   NodesModifierSettings *settings = &nmd->settings;
   return &settings->properties;
 }
+
+static void rna_NodesModifier_execution_profile_export(NodesModifierData *nmd,
+                                                       ReportList *reports,
+                                                       const char *filepath)
+{
+  if (nmd->node_group == nullptr || !nmd->runtime->eval_log) {
+    BKE_report(reports, RPT_ERROR, "The modifier has not been evaluated in the viewport");
+    return;
+  }
+  blender::fstream stream(filepath, std::ios::out);
+  if (!stream) {
+    BKE_reportf(reports, RPT_ERROR, "Could not open file \"%s\" for writing", filepath);
+    return;
+  }
+  nmd->runtime->eval_log->export_profile_json(*nmd->node_group, stream);
+}
 #else
 
 static void rna_def_property_subdivision_common(StructRNA *srna)
@@ -1799,6 +1820,23 @@ static void rna_def_modifier_subsurf(BlenderRNA *brna)
                            "levels of subdivision (smoothest possible shape)");
   RNA_def_property_update(prop, 0, "rna_Modifier_update");
 
+  prop = RNA_def_property(srna, "use_adaptive_levels", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "flags", eSubsurfModifierFlag_UseAdaptiveLevels);
+  RNA_def_property_ui_text(prop,
+                           "Adaptive Levels",
+                           "Use fewer levels when the object is small in the view of the scene "
+                           "camera, the levels are used as a maximum");
+  RNA_def_property_update(prop, 0, "rna_Modifier_dependency_update");
+
+  prop = RNA_def_property(srna, "adaptive_edge_length", PROP_FLOAT, PROP_PIXEL);
+  RNA_def_property_range(prop, 0.1f, FLT_MAX);
+  RNA_def_property_ui_range(prop, 0.5f, 100.0f, 10, 2);
+  RNA_def_property_ui_text(prop,
+                           "Edge Length",
+                           "Approximate length of subdivided edges in pixels of the render "
+                           "from the scene camera");
+  RNA_def_property_update(prop, 0, "rna_Modifier_update");
+
   RNA_define_lib_overridable(false);
 }
 
@@ -7106,6 +7144,8 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
 {
   StructRNA *srna;
   PropertyRNA *prop;
+  FunctionRNA *func;
+  PropertyRNA *parm;
 
   rna_def_modifier_nodes_bake(brna);
   rna_def_modifier_nodes_bakes(brna);
@@ -7143,6 +7183,16 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
   RNA_def_property_update(prop, NC_OBJECT | ND_MODIFIER, nullptr);
 
   RNA_define_lib_overridable(false);
+
+  func = RNA_def_function(
+      srna, "execution_profile_export", "rna_NodesModifier_execution_profile_export");
+  RNA_def_function_ui_description(func,
+                                  "Write the run time, thread and output geometry size of every "
+                                  "node of the last evaluation in the viewport as JSON");
+  RNA_def_function_flag(func, FUNC_USE_REPORTS);
+  parm = RNA_def_string_file_path(
+      func, "filepath", nullptr, FILE_MAX, "File Path", "Output path for the JSON file");
+  RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
 }
 
 static void rna_def_modifier_mesh_to_volume(BlenderRNA *brna)
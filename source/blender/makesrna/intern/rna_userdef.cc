@@ -7125,6 +7125,31 @@ static void rna_def_userdef_experimental(BlenderRNA *brna)
       "These paths are exposed as add-ons, package management is not yet integrated");
   RNA_def_property_boolean_funcs(
       prop, nullptr, "rna_PreferencesExperimental_use_extension_repos_set");
+
+  prop = RNA_def_property(srna, "use_evaluated_frame_cache", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_ui_text(prop,
+                           "Evaluated Frame Cache",
+                           "Keep evaluated mesh geometry of visited frames in memory, to make "
+                           "revisiting them in the viewport faster. The cache is cleared on any "
+                           "change other than the current frame");
+
+  prop = RNA_def_property(srna, "use_geometry_nodes_result_cache", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_ui_text(prop,
+                           "Geometry Nodes Result Cache",
+                           "Keep the results of geometry nodes in memory, so that nodes whose "
+                           "inputs did not change are skipped when the modifier is re-evaluated");
+
+  prop = RNA_def_property(srna, "use_geometry_nodes_shared_evaluation", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_ui_text(prop,
+                           "Geometry Nodes Shared Evaluation",
+                           "Evaluate geometry nodes modifiers only once when multiple objects use "
+                           "them with the same node group, inputs and original geometry");
+
+  prop = RNA_def_property(srna, "use_shader_binary_cache", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_ui_text(prop,
+                           "Shader Binary Cache",
+                           "Store compiled OpenGL shaders on disk, so that they don't have to be "
+                           "compiled again when Blender is restarted");
 }
 
 static void rna_def_userdef_addon_collection(BlenderRNA *brna, PropertyRNA *cprop)
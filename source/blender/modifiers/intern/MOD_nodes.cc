@@ -43,6 +43,7 @@
 #include "BKE_compute_contexts.hh"
 #include "BKE_customdata.hh"
 #include "BKE_geometry_fields.hh"
+#include "BKE_geometry_nodes_shared_evaluation.hh"
 #include "BKE_geometry_set_instances.hh"
 #include "BKE_global.h"
 #include "BKE_idprop.hh"
@@ -142,6 +143,10 @@ static void add_collection_relation(const ModifierUpdateDepsgraphContext *ctx,
 
 static void add_object_relation(const ModifierUpdateDepsgraphContext *ctx, Object &object)
 {
+  /* The transform relation can't be skipped based on which outputs of e.g. the Object Info node
+   * are used, because changing links does not update the depsgraph relations. A transform-only
+   * change of the object still re-evaluates the tree, but nodes whose inputs didn't change can
+   * reuse their previous outputs from the #GeoNodeResultCache. */
   DEG_add_object_relation(ctx->node, &object, DEG_OB_COMP_TRANSFORM, "Nodes Modifier");
   if (&(ID &)object != &ctx->object->id) {
     if (object.type == OB_EMPTY && object.instance_collection != nullptr) {
@@ -849,6 +854,8 @@ class NodesModifierSimulationParams : public nodes::GeoNodesSimulationParams {
               node_cache.frame_caches.append(std::move(frame_cache));
             }
             node_cache.blobs_dir = zone_bake_path->blobs_dir;
+            node_cache.blob_reader = std::make_unique<bke::bake::DiskBlobReader>(
+                zone_bake_path->blobs_dir);
             node_cache.blob_sharing = std::make_unique<bke::bake::BlobSharing>();
             node_cache.cache_status = bake::CacheStatus::Baked;
           }
@@ -1081,16 +1088,15 @@ class NodesModifierSimulationParams : public nodes::GeoNodesSimulationParams {
     if (!frame_cache.state.items_by_id.is_empty()) {
       return;
     }
-    if (!node_cache.blobs_dir) {
+    if (!node_cache.blob_reader) {
       return;
     }
     if (!frame_cache.meta_path) {
       return;
     }
-    bke::bake::DiskBlobReader blob_reader{*node_cache.blobs_dir};
     fstream meta_file{*frame_cache.meta_path};
     std::optional<bke::bake::BakeState> bake_state = bke::bake::deserialize_bake(
-        meta_file, blob_reader, *node_cache.blob_sharing);
+        meta_file, *node_cache.blob_reader, *node_cache.blob_sharing);
     if (!bake_state.has_value()) {
       return;
     }
@@ -1098,6 +1104,38 @@ class NodesModifierSimulationParams : public nodes::GeoNodesSimulationParams {
   }
 };
 
+/**
+ * The result of a node tree can only be shared between objects when it only depends on the
+ * modifier inputs and the input geometry, and not on the object or state stored per modifier.
+ */
+static bool node_tree_result_can_be_shared(const bNodeTree &tree,
+                                           Set<const bNodeTree *> &checked_trees)
+{
+  if (!checked_trees.add(&tree)) {
+    return true;
+  }
+  tree.ensure_topology_cache();
+  for (const StringRefNull idname : {"GeometryNodeSelfObject",
+                                     "GeometryNodeObjectInfo",
+                                     "GeometryNodeCollectionInfo",
+                                     "GeometryNodeDeformCurvesOnSurface",
+                                     "GeometryNodeSimulationOutput",
+                                     "GeometryNodeViewer"})
+  {
+    if (!tree.nodes_by_type(idname).is_empty()) {
+      return false;
+    }
+  }
+  for (const bNode *group_node : tree.group_nodes()) {
+    if (const bNodeTree *group = reinterpret_cast<const bNodeTree *>(group_node->id)) {
+      if (!node_tree_result_can_be_shared(*group, checked_trees)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 static void modifyGeometry(ModifierData *md,
                            const ModifierEvalContext *ctx,
                            bke::GeometrySet &geometry_set)
@@ -1174,14 +1212,41 @@ static void modifyGeometry(ModifierData *md,
 
   bke::ModifierComputeContext modifier_compute_context{nullptr, nmd->modifier.name};
 
-  geometry_set = nodes::execute_geometry_nodes_on_geometry(
-      tree,
-      nmd->settings.properties,
-      modifier_compute_context,
-      std::move(geometry_set),
-      [&](nodes::GeoNodesLFUserData &user_data) {
-        user_data.modifier_data = &modifier_eval_data;
-      });
+  auto execute_tree = [&](bke::GeometrySet input_geometry) {
+    return nodes::execute_geometry_nodes_on_geometry(
+        tree,
+        nmd->settings.properties,
+        modifier_compute_context,
+        std::move(input_geometry),
+        [&](nodes::GeoNodesLFUserData &user_data) {
+          user_data.modifier_data = &modifier_eval_data;
+        });
+  };
+
+  /* Objects which reuse the result of another object don't log anything, so sharing is skipped
+   * when the node editor shows values of this evaluation. */
+  std::shared_ptr<bke::GeometryNodesSharedEvaluations::Evaluation> shared_evaluation;
+  if (bke::GeometryNodesSharedEvaluations *shared_evaluations =
+          DEG_get_geometry_nodes_shared_evaluations(ctx->depsgraph))
+  {
+    Set<const bNodeTree *> checked_trees;
+    if (socket_log_contexts.is_empty() && side_effect_nodes.nodes_by_context.size() == 0 &&
+        side_effect_nodes.iterations_by_repeat_zone.size() == 0 &&
+        (ctx->flag & MOD_APPLY_ORCO) == 0 && node_tree_result_can_be_shared(tree, checked_trees))
+    {
+      shared_evaluation = shared_evaluations->lookup_or_add(
+          tree, nmd->settings.properties, geometry_set);
+    }
+  }
+
+  if (shared_evaluation) {
+    shared_evaluation->result_mutex.ensure(
+        [&]() { shared_evaluation->result = execute_tree(std::move(geometry_set)); });
+    geometry_set = shared_evaluation->result;
+  }
+  else {
+    geometry_set = execute_tree(std::move(geometry_set));
+  }
 
   if (logging_enabled(ctx)) {
     nmd_orig->runtime->eval_log = std::move(eval_log);
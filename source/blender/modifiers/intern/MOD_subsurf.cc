@@ -12,6 +12,9 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_bounds_types.hh"
+#include "BLI_math_matrix.h"
+#include "BLI_math_matrix.hh"
 #include "BLI_string.h"
 #include "BLI_utildefines.h"
 
@@ -23,6 +26,7 @@
 #include "DNA_scene_types.h"
 #include "DNA_screen_types.h"
 
+#include "BKE_camera.h"
 #include "BKE_context.hh"
 #include "BKE_editmesh.hh"
 #include "BKE_mesh.hh"
@@ -44,6 +48,7 @@
 #include "RNA_prototypes.h"
 
 #include "DEG_depsgraph.hh"
+#include "DEG_depsgraph_build.hh"
 #include "DEG_depsgraph_query.hh"
 
 #include "MOD_modifiertypes.hh"
@@ -129,22 +134,96 @@ static bool is_disabled(const Scene *scene, ModifierData *md, bool use_render_pa
   return get_render_subsurf_level(&scene->r, levels, use_render_params != 0) == 0;
 }
 
+/**
+ * Lower the number of levels so that the subdivided edges are roughly
+ * #SubsurfModifierData.adaptive_edge_length pixels long in the render from the scene camera. The
+ * level is the same for the entire mesh, it is chosen based on the average edge length and on the
+ * distance between the camera and the bounds of the mesh.
+ */
+static int subdiv_adaptive_levels_get(const SubsurfModifierData *smd,
+                                      const ModifierEvalContext *ctx,
+                                      const Scene *scene,
+                                      const Mesh *mesh,
+                                      const int max_levels)
+{
+  using namespace blender;
+  const Object *camera = scene->camera;
+  if (camera == nullptr || camera->type != OB_CAMERA || mesh->totedge == 0) {
+    return max_levels;
+  }
+  const std::optional<Bounds<float3>> bounds = mesh->bounds_min_max();
+  if (!bounds) {
+    return max_levels;
+  }
+
+  const float4x4 object_to_world(ctx->object->object_to_world);
+  Bounds<float3> world_bounds = {float3(FLT_MAX), float3(-FLT_MAX)};
+  for (const int i : IndexRange(8)) {
+    const float3 corner((i & 1) ? bounds->max.x : bounds->min.x,
+                        (i & 2) ? bounds->max.y : bounds->min.y,
+                        (i & 4) ? bounds->max.z : bounds->min.z);
+    const float3 world_corner = math::transform_point(object_to_world, corner);
+    world_bounds.min = math::min(world_bounds.min, world_corner);
+    world_bounds.max = math::max(world_bounds.max, world_corner);
+  }
+  const float3 camera_location(camera->object_to_world[3]);
+  const float distance = math::distance(
+      camera_location, math::clamp(camera_location, world_bounds.min, world_bounds.max));
+
+  CameraParams params;
+  BKE_camera_params_init(&params);
+  BKE_camera_params_from_object(&params, camera);
+  int width, height;
+  BKE_render_resolution(&scene->r, false, &width, &height);
+  BKE_camera_params_compute_viewplane(&params, width, height, scene->r.xasp, scene->r.yasp);
+  /* The size of a pixel at the clip start distance for perspective cameras. */
+  float pixel_size = params.viewdx;
+  if (!params.is_ortho) {
+    pixel_size *= std::max(distance, params.clip_start) / params.clip_start;
+  }
+
+  /* Computed serially, so that the result does not change between evaluations. */
+  const Span<float3> positions = mesh->vert_positions();
+  double length_sum = 0.0;
+  for (const int2 edge : mesh->edges()) {
+    length_sum += math::distance(positions[edge[0]], positions[edge[1]]);
+  }
+  const float edge_length = float(length_sum / mesh->totedge) *
+                            mat4_to_scale(ctx->object->object_to_world);
+
+  const float edge_length_px = edge_length / pixel_size;
+  const float target_length_px = std::max(smd->adaptive_edge_length, 0.1f);
+  if (edge_length_px <= target_length_px) {
+    return 0;
+  }
+  const int level = int(std::ceil(std::log2(edge_length_px / target_length_px)));
+  return std::min(level, max_levels);
+}
+
 static int subdiv_levels_for_modifier_get(const SubsurfModifierData *smd,
-                                          const ModifierEvalContext *ctx)
+                                          const ModifierEvalContext *ctx,
+                                          const Mesh *mesh)
 {
   Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
   const bool use_render_params = (ctx->flag & MOD_APPLY_RENDER);
   const int requested_levels = (use_render_params) ? smd->renderLevels : smd->levels;
-  return get_render_subsurf_level(&scene->r, requested_levels, use_render_params);
+  const int levels = get_render_subsurf_level(&scene->r, requested_levels, use_render_params);
+  if ((smd->flags & eSubsurfModifierFlag_UseAdaptiveLevels) &&
+      !(ctx->flag & MOD_APPLY_TO_BASE_MESH) && levels > 0)
+  {
+    return subdiv_adaptive_levels_get(smd, ctx, scene, mesh, levels);
+  }
+  return levels;
 }
 
 /* Subdivide into fully qualified mesh. */
 
 static void subdiv_mesh_settings_init(SubdivToMeshSettings *settings,
                                       const SubsurfModifierData *smd,
-                                      const ModifierEvalContext *ctx)
+                                      const ModifierEvalContext *ctx,
+                                      const Mesh *mesh)
 {
-  const int level = subdiv_levels_for_modifier_get(smd, ctx);
+  const int level = subdiv_levels_for_modifier_get(smd, ctx, mesh);
   settings->resolution = (1 << level) + 1;
   settings->use_optimal_display = (smd->flags & eSubsurfModifierFlag_ControlEdges) &&
                                   !(ctx->flag & MOD_APPLY_TO_BASE_MESH);
@@ -157,7 +236,7 @@ static Mesh *subdiv_as_mesh(SubsurfModifierData *smd,
 {
   Mesh *result = mesh;
   SubdivToMeshSettings mesh_settings;
-  subdiv_mesh_settings_init(&mesh_settings, smd, ctx);
+  subdiv_mesh_settings_init(&mesh_settings, smd, ctx, mesh);
   if (mesh_settings.resolution < 3) {
     return result;
   }
@@ -169,9 +248,10 @@ static Mesh *subdiv_as_mesh(SubsurfModifierData *smd,
 
 static void subdiv_ccg_settings_init(SubdivToCCGSettings *settings,
                                      const SubsurfModifierData *smd,
-                                     const ModifierEvalContext *ctx)
+                                     const ModifierEvalContext *ctx,
+                                     const Mesh *mesh)
 {
-  const int level = subdiv_levels_for_modifier_get(smd, ctx);
+  const int level = subdiv_levels_for_modifier_get(smd, ctx, mesh);
   settings->resolution = (1 << level) + 1;
   settings->need_normal = true;
   settings->need_mask = false;
@@ -184,7 +264,7 @@ static Mesh *subdiv_as_ccg(SubsurfModifierData *smd,
 {
   Mesh *result = mesh;
   SubdivToCCGSettings ccg_settings;
-  subdiv_ccg_settings_init(&ccg_settings, smd, ctx);
+  subdiv_ccg_settings_init(&ccg_settings, smd, ctx, mesh);
   if (ccg_settings.resolution < 3) {
     return result;
   }
@@ -200,7 +280,7 @@ static void subdiv_cache_mesh_wrapper_settings(const ModifierEvalContext *ctx,
                                                SubsurfRuntimeData *runtime_data)
 {
   SubdivToMeshSettings mesh_settings;
-  subdiv_mesh_settings_init(&mesh_settings, smd, ctx);
+  subdiv_mesh_settings_init(&mesh_settings, smd, ctx, mesh);
 
   runtime_data->has_gpu_subdiv = true;
   runtime_data->resolution = mesh_settings.resolution;
@@ -283,6 +363,23 @@ static Mesh *modify_mesh(ModifierData *md, const ModifierEvalContext *ctx, Mesh
   return result;
 }
 
+static void update_depsgraph(ModifierData *md, const ModifierUpdateDepsgraphContext *ctx)
+{
+  SubsurfModifierData *smd = (SubsurfModifierData *)md;
+  if ((smd->flags & eSubsurfModifierFlag_UseAdaptiveLevels) == 0) {
+    return;
+  }
+  /* The levels depend on the active camera and the render resolution. */
+  DEG_add_scene_relation(ctx->node, ctx->scene, DEG_SCENE_COMP_PARAMETERS, "Subsurf Modifier");
+  if (ctx->scene->camera != nullptr) {
+    DEG_add_object_relation(
+        ctx->node, ctx->scene->camera, DEG_OB_COMP_TRANSFORM, "Subsurf Modifier Camera");
+    DEG_add_object_relation(
+        ctx->node, ctx->scene->camera, DEG_OB_COMP_PARAMETERS, "Subsurf Modifier Camera");
+  }
+  DEG_add_depends_on_transform_relation(ctx->node, "Subsurf Modifier");
+}
+
 static void deform_matrices(ModifierData *md,
                             const ModifierEvalContext *ctx,
                             Mesh *mesh,
@@ -403,6 +500,12 @@ static void panel_draw(const bContext *C, Panel *panel)
     uiLayout *col = uiLayoutColumn(layout, true);
     uiItemR(col, ptr, "levels", UI_ITEM_NONE, IFACE_("Levels Viewport"), ICON_NONE);
     uiItemR(col, ptr, "render_levels", UI_ITEM_NONE, IFACE_("Render"), ICON_NONE);
+
+    uiLayout *row = uiLayoutRowWithHeading(layout, true, IFACE_("Adaptive Levels"));
+    uiItemR(row, ptr, "use_adaptive_levels", UI_ITEM_NONE, "", ICON_NONE);
+    uiLayout *sub = uiLayoutRow(row, true);
+    uiLayoutSetActive(sub, RNA_boolean_get(ptr, "use_adaptive_levels"));
+    uiItemR(sub, ptr, "adaptive_edge_length", UI_ITEM_NONE, "", ICON_NONE);
   }
 
   uiItemR(layout, ptr, "show_only_control_edges", UI_ITEM_NONE, nullptr, ICON_NONE);
@@ -507,7 +610,7 @@ ModifierTypeInfo modifierType_Subsurf = {
     /*required_data_mask*/ required_data_mask,
     /*free_data*/ free_data,
     /*is_disabled*/ is_disabled,
-    /*update_depsgraph*/ nullptr,
+    /*update_depsgraph*/ update_depsgraph,
     /*depends_on_time*/ nullptr,
     /*depends_on_normals*/ depends_on_normals,
     /*foreach_ID_link*/ nullptr,
@@ -10,6 +10,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.h"
@@ -37,12 +38,40 @@
 #include "MOD_modifiertypes.hh"
 #include "MOD_ui_common.hh"
 
+static bool mesh_has_faces_to_triangulate(const Mesh &mesh, const int min_vertices)
+{
+  using namespace blender;
+  const OffsetIndices faces = mesh.faces();
+  return threading::parallel_reduce(
+      faces.index_range(),
+      4096,
+      false,
+      [&](const IndexRange range, bool found) {
+        if (found) {
+          return true;
+        }
+        for (const int face : range) {
+          if (faces[face].size() > 3 && faces[face].size() >= min_vertices) {
+            return true;
+          }
+        }
+        return false;
+      },
+      std::logical_or<bool>());
+}
+
 static Mesh *triangulate_mesh(Mesh *mesh,
                               const int quad_method,
                               const int ngon_method,
                               const int min_vertices,
                               const int flag)
 {
+  /* Avoid the conversion to #BMesh and back when the mesh is already triangulated, which is
+   * common when the modifier follows other modifiers that only output triangles. */
+  if (!mesh_has_faces_to_triangulate(*mesh, min_vertices)) {
+    return nullptr;
+  }
+
   Mesh *result;
   BMesh *bm;
   CustomData_MeshMasks cd_mask_extra{};
@@ -193,6 +193,8 @@ class GeoTreeLogger {
     int32_t node_id;
     TimePoint start;
     TimePoint end;
+    /** The node did not run, its outputs were taken from #GeoNodeResultCache. */
+    bool used_cached_result = false;
   };
   struct ViewerNodeLogWithNode {
     int32_t node_id;
@@ -207,6 +209,13 @@ class GeoTreeLogger {
     int32_t node_id;
     StringRefNull message;
   };
+  /** Size of a geometry output by a node, used for profiling. */
+  struct OutputGeometryStats {
+    int32_t node_id;
+    int64_t points_num;
+    int64_t instances_num;
+    int64_t memory;
+  };
 
   Vector<WarningWithNode> node_warnings;
   Vector<SocketValueLog> input_socket_values;
@@ -215,12 +224,14 @@ class GeoTreeLogger {
   Vector<ViewerNodeLogWithNode, 0> viewer_node_logs;
   Vector<AttributeUsageWithNode, 0> used_named_attributes;
   Vector<DebugMessage, 0> debug_messages;
+  Vector<OutputGeometryStats, 0> output_geometry_stats;
 
   GeoTreeLogger();
   ~GeoTreeLogger();
 
   void log_value(const bNode &node, const bNodeSocket &socket, GPointer value);
   void log_viewer_node(const bNode &viewer_node, bke::GeometrySet geometry);
+  void log_output_geometry_stats(const bNode &node, const bke::GeometrySet &geometry);
 };
 
 /**
@@ -344,6 +355,12 @@ class GeoModifierLog {
   static Map<const bke::bNodeTreeZone *, GeoTreeLog *> get_tree_log_by_zone_for_node_editor(
       const SpaceNode &snode);
   static const ViewerNodeLog *find_viewer_node_log_for_path(const ViewerPath &viewer_path);
+
+  /**
+   * Write the execution time, thread and output size of every node that was executed as JSON.
+   * Node names are looked up in the given tree and the node groups it uses.
+   */
+  void export_profile_json(const bNodeTree &root_tree, std::ostream &stream);
 };
 
 }  // namespace blender::nodes::geo_eval_log
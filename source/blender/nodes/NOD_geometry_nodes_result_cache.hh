@@ -0,0 +1,118 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup nodes
+ *
+ * Cache of the outputs of individual geometry nodes, used to skip the execution of nodes whose
+ * inputs did not change since the previous evaluation of the same node tree. When only an input
+ * near the end of a large node tree changes, all nodes before it can output their previous
+ * results, which in turn makes the inputs of the next nodes equal to the cached ones.
+ *
+ * Geometries are compared by the identity of their implicitly shared components. This is only
+ * valid as long as the components are not freed or modified, which is why entries also keep a
+ * copy of the inputs they were computed from: a component can only be modified in place when
+ * it has a single user.
+ */
+
+#include <list>
+#include <memory>
+#include <mutex>
+
+#include "BLI_compute_context.hh"
+#include "BLI_generic_pointer.hh"
+#include "BLI_map.hh"
+#include "BLI_vector.hh"
+
+#include "NOD_geometry_nodes_log.hh"
+
+struct bNode;
+
+namespace blender::nodes {
+
+class GeoNodeResultCache {
+ public:
+  /** Approximate limit of the memory used by the geometry outputs of all cached nodes. */
+  static constexpr size_t memory_limit = size_t(1) << 30;
+
+  /**
+   * Identifies a node evaluation. There is only one entry per key, so the cache never contains
+   * more entries than there are evaluated nodes.
+   */
+  struct Key {
+    uint32_t object_session_uuid;
+    uint32_t tree_session_uuid;
+    ComputeContextHash context_hash;
+    int32_t node_id;
+
+    uint64_t hash() const
+    {
+      return get_default_hash_4(object_session_uuid, tree_session_uuid, context_hash, node_id);
+    }
+
+    BLI_STRUCT_EQUALITY_OPERATORS_4(
+        Key, object_session_uuid, tree_session_uuid, context_hash, node_id)
+  };
+
+  struct Entry {
+    /** Values of the RNA properties of the node type, see #node_settings_equal. */
+    Vector<uint8_t> node_settings;
+    uint64_t node_settings_hash;
+    /** Copies of all lazy-function inputs the node was executed with. */
+    Vector<GMutablePointer> inputs;
+    /** Outputs computed by the node. The data is null for outputs that were not computed. */
+    Vector<GMutablePointer> outputs;
+    /**
+     * Warnings and attribute usages are replayed when the entry is used, but they are only known
+     * when logging was enabled during the execution.
+     */
+    bool has_log = false;
+    Vector<geo_eval_log::NodeWarning> warnings;
+    Vector<std::pair<std::string, geo_eval_log::NamedAttributeUsage>> used_named_attributes;
+    size_t memory = 0;
+
+    Entry(const bNode &node);
+    ~Entry();
+
+    bool node_settings_equal(const bNode &node) const;
+  };
+
+ private:
+  struct StoredEntry {
+    std::shared_ptr<const Entry> entry;
+    /** Position of the key in #lru_keys_. */
+    std::list<Key>::iterator lru_position;
+  };
+
+  std::mutex mutex_;
+  Map<Key, StoredEntry> entries_;
+  /** Keys of all entries, ordered from the least to the most recently used. */
+  std::list<Key> lru_keys_;
+  size_t memory_ = 0;
+
+ public:
+  static GeoNodeResultCache &get();
+
+  /** Thread-safe. The returned entry stays valid even when it is removed from the cache. */
+  std::shared_ptr<const Entry> lookup(const Key &key);
+  /** Thread-safe. Replaces an existing entry and removes the least recently used entries. */
+  void add(const Key &key, std::shared_ptr<Entry> entry);
+  /**
+   * Remove all entries. Called when the main database is freed (e.g. when loading a file or on
+   * undo), since the entries can't be used anymore afterwards.
+   */
+  void clear();
+
+  /**
+   * Compare two lazy-function values of the given type. False is returned when equality can't be
+   * determined, which just makes the cached result unused.
+   */
+  static bool values_equal(const CPPType &type, const void *a, const void *b);
+  /** Values referencing data that is not owned by them (e.g. object instances) can't be cached. */
+  static bool value_can_be_cached(const CPPType &type, const void *value);
+};
+
+}  // namespace blender::nodes
@@ -118,7 +118,10 @@ static void sample_mesh_surface(const Mesh &mesh,
   const Span<int> corner_verts = mesh.corner_verts();
   const Span<MLoopTri> looptris = mesh.looptris();
 
-  for (const int looptri_index : looptris.index_range()) {
+  /* Every triangle has its own random number generator, so that the points of every triangle can
+   * be generated independently. The amount of points is computed first, so that the points can be
+   * written to their final place in parallel. */
+  auto looptri_rng_and_amount = [&](const int looptri_index, RandomNumberGenerator &r_rng) {
     const MLoopTri &looptri = looptris[looptri_index];
     const int v0_loop = looptri.tri[0];
     const int v1_loop = looptri.tri[1];
@@ -137,20 +140,47 @@ static void sample_mesh_surface(const Mesh &mesh,
     const float area = area_tri_v3(v0_pos, v1_pos, v2_pos);
 
     const int looptri_seed = noise::hash(looptri_index, seed);
-    RandomNumberGenerator looptri_rng(looptri_seed);
-
-    const int point_amount = looptri_rng.round_probabilistic(area * base_density *
-                                                             looptri_density_factor);
-
-    for (int i = 0; i < point_amount; i++) {
-      const float3 bary_coord = looptri_rng.get_barycentric_coordinates();
-      float3 point_pos;
-      interp_v3_v3v3v3(point_pos, v0_pos, v1_pos, v2_pos, bary_coord);
-      r_positions.append(point_pos);
-      r_bary_coords.append(bary_coord);
-      r_looptri_indices.append(looptri_index);
+    r_rng = RandomNumberGenerator(looptri_seed);
+
+    return r_rng.round_probabilistic(area * base_density * looptri_density_factor);
+  };
+
+  Array<int> point_offsets(looptris.size() + 1);
+  threading::parallel_for(looptris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int looptri_index : range) {
+      RandomNumberGenerator looptri_rng;
+      point_offsets[looptri_index] = looptri_rng_and_amount(looptri_index, looptri_rng);
     }
-  }
+  });
+  const OffsetIndices<int> points_by_looptri = offset_indices::accumulate_counts_to_offsets(
+      point_offsets);
+
+  r_positions.reinitialize(points_by_looptri.total_size());
+  r_bary_coords.reinitialize(points_by_looptri.total_size());
+  r_looptri_indices.reinitialize(points_by_looptri.total_size());
+
+  threading::parallel_for(looptris.index_range(), 1024, [&](const IndexRange range) {
+    for (const int looptri_index : range) {
+      const IndexRange points = points_by_looptri[looptri_index];
+      if (points.is_empty()) {
+        continue;
+      }
+      RandomNumberGenerator looptri_rng;
+      looptri_rng_and_amount(looptri_index, looptri_rng);
+
+      const MLoopTri &looptri = looptris[looptri_index];
+      const float3 &v0_pos = positions[corner_verts[looptri.tri[0]]];
+      const float3 &v1_pos = positions[corner_verts[looptri.tri[1]]];
+      const float3 &v2_pos = positions[corner_verts[looptri.tri[2]]];
+
+      for (const int i : points) {
+        const float3 bary_coord = looptri_rng.get_barycentric_coordinates();
+        interp_v3_v3v3v3(r_positions[i], v0_pos, v1_pos, v2_pos, bary_coord);
+        r_bary_coords[i] = bary_coord;
+        r_looptri_indices[i] = looptri_index;
+      }
+    }
+  });
 }
 
 BLI_NOINLINE static KDTree_3d *build_kdtree(Span<float3> positions)
@@ -210,30 +240,33 @@ BLI_NOINLINE static void update_elimination_mask_based_on_density_factors(
     const MutableSpan<bool> elimination_mask)
 {
   const Span<MLoopTri> looptris = mesh.looptris();
-  for (const int i : bary_coords.index_range()) {
-    if (elimination_mask[i]) {
-      continue;
-    }
+  threading::parallel_for(bary_coords.index_range(), 2048, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (elimination_mask[i]) {
+        continue;
+      }
 
-    const MLoopTri &looptri = looptris[looptri_indices[i]];
-    const float3 bary_coord = bary_coords[i];
+      const MLoopTri &looptri = looptris[looptri_indices[i]];
+      const float3 bary_coord = bary_coords[i];
 
-    const int v0_loop = looptri.tri[0];
-    const int v1_loop = looptri.tri[1];
-    const int v2_loop = looptri.tri[2];
+      const int v0_loop = looptri.tri[0];
+      const int v1_loop = looptri.tri[1];
+      const int v2_loop = looptri.tri[2];
 
-    const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
-    const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
-    const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
+      const float v0_density_factor = std::max(0.0f, density_factors[v0_loop]);
+      const float v1_density_factor = std::max(0.0f, density_factors[v1_loop]);
+      const float v2_density_factor = std::max(0.0f, density_factors[v2_loop]);
 
-    const float probability = v0_density_factor * bary_coord.x + v1_density_factor * bary_coord.y +
-                              v2_density_factor * bary_coord.z;
+      const float probability = v0_density_factor * bary_coord.x +
+                                v1_density_factor * bary_coord.y +
+                                v2_density_factor * bary_coord.z;
 
-    const float hash = noise::hash_float_to_float(bary_coord);
-    if (hash > probability) {
-      elimination_mask[i] = true;
+      const float hash = noise::hash_float_to_float(bary_coord);
+      if (hash > probability) {
+        elimination_mask[i] = true;
+      }
     }
-  }
+  });
 }
 
 BLI_NOINLINE static void eliminate_points_based_on_mask(const Span<bool> elimination_mask,
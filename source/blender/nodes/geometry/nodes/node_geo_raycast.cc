@@ -202,6 +202,14 @@ class RaycastFunction : public mf::MultiFunction {
                     params.uninitialized_single_output_if_required<float3>(5, "Hit Normal"),
                     params.uninitialized_single_output_if_required<float>(6, "Distance"));
   }
+
+  ExecutionHints get_execution_hints() const override
+  {
+    /* Casting a ray is expensive compared to most other field operations. */
+    ExecutionHints hints;
+    hints.min_grain_size = 512;
+    return hints;
+  }
 };
 
 static void node_geo_exec(GeoNodeExecParams params)
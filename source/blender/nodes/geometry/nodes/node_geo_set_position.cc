@@ -26,6 +26,29 @@ static void node_declare(NodeDeclarationBuilder &b)
   b.add_output<decl::Geometry>("Geometry").propagate_all();
 }
 
+static void set_position_values(const VArray<float3> &in_positions,
+                                const VArray<float3> &in_offsets,
+                                const bool positions_are_original,
+                                const IndexMask &selection,
+                                const GrainSize grain_size,
+                                MutableSpan<float3> out_positions)
+{
+  if (positions_are_original) {
+    devirtualize_varray(in_offsets, [&](const auto in_offsets) {
+      selection.foreach_index_optimized<int>(
+          grain_size, [&](const int i) { out_positions[i] += in_offsets[i]; });
+    });
+  }
+  else {
+    devirtualize_varray2(
+        in_positions, in_offsets, [&](const auto in_positions, const auto in_offsets) {
+          selection.foreach_index_optimized<int>(grain_size, [&](const int i) {
+            out_positions[i] = in_positions[i] + in_offsets[i];
+          });
+        });
+  }
+}
+
 static void set_computed_position_and_offset(GeometryComponent &component,
                                              const VArray<float3> &in_positions,
                                              const VArray<float3> &in_offsets,
@@ -50,6 +73,19 @@ static void set_computed_position_and_offset(GeometryComponent &component,
   const GrainSize grain_size{10000};
 
   switch (component.type()) {
+    case GeometryComponent::Type::Mesh: {
+      /* Write to the mesh directly, so that only the normals around the moved vertices have to be
+       * recomputed. */
+      Mesh &mesh = *static_cast<MeshComponent &>(component).get_for_write();
+      set_position_values(in_positions,
+                          in_offsets,
+                          positions_are_original,
+                          selection,
+                          grain_size,
+                          mesh.vert_positions_for_write());
+      bke::mesh_tag_positions_changed_partial(mesh, selection);
+      break;
+    }
     case GeometryComponent::Type::Curve: {
       if (attributes.contains("handle_right") && attributes.contains("handle_left")) {
         CurveComponent &curve_component = static_cast<CurveComponent &>(component);
@@ -87,20 +123,12 @@ static void set_computed_position_and_offset(GeometryComponent &component,
     default: {
       AttributeWriter<float3> positions = attributes.lookup_for_write<float3>("position");
       MutableVArraySpan<float3> out_positions_span = positions.varray;
-      if (positions_are_original) {
-        devirtualize_varray(in_offsets, [&](const auto in_offsets) {
-          selection.foreach_index_optimized<int>(
-              grain_size, [&](const int i) { out_positions_span[i] += in_offsets[i]; });
-        });
-      }
-      else {
-        devirtualize_varray2(
-            in_positions, in_offsets, [&](const auto in_positions, const auto in_offsets) {
-              selection.foreach_index_optimized<int>(grain_size, [&](const int i) {
-                out_positions_span[i] = in_positions[i] + in_offsets[i];
-              });
-            });
-      }
+      set_position_values(in_positions,
+                          in_offsets,
+                          positions_are_original,
+                          selection,
+                          grain_size,
+                          out_positions_span);
       out_positions_span.save();
       positions.finish();
       break;
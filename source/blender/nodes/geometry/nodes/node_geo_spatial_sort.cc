@@ -0,0 +1,48 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "DNA_mesh_types.h"
+#include "DNA_pointcloud_types.h"
+
+#include "GEO_reorder.hh"
+
+#include "node_geometry_util.hh"
+
+namespace blender::nodes::node_geo_spatial_sort_cc {
+
+static void node_declare(NodeDeclarationBuilder &b)
+{
+  b.add_input<decl::Geometry>("Geometry")
+      .supported_type({GeometryComponent::Type::PointCloud, GeometryComponent::Type::Mesh});
+  b.add_output<decl::Geometry>("Geometry").propagate_all();
+}
+
+static void node_geo_exec(GeoNodeExecParams params)
+{
+  GeometrySet geometry_set = params.extract_input<GeometrySet>("Geometry");
+
+  geometry_set.modify_geometry_sets([&](GeometrySet &geometry_set) {
+    if (geometry_set.has_mesh()) {
+      geometry::spatially_reorder_mesh(*geometry_set.get_mesh_for_write());
+    }
+    if (geometry_set.has_pointcloud()) {
+      geometry::spatially_reorder_points(*geometry_set.get_pointcloud_for_write());
+    }
+  });
+
+  params.set_output("Geometry", std::move(geometry_set));
+}
+
+static void node_register()
+{
+  static bNodeType ntype;
+
+  geo_node_type_base(&ntype, GEO_NODE_SPATIAL_SORT, "Spatial Sort", NODE_CLASS_GEOMETRY);
+  ntype.declare = node_declare;
+  ntype.geometry_node_execute = node_geo_exec;
+  nodeRegisterType(&ntype);
+}
+NOD_REGISTER_NODE(node_register)
+
+}  // namespace blender::nodes::node_geo_spatial_sort_cc
@@ -51,18 +51,9 @@ static void translate_positions(MutableSpan<float3> positions, const float3 &tra
   });
 }
 
-static void transform_positions(MutableSpan<float3> positions, const float4x4 &matrix)
-{
-  threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
-    for (float3 &position : positions.slice(range)) {
-      position = math::transform_point(matrix, position);
-    }
-  });
-}
-
 static void transform_mesh(Mesh &mesh, const float4x4 &transform)
 {
-  transform_positions(mesh.vert_positions_for_write(), transform);
+  math::transform_points(transform, mesh.vert_positions_for_write());
   BKE_mesh_tag_positions_changed(&mesh);
 }
 
@@ -95,7 +86,7 @@ static void transform_pointcloud(PointCloud &pointcloud, const float4x4 &transfo
   MutableAttributeAccessor attributes = pointcloud.attributes_for_write();
   SpanAttributeWriter position = attributes.lookup_or_add_for_write_span<float3>(
       "position", ATTR_DOMAIN_POINT);
-  transform_positions(position.span, transform);
+  math::transform_points(transform, position.span);
   position.finish();
 }
 
@@ -201,7 +192,7 @@ static void translate_volume(GeoNodeExecParams &params,
 static void transform_curve_edit_hints(bke::CurvesEditHints &edit_hints, const float4x4 &transform)
 {
   if (edit_hints.positions.has_value()) {
-    transform_positions(*edit_hints.positions, transform);
+    math::transform_points(transform, *edit_hints.positions);
   }
   float3x3 deform_mat;
   copy_m3_m4(deform_mat.ptr(), transform.ptr());
@@ -22,6 +22,7 @@
 
 #include "NOD_geometry_exec.hh"
 #include "NOD_geometry_nodes_lazy_function.hh"
+#include "NOD_geometry_nodes_result_cache.hh"
 #include "NOD_multi_function.hh"
 #include "NOD_node_declaration.hh"
 
@@ -36,6 +37,7 @@
 #include "BLI_map.hh"
 
 #include "DNA_ID.h"
+#include "DNA_userdef_types.h"
 
 #include "BKE_compute_contexts.hh"
 #include "BKE_geometry_set.hh"
@@ -150,6 +152,112 @@ std::string NodeAnonymousAttributeID::user_name() const
   return socket_name_;
 }
 
+static GMutablePointer copy_value_for_result_cache(const CPPType &type, const void *value)
+{
+  void *buffer = MEM_mallocN_aligned(type.size(), type.alignment(), __func__);
+  type.copy_construct(value, buffer);
+  return {type, buffer};
+}
+
+/**
+ * Whether the outputs of the node only depend on its inputs and settings, so that they can be
+ * reused from #GeoNodeResultCache when those did not change.
+ */
+static bool node_result_can_be_cached(const bNode &node, const Span<lf::Input> inputs)
+{
+  if (inputs.is_empty()) {
+    /* Such nodes are cheap and often depend on the evaluation context. */
+    return false;
+  }
+  if (node.id != nullptr) {
+    return false;
+  }
+  if (node.type == GEO_NODE_DEFORM_CURVES_ON_SURFACE) {
+    /* Depends on the surface object of the modifier object. */
+    return false;
+  }
+  for (const lf::Input &input : inputs) {
+    /* Referenced data-blocks can change without changing the pointer. */
+    if (ELEM(input.type,
+             &CPPType::get<Object *>(),
+             &CPPType::get<Collection *>(),
+             &CPPType::get<Image *>(),
+             &CPPType::get<Tex *>()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Forwards everything to the parameters of the node evaluation, but also records the outputs that
+ * are computed in a #GeoNodeResultCache entry.
+ */
+class GeoNodeResultCacheParams : public lf::Params {
+ private:
+  lf::Params &params_;
+  GeoNodeResultCache::Entry &entry_;
+  std::mutex mutex_;
+
+ public:
+  GeoNodeResultCacheParams(const LazyFunction &fn,
+                           lf::Params &params,
+                           GeoNodeResultCache::Entry &entry)
+      : lf::Params(fn, false), params_(params), entry_(entry)
+  {
+  }
+
+ private:
+  void *try_get_input_data_ptr_impl(const int index) const override
+  {
+    return params_.try_get_input_data_ptr(index);
+  }
+
+  void *try_get_input_data_ptr_or_request_impl(const int index) override
+  {
+    return params_.try_get_input_data_ptr_or_request(index);
+  }
+
+  void *get_output_data_ptr_impl(const int index) override
+  {
+    return params_.get_output_data_ptr(index);
+  }
+
+  void output_set_impl(const int index) override
+  {
+    /* The value may be moved away as soon as the output is set. */
+    const CPPType &type = *fn_.outputs()[index].type;
+    GMutablePointer value = copy_value_for_result_cache(type, params_.get_output_data_ptr(index));
+    {
+      std::lock_guard lock{mutex_};
+      BLI_assert(entry_.outputs[index].get() == nullptr);
+      entry_.outputs[index] = value;
+    }
+    params_.output_set(index);
+  }
+
+  bool output_was_set_impl(const int index) const override
+  {
+    return params_.output_was_set(index);
+  }
+
+  lf::ValueUsage get_output_usage_impl(const int index) const override
+  {
+    return params_.get_output_usage(index);
+  }
+
+  void set_input_unused_impl(const int index) override
+  {
+    params_.set_input_unused(index);
+  }
+
+  bool try_enable_multi_threading_impl() override
+  {
+    return params_.try_enable_multi_threading();
+  }
+};
+
 /**
  * Used for most normal geometry nodes like Subdivision Surface and Set Position.
  */
@@ -157,6 +265,8 @@ class LazyFunctionForGeometryNode : public LazyFunction {
  private:
   const bNode &node_;
   const GeometryNodesLazyFunctionGraphInfo &own_lf_graph_info_;
+  /** See #node_result_can_be_cached. */
+  bool use_result_cache_;
   /**
    * A bool for every output bsocket. If true, the socket just outputs a field containing an
    * anonymous attribute id. If only such outputs are requested by other nodes, the node itself
@@ -184,6 +294,7 @@ class LazyFunctionForGeometryNode : public LazyFunction {
     debug_name_ = node.name;
     lazy_function_interface_from_node(
         node, inputs_, outputs_, own_lf_graph_info.mapping.lf_index_by_bsocket);
+    use_result_cache_ = node_result_can_be_cached(node, inputs_);
 
     const NodeDeclaration &node_decl = *node.declaration();
     const aal::RelationsInNode *relations = node_decl.anonymous_attribute_relations();
@@ -317,9 +428,34 @@ class LazyFunctionForGeometryNode : public LazyFunction {
       return;
     }
 
+    geo_eval_log::GeoTreeLogger *tree_logger = local_user_data.try_get_tree_logger(*user_data);
+
+    const std::optional<GeoNodeResultCache::Key> cache_key = this->get_result_cache_key(
+        *user_data);
+    std::shared_ptr<GeoNodeResultCache::Entry> cache_entry;
+    std::optional<GeoNodeResultCacheParams> cache_params;
+    if (cache_key) {
+      geo_eval_log::TimePoint start_time = geo_eval_log::Clock::now();
+      if (this->try_use_cached_result(params, *cache_key, tree_logger)) {
+        if (tree_logger) {
+          tree_logger->node_execution_times.append(
+              {node_.identifier, start_time, geo_eval_log::Clock::now(), true});
+        }
+        return;
+      }
+      cache_entry = this->create_result_cache_entry(params, tree_logger);
+      if (cache_entry) {
+        cache_params.emplace(*this, params, *cache_entry);
+      }
+    }
+    const int64_t old_warnings_num = tree_logger ? tree_logger->node_warnings.size() : 0;
+    const int64_t old_used_named_attributes_num = tree_logger ?
+                                                      tree_logger->used_named_attributes.size() :
+                                                      0;
+
     GeoNodeExecParams geo_params{
         node_,
-        params,
+        cache_params ? *cache_params : params,
         context,
         own_lf_graph_info_.mapping.lf_input_index_for_output_bsocket_usage,
         own_lf_graph_info_.mapping.lf_input_index_for_attribute_propagation_to_output,
@@ -329,10 +465,137 @@ class LazyFunctionForGeometryNode : public LazyFunction {
     node_.typeinfo->geometry_node_execute(geo_params);
     geo_eval_log::TimePoint end_time = geo_eval_log::Clock::now();
 
-    if (geo_eval_log::GeoTreeLogger *tree_logger = local_user_data.try_get_tree_logger(*user_data))
-    {
+    if (tree_logger) {
       tree_logger->node_execution_times.append({node_.identifier, start_time, end_time});
     }
+
+    if (cache_entry) {
+      if (tree_logger) {
+        for (const int64_t i :
+             tree_logger->node_warnings.index_range().drop_front(old_warnings_num))
+        {
+          if (tree_logger->node_warnings[i].node_id == node_.identifier) {
+            cache_entry->warnings.append(tree_logger->node_warnings[i].warning);
+          }
+        }
+        for (const int64_t i : tree_logger->used_named_attributes.index_range().drop_front(
+                 old_used_named_attributes_num))
+        {
+          const geo_eval_log::GeoTreeLogger::AttributeUsageWithNode &item =
+              tree_logger->used_named_attributes[i];
+          if (item.node_id == node_.identifier) {
+            cache_entry->used_named_attributes.append({item.attribute_name, item.usage});
+          }
+        }
+      }
+      for (const GMutablePointer &value : cache_entry->outputs) {
+        if (value.get() != nullptr && !GeoNodeResultCache::value_can_be_cached(*value.type(),
+                                                                                value.get()))
+        {
+          return;
+        }
+      }
+      GeoNodeResultCache::get().add(*cache_key, std::move(cache_entry));
+    }
+  }
+
+  std::optional<GeoNodeResultCache::Key> get_result_cache_key(
+      const GeoNodesLFUserData &user_data) const
+  {
+    if (!use_result_cache_ || user_data.modifier_data == nullptr) {
+      return std::nullopt;
+    }
+    if (!USER_EXPERIMENTAL_TEST(&U, use_geometry_nodes_result_cache)) {
+      return std::nullopt;
+    }
+    return GeoNodeResultCache::Key{user_data.modifier_data->self_object->id.session_uuid,
+                                   node_.owner_tree().id.session_uuid,
+                                   user_data.compute_context->hash(),
+                                   node_.identifier};
+  }
+
+  /**
+   * Output the results of a previous execution of the node if all its inputs are the same.
+   */
+  bool try_use_cached_result(lf::Params &params,
+                             const GeoNodeResultCache::Key &key,
+                             geo_eval_log::GeoTreeLogger *tree_logger) const
+  {
+    const std::shared_ptr<const GeoNodeResultCache::Entry> entry =
+        GeoNodeResultCache::get().lookup(key);
+    if (!entry) {
+      return false;
+    }
+    if (tree_logger && !entry->has_log) {
+      return false;
+    }
+    if (entry->inputs.size() != inputs_.size() || entry->outputs.size() != outputs_.size()) {
+      return false;
+    }
+    if (!entry->node_settings_equal(node_)) {
+      return false;
+    }
+    for (const int i : inputs_.index_range()) {
+      const CPPType &type = *inputs_[i].type;
+      if (entry->inputs[i].type() != &type) {
+        return false;
+      }
+      if (!GeoNodeResultCache::values_equal(
+              type, entry->inputs[i].get(), params.try_get_input_data_ptr(i)))
+      {
+        return false;
+      }
+    }
+    Vector<int, 16> outputs_to_set;
+    for (const int i : outputs_.index_range()) {
+      if (params.get_output_usage(i) == lf::ValueUsage::Unused || params.output_was_set(i)) {
+        continue;
+      }
+      if (entry->outputs[i].get() == nullptr || entry->outputs[i].type() != outputs_[i].type) {
+        return false;
+      }
+      outputs_to_set.append(i);
+    }
+
+    for (const int i : outputs_to_set) {
+      outputs_[i].type->copy_construct(entry->outputs[i].get(), params.get_output_data_ptr(i));
+      params.output_set(i);
+    }
+    if (tree_logger) {
+      for (const geo_eval_log::NodeWarning &warning : entry->warnings) {
+        tree_logger->node_warnings.append({node_.identifier, warning});
+      }
+      for (const auto &[attribute_name, usage] : entry->used_named_attributes) {
+        tree_logger->used_named_attributes.append(
+            {node_.identifier, tree_logger->allocator->copy_string(attribute_name), usage});
+      }
+    }
+    return true;
+  }
+
+  /**
+   * Prepare a cache entry that stores a copy of the inputs before the node possibly moves them.
+   */
+  std::shared_ptr<GeoNodeResultCache::Entry> create_result_cache_entry(
+      lf::Params &params, const geo_eval_log::GeoTreeLogger *tree_logger) const
+  {
+    for (const int i : inputs_.index_range()) {
+      if (!GeoNodeResultCache::value_can_be_cached(*inputs_[i].type,
+                                                   params.try_get_input_data_ptr(i)))
+      {
+        return nullptr;
+      }
+    }
+    auto entry = std::make_shared<GeoNodeResultCache::Entry>(node_);
+    entry->has_log = tree_logger != nullptr;
+    for (const int i : inputs_.index_range()) {
+      entry->inputs.append(
+          copy_value_for_result_cache(*inputs_[i].type, params.try_get_input_data_ptr(i)));
+    }
+    for (const int i : outputs_.index_range()) {
+      entry->outputs.append({outputs_[i].type, nullptr});
+    }
+    return entry;
   }
 
   /**
@@ -1433,6 +1696,8 @@ struct ZoneBuildInfo {
 struct ZoneBodyFunction {
   const LazyFunction *function = nullptr;
   ZoneFunctionIndices indices;
+  /** Number of nodes in the body graph, not counting nodes in nested node groups or zones. */
+  int nodes_num = 0;
 };
 
 /**
@@ -1621,6 +1886,13 @@ class LazyFunctionForRepeatZone : public LazyFunction {
           params, eval_storage, node_storage, user_data, local_user_data);
     }
 
+    if (int64_t(eval_storage.lf_body_nodes.size()) * body_fn_.nodes_num > 1000) {
+      /* Even if every iteration is cheap, evaluating many of them takes a while. Since the
+       * iterations depend on each other, they can't be evaluated in parallel, but other work that
+       * is scheduled on this thread can be picked up by other threads in the meantime. */
+      lazy_threading::send_hint();
+    }
+
     /* Execute the graph for the repeat zone. */
     lf::RemappedParams eval_graph_params{*eval_storage.graph_executor,
                                          params,
@@ -2416,6 +2688,7 @@ struct GeometryNodesLazyFunctionBuilder {
     this->fix_link_cycles(lf_body_graph, graph_params.socket_usage_inputs);
 
     lf_body_graph.update_node_indices();
+    body_fn.nodes_num = lf_body_graph.nodes().size();
 
     auto &logger = scope_.construct<GeometryNodesLazyFunctionLogger>(*lf_graph_info_);
     auto &side_effect_provider = scope_.construct<GeometryNodesLazyFunctionSideEffectProvider>();
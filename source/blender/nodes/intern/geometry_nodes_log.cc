@@ -2,9 +2,13 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <sstream>
+
 #include "NOD_geometry_nodes_lazy_function.hh"
 #include "NOD_geometry_nodes_log.hh"
 
+#include "BLI_serialize.hh"
+
 #include "BKE_compute_contexts.hh"
 #include "BKE_curves.hh"
 #include "BKE_node_runtime.hh"
@@ -212,6 +216,26 @@ void GeoTreeLogger::log_viewer_node(const bNode &viewer_node, bke::GeometrySet g
   this->viewer_node_logs.append({viewer_node.identifier, std::move(log)});
 }
 
+void GeoTreeLogger::log_output_geometry_stats(const bNode &node, const bke::GeometrySet &geometry)
+{
+  OutputGeometryStats stats{node.identifier, 0, 0, geometry.attributes_memory_estimate()};
+  for (const bke::GeometryComponent *component : geometry.get_components()) {
+    switch (component->type()) {
+      case bke::GeometryComponent::Type::Mesh:
+      case bke::GeometryComponent::Type::PointCloud:
+      case bke::GeometryComponent::Type::Curve:
+        stats.points_num += component->attribute_domain_size(ATTR_DOMAIN_POINT);
+        break;
+      case bke::GeometryComponent::Type::Instance:
+        stats.instances_num += component->attribute_domain_size(ATTR_DOMAIN_INSTANCE);
+        break;
+      default:
+        break;
+    }
+  }
+  this->output_geometry_stats.append(stats);
+}
+
 void GeoTreeLog::ensure_node_warnings()
 {
   if (reduced_node_warnings_) {
@@ -464,6 +488,95 @@ GeoTreeLogger &GeoModifierLog::get_local_tree_logger(const ComputeContext &compu
   return tree_logger;
 }
 
+static const bNodeTree *find_tree_for_logger(
+    const ComputeContextHash &hash,
+    const Map<ComputeContextHash, destruct_ptr<GeoTreeLogger>> &tree_loggers,
+    const bNodeTree &root_tree,
+    Map<ComputeContextHash, const bNodeTree *> &r_tree_by_context)
+{
+  if (const bNodeTree *const *tree = r_tree_by_context.lookup_ptr(hash)) {
+    return *tree;
+  }
+  const GeoTreeLogger &tree_logger = *tree_loggers.lookup(hash);
+  const bNodeTree *tree = &root_tree;
+  if (tree_logger.parent_hash) {
+    /* Parent loggers are always created on the same thread as their children. */
+    tree = find_tree_for_logger(
+        *tree_logger.parent_hash, tree_loggers, root_tree, r_tree_by_context);
+    if (tree && tree_logger.group_node_id) {
+      const bNode *group_node = tree->node_by_id(*tree_logger.group_node_id);
+      tree = group_node ? reinterpret_cast<const bNodeTree *>(group_node->id) : nullptr;
+    }
+  }
+  r_tree_by_context.add(hash, tree);
+  return tree;
+}
+
+void GeoModifierLog::export_profile_json(const bNodeTree &root_tree, std::ostream &stream)
+{
+  using namespace io::serialize;
+
+  std::optional<TimePoint> first_start;
+  for (LocalData &local_data : data_per_thread_) {
+    for (const destruct_ptr<GeoTreeLogger> &tree_logger :
+         local_data.tree_logger_by_context.values())
+    {
+      for (const GeoTreeLogger::NodeExecutionTime &timing : tree_logger->node_execution_times) {
+        if (!first_start || timing.start < *first_start) {
+          first_start = timing.start;
+        }
+      }
+    }
+  }
+
+  DictionaryValue root;
+  ArrayValue &io_nodes = *root.append_array("nodes");
+  ArrayValue &io_geometries = *root.append_array("output_geometries");
+  Map<ComputeContextHash, const bNodeTree *> tree_by_context;
+  int thread_index = 0;
+  for (LocalData &local_data : data_per_thread_) {
+    for (const auto item : local_data.tree_logger_by_context.items()) {
+      const bNodeTree *tree = find_tree_for_logger(
+          item.key, local_data.tree_logger_by_context, root_tree, tree_by_context);
+      std::stringstream context_ss;
+      context_ss << item.key;
+      const std::string context_str = context_ss.str();
+
+      auto add_node_info = [&](DictionaryValue &io_node, const int32_t node_id) {
+        const bNode *node = tree ? tree->node_by_id(node_id) : nullptr;
+        io_node.append_str("tree", tree ? tree->id.name + 2 : "");
+        io_node.append_str("node", node ? node->name : "");
+        io_node.append_int("node_id", node_id);
+        io_node.append_str("context", context_str);
+      };
+
+      for (const GeoTreeLogger::NodeExecutionTime &timing : item.value->node_execution_times) {
+        DictionaryValue &io_node = *io_nodes.append_dict();
+        add_node_info(io_node, timing.node_id);
+        io_node.append_int("thread", thread_index);
+        const std::chrono::duration<double, std::milli> start = timing.start - *first_start;
+        const std::chrono::duration<double, std::milli> duration = timing.end - timing.start;
+        io_node.append_double("start_ms", start.count());
+        io_node.append_double("duration_ms", duration.count());
+        io_node.append("cached", std::make_shared<BooleanValue>(timing.used_cached_result));
+      }
+      for (const GeoTreeLogger::OutputGeometryStats &stats : item.value->output_geometry_stats) {
+        DictionaryValue &io_geometry = *io_geometries.append_dict();
+        add_node_info(io_geometry, stats.node_id);
+        io_geometry.append_int("points", stats.points_num);
+        io_geometry.append_int("instances", stats.instances_num);
+        io_geometry.append_int("memory", stats.memory);
+      }
+    }
+    thread_index++;
+  }
+  root.append_int("threads", thread_index);
+
+  JsonFormatter formatter;
+  formatter.indentation_len = 2;
+  formatter.serialize(stream, root);
+}
+
 GeoTreeLog &GeoModifierLog::get_tree_log(const ComputeContextHash &compute_context_hash)
 {
   GeoTreeLog &reduced_tree_log = *tree_logs_.lookup_or_add_cb(compute_context_hash, [&]() {
@@ -0,0 +1,237 @@
+/* SPDX-FileCopyrightText: 2023 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "NOD_geometry_nodes_result_cache.hh"
+
+#include "MEM_guardedalloc.h"
+
+#include "DNA_node_types.h"
+
+#include "BKE_anonymous_attribute_id.hh"
+#include "BKE_geometry_set.hh"
+#include "BKE_node_runtime.hh"
+#include "BKE_node_socket_value_cpp_type.hh"
+
+#include "RNA_access.hh"
+#include "RNA_prototypes.h"
+
+namespace blender::nodes {
+
+using bke::ValueOrFieldCPPType;
+
+/**
+ * The settings of a node are stored in generic DNA members and in its storage, which may also
+ * contain pointers and padding. Use the RNA properties defined by the node type instead, which
+ * expose exactly the settings that can be changed, and skip the properties shared by all nodes
+ * (like the name or the location) as well as pointers.
+ */
+static Vector<uint8_t> node_settings_snapshot(const bNode &node)
+{
+  Vector<uint8_t> settings;
+  auto append = [&](const void *src, const int64_t size) {
+    settings.extend(Span(static_cast<const uint8_t *>(src), size));
+  };
+  const StringRefNull idname = node.idname;
+  append(idname.c_str(), idname.size() + 1);
+
+  PointerRNA ptr = RNA_pointer_create(
+      const_cast<ID *>(&node.owner_tree().id), &RNA_Node, const_cast<bNode *>(&node));
+  RNA_STRUCT_BEGIN_SKIP_RNA_TYPE (&ptr, prop) {
+    if (RNA_struct_type_find_property(&RNA_Node, RNA_property_identifier(prop)) != nullptr) {
+      continue;
+    }
+    const int array_len = RNA_property_array_length(&ptr, prop);
+    const int values_num = std::max(array_len, 1);
+    switch (RNA_property_type(prop)) {
+      case PROP_BOOLEAN: {
+        Array<bool, 16> values(values_num);
+        if (array_len > 0) {
+          RNA_property_boolean_get_array(&ptr, prop, values.data());
+        }
+        else {
+          values[0] = RNA_property_boolean_get(&ptr, prop);
+        }
+        append(values.data(), values.as_span().size_in_bytes());
+        break;
+      }
+      case PROP_INT: {
+        Array<int, 16> values(values_num);
+        if (array_len > 0) {
+          RNA_property_int_get_array(&ptr, prop, values.data());
+        }
+        else {
+          values[0] = RNA_property_int_get(&ptr, prop);
+        }
+        append(values.data(), values.as_span().size_in_bytes());
+        break;
+      }
+      case PROP_FLOAT: {
+        Array<float, 16> values(values_num);
+        if (array_len > 0) {
+          RNA_property_float_get_array(&ptr, prop, values.data());
+        }
+        else {
+          values[0] = RNA_property_float_get(&ptr, prop);
+        }
+        append(values.data(), values.as_span().size_in_bytes());
+        break;
+      }
+      case PROP_ENUM: {
+        const int value = RNA_property_enum_get(&ptr, prop);
+        append(&value, sizeof(value));
+        break;
+      }
+      case PROP_STRING: {
+        int length = 0;
+        char *value = RNA_property_string_get_alloc(&ptr, prop, nullptr, 0, &length);
+        append(value, length + 1);
+        MEM_freeN(value);
+        break;
+      }
+      case PROP_POINTER:
+      case PROP_COLLECTION:
+        /* Nodes pointing to data-blocks are not cached. */
+        break;
+    }
+  }
+  RNA_STRUCT_END;
+  return settings;
+}
+
+static uint64_t node_settings_hash(const Span<uint8_t> settings)
+{
+  return get_default_hash(
+      StringRef(reinterpret_cast<const char *>(settings.data()), settings.size()));
+}
+
+GeoNodeResultCache::Entry::Entry(const bNode &node)
+    : node_settings(node_settings_snapshot(node)),
+      node_settings_hash(blender::nodes::node_settings_hash(node_settings))
+{
+}
+
+GeoNodeResultCache::Entry::~Entry()
+{
+  for (Vector<GMutablePointer> *values : {&this->inputs, &this->outputs}) {
+    for (GMutablePointer &value : *values) {
+      if (value.get() != nullptr) {
+        value.destruct();
+        MEM_freeN(value.get());
+      }
+    }
+  }
+}
+
+bool GeoNodeResultCache::Entry::node_settings_equal(const bNode &node) const
+{
+  const Vector<uint8_t> settings = node_settings_snapshot(node);
+  return blender::nodes::node_settings_hash(settings) == this->node_settings_hash &&
+         settings.as_span() == this->node_settings.as_span();
+}
+
+GeoNodeResultCache &GeoNodeResultCache::get()
+{
+  static GeoNodeResultCache cache;
+  return cache;
+}
+
+std::shared_ptr<const GeoNodeResultCache::Entry> GeoNodeResultCache::lookup(const Key &key)
+{
+  std::lock_guard lock{mutex_};
+  StoredEntry *stored_entry = entries_.lookup_ptr(key);
+  if (stored_entry == nullptr) {
+    return nullptr;
+  }
+  /* Move the entry to the end of the list of recently used entries. */
+  lru_keys_.splice(lru_keys_.end(), lru_keys_, stored_entry->lru_position);
+  return stored_entry->entry;
+}
+
+void GeoNodeResultCache::add(const Key &key, std::shared_ptr<Entry> entry)
+{
+  size_t memory = 0;
+  for (const GMutablePointer &value : entry->outputs) {
+    if (value.get() != nullptr && value.type()->is<bke::GeometrySet>()) {
+      memory += size_t(value.get<bke::GeometrySet>()->attributes_memory_estimate());
+    }
+  }
+  if (memory > memory_limit) {
+    return;
+  }
+  entry->memory = memory;
+
+  /* Free the removed entries after unlocking, since that may free geometry. */
+  Vector<std::shared_ptr<const Entry>> removed_entries;
+  std::lock_guard lock{mutex_};
+  if (std::optional<StoredEntry> old_entry = entries_.pop_try(key)) {
+    memory_ -= old_entry->entry->memory;
+    lru_keys_.erase(old_entry->lru_position);
+    removed_entries.append(std::move(old_entry->entry));
+  }
+  lru_keys_.push_back(key);
+  entries_.add_new(key, {std::move(entry), std::prev(lru_keys_.end())});
+  memory_ += memory;
+
+  while (memory_ > memory_limit) {
+    StoredEntry oldest_entry = entries_.pop(lru_keys_.front());
+    lru_keys_.pop_front();
+    memory_ -= oldest_entry.entry->memory;
+    removed_entries.append(std::move(oldest_entry.entry));
+  }
+}
+
+void GeoNodeResultCache::clear()
+{
+  Map<Key, StoredEntry> removed_entries;
+  std::lock_guard lock{mutex_};
+  removed_entries = std::move(entries_);
+  entries_.clear();
+  lru_keys_.clear();
+  memory_ = 0;
+}
+
+bool GeoNodeResultCache::values_equal(const CPPType &type, const void *a, const void *b)
+{
+  if (type.is<bke::GeometrySet>()) {
+    /* Components are never modified while they are shared with a cache entry, so comparing
+     * their addresses is enough. */
+    return static_cast<const bke::GeometrySet *>(a)->get_components() ==
+           static_cast<const bke::GeometrySet *>(b)->get_components();
+  }
+  if (type.is<bke::AnonymousAttributeSet>()) {
+    const std::shared_ptr<Set<std::string>> &names_a =
+        static_cast<const bke::AnonymousAttributeSet *>(a)->names;
+    const std::shared_ptr<Set<std::string>> &names_b =
+        static_cast<const bke::AnonymousAttributeSet *>(b)->names;
+    const bool empty_a = !names_a || names_a->is_empty();
+    const bool empty_b = !names_b || names_b->is_empty();
+    if (empty_a || empty_b) {
+      return empty_a && empty_b;
+    }
+    return *names_a == *names_b;
+  }
+  if (const ValueOrFieldCPPType *value_or_field_type = ValueOrFieldCPPType::get_from_self(type)) {
+    const bool is_field_a = value_or_field_type->is_field(a);
+    const bool is_field_b = value_or_field_type->is_field(b);
+    if (is_field_a || is_field_b) {
+      /* Field operations only compare equal when they are the same instance, so this mainly
+       * detects unchanged field inputs like the position. */
+      return is_field_a && is_field_b &&
+             *value_or_field_type->get_field_ptr(a) == *value_or_field_type->get_field_ptr(b);
+    }
+    return value_or_field_type->value.is_equal_or_false(value_or_field_type->get_value_ptr(a),
+                                                        value_or_field_type->get_value_ptr(b));
+  }
+  return type.is_equal_or_false(a, b);
+}
+
+bool GeoNodeResultCache::value_can_be_cached(const CPPType &type, const void *value)
+{
+  if (type.is<bke::GeometrySet>()) {
+    return static_cast<const bke::GeometrySet *>(value)->owns_direct_data();
+  }
+  return true;
+}
+
+}  // namespace blender::nodes
@@ -109,7 +109,6 @@ void GeoNodeExecParams::check_input_geometry_set(StringRef identifier,
 
 void GeoNodeExecParams::check_output_geometry_set(const GeometrySet &geometry_set) const
 {
-  UNUSED_VARS_NDEBUG(geometry_set);
 #ifdef DEBUG
   if (const bke::CurvesEditHints *curve_edit_hints = geometry_set.get_curve_edit_hints()) {
     /* If this is not valid, it's likely that the number of stored deformed points does not match
@@ -117,6 +116,9 @@ void GeoNodeExecParams::check_output_geometry_set(const GeometrySet &geometry_se
     BLI_assert(curve_edit_hints->is_valid());
   }
 #endif
+  if (geo_eval_log::GeoTreeLogger *tree_logger = this->get_local_tree_logger()) {
+    tree_logger->log_output_geometry_stats(node_, geometry_set);
+  }
 }
 
 const bNodeSocket *GeoNodeExecParams::find_available_socket(const StringRef name) const
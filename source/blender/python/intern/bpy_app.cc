@@ -559,6 +559,48 @@ static PyObject *bpy_app_help_text(PyObject * /*self*/, PyObject *args, PyObject
   return result;
 }
 
+static void bpy_app_memory_statistics_name_fn(const char *name,
+                                              const uint items,
+                                              const size_t len,
+                                              void *user_data)
+{
+  PyObject *by_name = static_cast<PyObject *>(user_data);
+  PyObject *item = PyTuple_New(2);
+  PyTuple_SET_ITEMS(item, PyLong_FromUnsignedLong(items), PyLong_FromSize_t(len));
+  PyDict_SetItemString(by_name, name, item);
+  Py_DECREF(item);
+}
+
+PyDoc_STRVAR(bpy_app_memory_statistics_doc,
+             ".. staticmethod:: memory_statistics()\n"
+             "\n"
+             "   Return statistics about the memory allocated by Blender.\n"
+             "\n"
+             "   :return: A dictionary with the bytes in use (``in_use``), "
+             "the peak bytes in use (``peak``), the number of allocated blocks (``blocks``) "
+             "and a dictionary mapping allocation names to a ``(blocks, bytes)`` tuple "
+             "(``by_name``). Allocation names are only known when Blender runs with "
+             "``--debug-memory``, otherwise ``by_name`` is empty.\n"
+             "   :rtype: dict\n");
+static PyObject *bpy_app_memory_statistics(PyObject * /*self*/)
+{
+  PyObject *by_name = PyDict_New();
+  MEM_foreach_name_stats(bpy_app_memory_statistics_name_fn, by_name);
+
+  PyObject *result = PyDict_New();
+  PyObject *item;
+  PyDict_SetItemString(result, "in_use", item = PyLong_FromSize_t(MEM_get_memory_in_use()));
+  Py_DECREF(item);
+  PyDict_SetItemString(result, "peak", item = PyLong_FromSize_t(MEM_get_peak_memory()));
+  Py_DECREF(item);
+  PyDict_SetItemString(
+      result, "blocks", item = PyLong_FromUnsignedLong(MEM_get_memory_blocks_in_use()));
+  Py_DECREF(item);
+  PyDict_SetItemString(result, "by_name", by_name);
+  Py_DECREF(by_name);
+  return result;
+}
+
 #if (defined(__GNUC__) && !defined(__clang__))
 #  pragma GCC diagnostic push
 #  pragma GCC diagnostic ignored "-Wcast-function-type"
@@ -573,6 +615,10 @@ static PyMethodDef bpy_app_methods[] = {
      (PyCFunction)bpy_app_help_text,
      METH_VARARGS | METH_KEYWORDS | METH_STATIC,
      bpy_app_help_text_doc},
+    {"memory_statistics",
+     (PyCFunction)bpy_app_memory_statistics,
+     METH_NOARGS | METH_STATIC,
+     bpy_app_memory_statistics_doc},
     {nullptr, nullptr, 0, nullptr},
 };
 
@@ -5424,6 +5424,28 @@ static bool foreach_compat_buffer(RawPropertyType raw_type, int attr_signed, con
   return false;
 }
 
+/**
+ * Buffers of the other floating point precision can be converted while accessing the raw data,
+ * which avoids accessing them as a Python sequence.
+ */
+static bool foreach_compat_buffer_float(RawPropertyType raw_type,
+                                        const char *format,
+                                        RawPropertyType *r_buffer_type)
+{
+  if (!ELEM(raw_type, PROP_RAW_FLOAT, PROP_RAW_DOUBLE) || format == nullptr) {
+    return false;
+  }
+  switch (*format) {
+    case 'f':
+      *r_buffer_type = PROP_RAW_FLOAT;
+      return true;
+    case 'd':
+      *r_buffer_type = PROP_RAW_DOUBLE;
+      return true;
+  }
+  return false;
+}
+
 static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
 {
   PyObject *item = nullptr;
@@ -5469,10 +5491,14 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
         /* Check if the buffer matches. */
 
         buffer_is_compat = foreach_compat_buffer(raw_type, attr_signed, buf.format);
+        RawPropertyType buffer_raw_type = raw_type;
+        if (!buffer_is_compat) {
+          buffer_is_compat = foreach_compat_buffer_float(raw_type, buf.format, &buffer_raw_type);
+        }
 
         if (buffer_is_compat) {
           ok = RNA_property_collection_raw_set(
-              nullptr, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
+              nullptr, &self->ptr, self->prop, attr, buf.buf, buffer_raw_type, tot);
         }
 
         PyBuffer_Release(&buf);
@@ -5530,10 +5556,14 @@ static PyObject *foreach_getset(BPy_PropertyRNA *self, PyObject *args, int set)
         /* Check if the buffer matches. */
 
         buffer_is_compat = foreach_compat_buffer(raw_type, attr_signed, buf.format);
+        RawPropertyType buffer_raw_type = raw_type;
+        if (!buffer_is_compat) {
+          buffer_is_compat = foreach_compat_buffer_float(raw_type, buf.format, &buffer_raw_type);
+        }
 
         if (buffer_is_compat) {
           ok = RNA_property_collection_raw_get(
-              nullptr, &self->ptr, self->prop, attr, buf.buf, raw_type, tot);
+              nullptr, &self->ptr, self->prop, attr, buf.buf, buffer_raw_type, tot);
         }
 
         PyBuffer_Release(&buf);
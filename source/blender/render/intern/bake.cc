@@ -59,6 +59,7 @@
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 
 #include "BKE_attribute.hh"
 #include "BKE_bvhutils.hh"
@@ -558,8 +559,6 @@ bool RE_bake_pixels_populate_from_objects(Mesh *me_low,
                                           Mesh *me_cage)
 {
   size_t i;
-  int primitive_id;
-  float u, v;
   float imat_low[4][4];
   bool is_cage = me_cage != nullptr;
   bool result = true;
@@ -613,56 +612,61 @@ bool RE_bake_pixels_populate_from_objects(Mesh *me_low,
     }
   }
 
-  for (i = 0; i < pixels_num; i++) {
-    float co[3];
-    float dir[3];
-    TriTessFace *tri_low;
-
-    primitive_id = pixel_array_from[i].primitive_id;
-
-    if (primitive_id == -1) {
-      pixel_array_to[i].primitive_id = -1;
-      continue;
-    }
-
-    u = pixel_array_from[i].uv[0];
-    v = pixel_array_from[i].uv[1];
-
-    /* calculate from low poly mesh cage */
-    if (is_custom_cage) {
-      calc_point_from_barycentric_cage(
-          tris_low, tris_cage, mat_low, mat_cage, primitive_id, u, v, co, dir);
-      tri_low = &tris_cage[primitive_id];
-    }
-    else if (is_cage) {
-      calc_point_from_barycentric_extrusion(
-          tris_cage, mat_low, imat_low, primitive_id, u, v, cage_extrusion, co, dir, true);
-      tri_low = &tris_cage[primitive_id];
-    }
-    else {
-      calc_point_from_barycentric_extrusion(
-          tris_low, mat_low, imat_low, primitive_id, u, v, cage_extrusion, co, dir, false);
-      tri_low = &tris_low[primitive_id];
-    }
-
-    /* cast ray */
-    if (!cast_ray_highpoly(treeData,
-                           tri_low,
-                           tris_high,
-                           pixel_array_from,
-                           pixel_array_to,
-                           mat_low,
-                           highpoly,
-                           co,
-                           dir,
-                           i,
-                           tot_highpoly,
-                           max_ray_distance))
-    {
-      /* if it fails mask out the original pixel array */
-      pixel_array_from[i].primitive_id = -1;
-    }
-  }
+  /* Every pixel only writes to its own elements of the pixel arrays, and ray casts into the BVH
+   * trees are safe from multiple threads. */
+  blender::threading::parallel_for(
+      blender::IndexRange(pixels_num), 1024, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          float co[3];
+          float dir[3];
+          TriTessFace *tri_low;
+
+          const int primitive_id = pixel_array_from[i].primitive_id;
+
+          if (primitive_id == -1) {
+            pixel_array_to[i].primitive_id = -1;
+            continue;
+          }
+
+          const float u = pixel_array_from[i].uv[0];
+          const float v = pixel_array_from[i].uv[1];
+
+          /* calculate from low poly mesh cage */
+          if (is_custom_cage) {
+            calc_point_from_barycentric_cage(
+                tris_low, tris_cage, mat_low, mat_cage, primitive_id, u, v, co, dir);
+            tri_low = &tris_cage[primitive_id];
+          }
+          else if (is_cage) {
+            calc_point_from_barycentric_extrusion(
+                tris_cage, mat_low, imat_low, primitive_id, u, v, cage_extrusion, co, dir, true);
+            tri_low = &tris_cage[primitive_id];
+          }
+          else {
+            calc_point_from_barycentric_extrusion(
+                tris_low, mat_low, imat_low, primitive_id, u, v, cage_extrusion, co, dir, false);
+            tri_low = &tris_low[primitive_id];
+          }
+
+          /* cast ray */
+          if (!cast_ray_highpoly(treeData,
+                                 tri_low,
+                                 tris_high,
+                                 pixel_array_from,
+                                 pixel_array_to,
+                                 mat_low,
+                                 highpoly,
+                                 co,
+                                 dir,
+                                 i,
+                                 tot_highpoly,
+                                 max_ray_distance))
+          {
+            /* if it fails mask out the original pixel array */
+            pixel_array_from[i].primitive_id = -1;
+          }
+        }
+      });
 
   /* garbage collection */
 cleanup:
@@ -736,19 +740,14 @@ void RE_bake_pixels_populate(Mesh *me,
     return;
   }
 
-  BakeDataZSpan bd;
-  bd.pixel_array = pixel_array;
-  bd.zspan = MEM_cnew_array<ZSpan>(targets->images_num, "bake zspan");
-
   /* initialize all pixel arrays so we know which ones are 'blank' */
-  for (int i = 0; i < pixels_num; i++) {
-    pixel_array[i].primitive_id = -1;
-    pixel_array[i].object_id = 0;
-  }
-
-  for (int i = 0; i < targets->images_num; i++) {
-    zbuf_alloc_span(&bd.zspan[i], targets->images[i].width, targets->images[i].height);
-  }
+  blender::threading::parallel_for(
+      blender::IndexRange(pixels_num), 4096, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          pixel_array[i].primitive_id = -1;
+          pixel_array[i].object_id = 0;
+        }
+      });
 
   const int tottri = poly_to_tri_count(me->faces_num, me->totloop);
   MLoopTri *looptri = static_cast<MLoopTri *>(MEM_mallocN(sizeof(*looptri) * tottri, __func__));
@@ -761,50 +760,62 @@ void RE_bake_pixels_populate(Mesh *me,
   const int *material_indices = BKE_mesh_material_indices(me);
   const int materials_num = targets->materials_num;
 
-  for (int i = 0; i < tottri; i++) {
-    const MLoopTri *lt = &looptri[i];
-    const int face_i = looptri_faces[i];
-
-    bd.primitive_id = i;
-
-    /* Find images matching this material. */
-    const int material_index = (material_indices && materials_num) ?
-                                   clamp_i(material_indices[face_i], 0, materials_num - 1) :
-                                   0;
-    Image *image = targets->material_to_image[material_index];
-    for (int image_id = 0; image_id < targets->images_num; image_id++) {
-      BakeImage *bk_image = &targets->images[image_id];
-      if (bk_image->image != image) {
-        continue;
-      }
-
-      /* Compute triangle vertex UV coordinates. */
-      float vec[3][2];
-      for (int a = 0; a < 3; a++) {
-        const float *uv = mloopuv[lt->tri[a]];
-
-        /* NOTE(@ideasman42): workaround for pixel aligned UVs which are common and can screw
-         * up our intersection tests where a pixel gets in between 2 faces or the middle of a quad,
-         * camera aligned quads also have this problem but they are less common.
-         * Add a small offset to the UVs, fixes bug #18685. */
-        vec[a][0] = (uv[0] - bk_image->uv_offset[0]) * float(bk_image->width) - (0.5f + 0.001f);
-        vec[a][1] = (uv[1] - bk_image->uv_offset[1]) * float(bk_image->height) - (0.5f + 0.002f);
-      }
-
-      /* Rasterize triangle. */
-      bd.bk_image = bk_image;
-      bake_differentials(&bd, vec[0], vec[1], vec[2]);
-      zspan_scanconvert(
-          &bd.zspan[image_id], (void *)&bd, vec[0], vec[1], vec[2], store_bake_pixel);
-    }
-  }
-
-  for (int i = 0; i < targets->images_num; i++) {
-    zbuf_free_span(&bd.zspan[i]);
-  }
+  /* Every image writes to its own range of the pixel array, so the images (e.g. UDIM tiles) can
+   * be rasterized in parallel. Triangles of one image are still rasterized in order, so that
+   * overlapping UVs keep giving the same result. */
+  blender::threading::parallel_for(
+      blender::IndexRange(targets->images_num), 1, [&](const blender::IndexRange range) {
+        for (const int image_id : range) {
+          BakeImage *bk_image = &targets->images[image_id];
+
+          ZSpan zspan;
+          zbuf_alloc_span(&zspan, bk_image->width, bk_image->height);
+
+          BakeDataZSpan bd;
+          bd.pixel_array = pixel_array;
+          bd.bk_image = bk_image;
+          bd.zspan = &zspan;
+
+          for (int i = 0; i < tottri; i++) {
+            const MLoopTri *lt = &looptri[i];
+            const int face_i = looptri_faces[i];
+
+            /* Skip triangles whose material is not baked to this image. */
+            const int material_index =
+                (material_indices && materials_num) ?
+                    clamp_i(material_indices[face_i], 0, materials_num - 1) :
+                    0;
+            if (targets->material_to_image[material_index] != bk_image->image) {
+              continue;
+            }
+
+            bd.primitive_id = i;
+
+            /* Compute triangle vertex UV coordinates. */
+            float vec[3][2];
+            for (int a = 0; a < 3; a++) {
+              const float *uv = mloopuv[lt->tri[a]];
+
+              /* NOTE(@ideasman42): workaround for pixel aligned UVs which are common and can screw
+               * up our intersection tests where a pixel gets in between 2 faces or the middle of a
+               * quad, camera aligned quads also have this problem but they are less common.
+               * Add a small offset to the UVs, fixes bug #18685. */
+              vec[a][0] = (uv[0] - bk_image->uv_offset[0]) * float(bk_image->width) -
+                          (0.5f + 0.001f);
+              vec[a][1] = (uv[1] - bk_image->uv_offset[1]) * float(bk_image->height) -
+                          (0.5f + 0.002f);
+            }
+
+            /* Rasterize triangle. */
+            bake_differentials(&bd, vec[0], vec[1], vec[2]);
+            zspan_scanconvert(&zspan, (void *)&bd, vec[0], vec[1], vec[2], store_bake_pixel);
+          }
+
+          zbuf_free_span(&zspan);
+        }
+      });
 
   MEM_freeN(looptri);
-  MEM_freeN(bd.zspan);
 }
 
 /* ******************** NORMALS ************************ */
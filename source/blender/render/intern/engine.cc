@@ -9,6 +9,7 @@
 #include <cstddef>
 #include <cstdlib>
 #include <cstring>
+#include <string>
 
 #include "MEM_guardedalloc.h"
 
@@ -18,6 +19,7 @@
 #include "BLI_listbase.h"
 #include "BLI_math_bits.h"
 #include "BLI_rect.h"
+#include "BLI_set.hh"
 #include "BLI_string.h"
 #include "BLI_utildefines.h"
 
@@ -350,12 +352,14 @@ RenderResult *RE_engine_begin_result(
   return result;
 }
 
-static void re_ensure_passes_allocated_thread_safe(Render *re)
+/* Allocate the passes of the layers which are being merged from the partial result. Passes of
+ * view layers which did not render yet stay unallocated until they do. */
+static void re_ensure_passes_allocated_thread_safe(Render *re, const RenderResult *result)
 {
   if (!re->result->passes_allocated) {
     BLI_rw_mutex_lock(&re->resultmutex, THREAD_LOCK_WRITE);
     if (!re->result->passes_allocated) {
-      render_result_passes_allocated_ensure(re->result);
+      render_result_passes_allocated_ensure_for_part(re->result, result);
     }
     BLI_rw_mutex_unlock(&re->resultmutex);
   }
@@ -371,7 +375,7 @@ void RE_engine_update_result(RenderEngine *engine, RenderResult *result)
   Render *re = engine->re;
 
   if (result) {
-    re_ensure_passes_allocated_thread_safe(re);
+    re_ensure_passes_allocated_thread_safe(re, result);
     render_result_merge(re->result, result);
     result->renlay = static_cast<RenderLayer *>(
         result->layers.first); /* weak, draws first layer always */
@@ -427,7 +431,7 @@ void RE_engine_end_result(
 
   if (!cancel || merge_results) {
     if (!(re->test_break() && (re->r.scemode & R_BUTS_PREVIEW))) {
-      re_ensure_passes_allocated_thread_safe(re);
+      re_ensure_passes_allocated_thread_safe(re, result);
       render_result_merge(re->result, result);
     }
 
@@ -889,7 +893,9 @@ static void engine_render_view_layer(Render *re,
   /* Optionally composite grease pencil over render result.
    * Only do it if the passes are allocated (and the engine will not override the grease pencil
    * when reading its result from EXR file and writing to the Blender side. */
-  if (engine->has_grease_pencil && use_grease_pencil && re->result->passes_allocated) {
+  if (engine->has_grease_pencil && use_grease_pencil &&
+      render_result_layer_passes_allocated(re->result, view_layer_iter->name))
+  {
     /* NOTE: External engine might have been requested to free its
      * dependency graph, which is only allowed if there is no grease
      * pencil (pipeline is taking care of that). */
@@ -1027,7 +1033,7 @@ bool RE_engine_render(Render *re, bool do_all)
   re->draw_unlock();
 
   /* Render view layers. */
-  bool delay_grease_pencil = false;
+  blender::Set<std::string> delayed_grease_pencil_layers;
 
   if (type->render) {
     FOREACH_VIEW_LAYER_TO_RENDER_BEGIN (re, view_layer_iter) {
@@ -1036,7 +1042,11 @@ bool RE_engine_render(Render *re, bool do_all)
       /* If render passes are not allocated the render engine deferred final pixels write for
        * later. Need to defer the grease pencil for until after the engine has written the
        * render result to Blender. */
-      delay_grease_pencil = engine->has_grease_pencil && !re->result->passes_allocated;
+      if (engine->has_grease_pencil &&
+          !render_result_layer_passes_allocated(re->result, view_layer_iter->name))
+      {
+        delayed_grease_pencil_layers.add(view_layer_iter->name);
+      }
 
       if (RE_engine_test_break(engine)) {
         break;
@@ -1050,8 +1060,11 @@ bool RE_engine_render(Render *re, bool do_all)
   }
 
   /* Perform delayed grease pencil rendering. */
-  if (delay_grease_pencil) {
+  if (!delayed_grease_pencil_layers.is_empty()) {
     FOREACH_VIEW_LAYER_TO_RENDER_BEGIN (re, view_layer_iter) {
+      if (!delayed_grease_pencil_layers.contains(view_layer_iter->name)) {
+        continue;
+      }
       engine_render_view_layer(re, engine, view_layer_iter, false, true);
       if (RE_engine_test_break(engine)) {
         break;
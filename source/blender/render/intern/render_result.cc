@@ -167,9 +167,20 @@ void render_result_views_shallowdelete(RenderResult *rr)
 /** \name New
  * \{ */
 
+static bool render_layer_pass_needs_allocation(const RenderLayer *rl, const RenderPass *rp)
+{
+  /* For save buffers, only the combined pass is kept in memory. */
+  return rl->exrhandle == nullptr || STREQ(rp->name, RE_PASSNAME_COMBINED);
+}
+
+static bool render_layer_pass_is_allocated(const RenderPass *rp)
+{
+  return rp->ibuf && rp->ibuf->float_buffer.data;
+}
+
 static void render_layer_allocate_pass(RenderResult *rr, RenderPass *rp)
 {
-  if (rp->ibuf && rp->ibuf->float_buffer.data) {
+  if (render_layer_pass_is_allocated(rp)) {
     return;
   }
 
@@ -351,7 +362,7 @@ void render_result_passes_allocated_ensure(RenderResult *rr)
 
   LISTBASE_FOREACH (RenderLayer *, rl, &rr->layers) {
     LISTBASE_FOREACH (RenderPass *, rp, &rl->passes) {
-      if (rl->exrhandle != nullptr && !STREQ(rp->name, RE_PASSNAME_COMBINED)) {
+      if (!render_layer_pass_needs_allocation(rl, rp)) {
         continue;
       }
 
@@ -362,6 +373,53 @@ void render_result_passes_allocated_ensure(RenderResult *rr)
   rr->passes_allocated = true;
 }
 
+void render_result_passes_allocated_ensure_for_part(RenderResult *rr, const RenderResult *rrpart)
+{
+  if (rr == nullptr) {
+    return;
+  }
+
+  bool all_allocated = true;
+  LISTBASE_FOREACH (RenderLayer *, rl, &rr->layers) {
+    const bool is_in_part = BLI_findstring(
+                                &rrpart->layers, rl->name, offsetof(RenderLayer, name)) != nullptr;
+    LISTBASE_FOREACH (RenderPass *, rp, &rl->passes) {
+      if (!render_layer_pass_needs_allocation(rl, rp)) {
+        continue;
+      }
+
+      if (is_in_part) {
+        render_layer_allocate_pass(rr, rp);
+      }
+      else if (!render_layer_pass_is_allocated(rp)) {
+        all_allocated = false;
+      }
+    }
+  }
+
+  rr->passes_allocated = all_allocated;
+}
+
+bool render_result_layer_passes_allocated(const RenderResult *rr, const char *layername)
+{
+  if (rr->passes_allocated) {
+    return true;
+  }
+
+  const RenderLayer *rl = static_cast<const RenderLayer *>(
+      BLI_findstring(&rr->layers, layername, offsetof(RenderLayer, name)));
+  if (rl == nullptr) {
+    return false;
+  }
+
+  LISTBASE_FOREACH (const RenderPass *, rp, &rl->passes) {
+    if (render_layer_pass_needs_allocation(rl, rp) && !render_layer_pass_is_allocated(rp)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void render_result_clone_passes(Render *re, RenderResult *rr, const char *viewname)
 {
   LISTBASE_FOREACH (RenderLayer *, rl, &rr->layers) {
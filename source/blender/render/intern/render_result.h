@@ -42,6 +42,16 @@ struct RenderResult *render_result_new(struct Render *re,
                                        const char *viewname);
 
 void render_result_passes_allocated_ensure(struct RenderResult *rr);
+/**
+ * Only allocate the passes of the layers which are present in \a rrpart, so that the passes of
+ * view layers which did not render yet don't use memory.
+ */
+void render_result_passes_allocated_ensure_for_part(struct RenderResult *rr,
+                                                    const struct RenderResult *rrpart);
+/**
+ * Check whether the passes of the given layer are allocated.
+ */
+bool render_result_layer_passes_allocated(const struct RenderResult *rr, const char *layername);
 
 /**
  * From `imbuf`, if a handle was returned and
@@ -29,6 +29,11 @@ bool SEQ_proxy_rebuild_context(Main *bmain,
                                ListBase *queue,
                                bool build_only_on_bad_performance);
 void SEQ_proxy_rebuild(SeqIndexBuildContext *context, wmJobWorkerStatus *worker_status);
+/**
+ * Rebuild proxies and timecode indices of all #SeqIndexBuildContext in the queue (a list of
+ * #LinkData), building movie strips concurrently.
+ */
+void SEQ_proxy_rebuild_queue(ListBase *queue, wmJobWorkerStatus *worker_status);
 void SEQ_proxy_rebuild_finish(SeqIndexBuildContext *context, bool stop);
 void SEQ_proxy_set(Sequence *seq, bool value);
 bool SEQ_can_use_proxy(const SeqRenderData *context, Sequence *seq, int psize);
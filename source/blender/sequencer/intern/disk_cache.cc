@@ -29,6 +29,7 @@
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
 #include "BLI_path_util.h"
+#include "BLI_task.h"
 #include "BLI_threads.h"
 
 #include "BKE_main.h"
@@ -54,7 +55,8 @@
  * Multiple(DCACHE_IMAGES_PER_FILE) images share the same file.
  * Each of these files contains header DiskCacheHeader followed by image data.
  * ZLIB compression with user definable level can be used to compress image data(per image)
- * Images are written in order in which they are rendered.
+ * Images are written in order in which they are rendered, on a background thread so that
+ * compression and disk I/O don't stall rendering.
  * Overwriting of individual entry is not possible.
  * Stored images are deleted by invalidation, or when size of all files exceeds maximum
  * size specified in user preferences.
@@ -88,6 +90,14 @@ struct SeqDiskCache {
   ListBase files;
   ThreadMutex read_write_mutex;
   size_t size_total;
+  /* Serial background pool writing the images to disk. */
+  TaskPool *write_pool;
+};
+
+struct DiskCacheWriteTask {
+  char filepath[FILE_MAX];
+  float frame_index;
+  ImBuf *ibuf;
 };
 
 struct DiskCacheFile {
@@ -415,6 +425,9 @@ void seq_disk_cache_invalidate(SeqDiskCache *disk_cache,
   int start;
   int end;
 
+  /* Don't let pending writes store outdated images after invalidation. */
+  BLI_task_pool_work_and_wait(disk_cache->write_pool);
+
   BLI_mutex_lock(&disk_cache->read_write_mutex);
 
   start = SEQ_time_left_handle_frame_get(scene, seq_changed) - DCACHE_IMAGES_PER_FILE;
@@ -490,7 +503,9 @@ static size_t seq_disk_cache_write_header(FILE *file, DiskCacheHeader *header)
   return fwrite(header, sizeof(*header), 1, file);
 }
 
-static int seq_disk_cache_add_header_entry(SeqCacheKey *key, ImBuf *ibuf, DiskCacheHeader *header)
+static int seq_disk_cache_add_header_entry(float frame_index,
+                                           ImBuf *ibuf,
+                                           DiskCacheHeader *header)
 {
   int i;
   uint64_t offset = sizeof(*header);
@@ -523,7 +538,7 @@ static int seq_disk_cache_add_header_entry(SeqCacheKey *key, ImBuf *ibuf, DiskCa
   }
 
   header->entry[i].offset = offset;
-  header->entry[i].frameno = key->frame_index;
+  header->entry[i].frameno = frame_index;
 
   /* Store colorspace name of ibuf. */
   const char *colorspace_name;
@@ -551,13 +566,13 @@ static int seq_disk_cache_get_header_entry(SeqCacheKey *key, DiskCacheHeader *he
   return -1;
 }
 
-bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf *ibuf)
+static bool seq_disk_cache_write_file_ex(SeqDiskCache *disk_cache,
+                                         const char *filepath,
+                                         float frame_index,
+                                         ImBuf *ibuf)
 {
   BLI_mutex_lock(&disk_cache->read_write_mutex);
 
-  char filepath[FILE_MAX];
-
-  seq_disk_cache_get_file_path(disk_cache, key, filepath, sizeof(filepath));
   BLI_file_ensure_parent_dir_exists(filepath);
 
   /* Touch the file. */
@@ -582,7 +597,7 @@ bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf
     BLI_mutex_unlock(&disk_cache->read_write_mutex);
     return false;
   }
-  int entry_index = seq_disk_cache_add_header_entry(key, ibuf, &header);
+  int entry_index = seq_disk_cache_add_header_entry(frame_index, ibuf, &header);
 
   size_t bytes_written = deflate_imbuf_to_file(
       ibuf, file, seq_disk_cache_compression_level(), &header.entry[entry_index]);
@@ -604,6 +619,39 @@ bool seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf
   return false;
 }
 
+static void seq_disk_cache_write_task(TaskPool *__restrict pool, void *taskdata)
+{
+  SeqDiskCache *disk_cache = static_cast<SeqDiskCache *>(BLI_task_pool_user_data(pool));
+  DiskCacheWriteTask *task = static_cast<DiskCacheWriteTask *>(taskdata);
+
+  seq_disk_cache_write_file_ex(disk_cache, task->filepath, task->frame_index, task->ibuf);
+  seq_disk_cache_enforce_limits(disk_cache);
+}
+
+static void seq_disk_cache_write_task_free(TaskPool *__restrict /*pool*/, void *taskdata)
+{
+  DiskCacheWriteTask *task = static_cast<DiskCacheWriteTask *>(taskdata);
+  IMB_freeImBuf(task->ibuf);
+  MEM_freeN(task);
+}
+
+void seq_disk_cache_write_file(SeqDiskCache *disk_cache, SeqCacheKey *key, ImBuf *ibuf)
+{
+  /* Resolve the file path now, the strip and scene may be changed or freed before the write. */
+  DiskCacheWriteTask *task = static_cast<DiskCacheWriteTask *>(
+      MEM_callocN(sizeof(DiskCacheWriteTask), "DiskCacheWriteTask"));
+  seq_disk_cache_get_file_path(disk_cache, key, task->filepath, sizeof(task->filepath));
+  task->frame_index = key->frame_index;
+  task->ibuf = ibuf;
+  IMB_refImBuf(ibuf);
+
+  BLI_task_pool_push(disk_cache->write_pool,
+                     seq_disk_cache_write_task,
+                     task,
+                     true,
+                     seq_disk_cache_write_task_free);
+}
+
 ImBuf *seq_disk_cache_read_file(SeqDiskCache *disk_cache, SeqCacheKey *key)
 {
   BLI_mutex_lock(&disk_cache->read_write_mutex);
@@ -678,6 +726,7 @@ SeqDiskCache *seq_disk_cache_create(Main *bmain, Scene *scene)
       MEM_callocN(sizeof(SeqDiskCache), "SeqDiskCache"));
   disk_cache->bmain = bmain;
   BLI_mutex_init(&disk_cache->read_write_mutex);
+  disk_cache->write_pool = BLI_task_pool_create_background_serial(disk_cache, TASK_PRIORITY_LOW);
   seq_disk_cache_handle_versioning(disk_cache);
   seq_disk_cache_get_files(disk_cache, seq_disk_cache_base_dir());
   disk_cache->timestamp = scene->ed->disk_cache_timestamp;
@@ -687,6 +736,8 @@ SeqDiskCache *seq_disk_cache_create(Main *bmain, Scene *scene)
 
 void seq_disk_cache_free(SeqDiskCache *disk_cache)
 {
+  BLI_task_pool_work_and_wait(disk_cache->write_pool);
+  BLI_task_pool_free(disk_cache->write_pool);
   BLI_freelistN(&disk_cache->files);
   BLI_mutex_end(&disk_cache->read_write_mutex);
   MEM_freeN(disk_cache);
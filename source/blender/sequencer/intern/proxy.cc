@@ -8,6 +8,8 @@
  * \ingroup bke
  */
 
+#include <mutex>
+
 #include "MEM_guardedalloc.h"
 
 #include "DNA_anim_types.h"
@@ -20,6 +22,8 @@
 #include "BLI_path_util.h"
 #include "BLI_session_uuid.h"
 #include "BLI_string.h"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #ifdef WIN32
 #  include "BLI_winstuff.h"
@@ -581,6 +585,50 @@ void SEQ_proxy_rebuild(SeqIndexBuildContext *context, wmJobWorkerStatus *worker_
   }
 }
 
+void SEQ_proxy_rebuild_queue(ListBase *queue, wmJobWorkerStatus *worker_status)
+{
+  using namespace blender;
+  Vector<SeqIndexBuildContext *> movie_contexts;
+
+  LISTBASE_FOREACH (LinkData *, link, queue) {
+    SeqIndexBuildContext *context = static_cast<SeqIndexBuildContext *>(link->data);
+    if (context->seq->type == SEQ_TYPE_MOVIE && context->index_context) {
+      movie_contexts.append(context);
+      continue;
+    }
+
+    SEQ_proxy_rebuild(context, worker_status);
+
+    if (worker_status->stop) {
+      return;
+    }
+  }
+
+  if (movie_contexts.size() == 1) {
+    /* Report progress of the single movie while it is being built. */
+    SEQ_proxy_rebuild(movie_contexts.first(), worker_status);
+    return;
+  }
+
+  /* Each movie is decoded and encoded from its own file handles, so multiple movies can be
+   * built concurrently. Progress is reported per finished movie. */
+  std::mutex progress_mutex;
+  int movies_finished = 0;
+  threading::parallel_for(movie_contexts.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      bool do_update = false;
+      float progress = 0.0f;
+      IMB_anim_index_rebuild(
+          movie_contexts[i]->index_context, &worker_status->stop, &do_update, &progress);
+
+      std::scoped_lock lock(progress_mutex);
+      movies_finished++;
+      worker_status->progress = float(movies_finished) / movie_contexts.size();
+      worker_status->do_update = true;
+    }
+  });
+}
+
 void SEQ_proxy_rebuild_finish(SeqIndexBuildContext *context, bool stop)
 {
   if (context->index_context) {
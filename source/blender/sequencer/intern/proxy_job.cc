@@ -46,16 +46,11 @@ static void proxy_startjob(void *pjv, wmJobWorkerStatus *worker_status)
 {
   ProxyJob *pj = static_cast<ProxyJob *>(pjv);
 
-  LISTBASE_FOREACH (LinkData *, link, &pj->queue) {
-    SeqIndexBuildContext *context = static_cast<SeqIndexBuildContext *>(link->data);
-
-    SEQ_proxy_rebuild(context, worker_status);
+  SEQ_proxy_rebuild_queue(&pj->queue, worker_status);
 
-    if (worker_status->stop) {
-      pj->stop = true;
-      fprintf(stderr, "Canceling proxy rebuild on users request...\n");
-      break;
-    }
+  if (worker_status->stop) {
+    pj->stop = true;
+    fprintf(stderr, "Canceling proxy rebuild on users request...\n");
   }
 }
 
@@ -21,6 +21,7 @@
 #  include "BLI_math_geom.h"
 #  include "BLI_math_matrix.h"
 #  include "BLI_math_vector.h"
+#  include "BLI_task.hh"
 #  include "BLI_utildefines.h"
 
 #  include "BKE_cloth.hh"
@@ -33,9 +34,8 @@
 #    pragma GCC diagnostic ignored "-Wtype-limits"
 #  endif
 
-#  ifdef _OPENMP
-#    define CLOTH_OPENMP_LIMIT 512
-#  endif
+/* Minimum number of vertices for multi-threading the sparse matrix operations. */
+#  define CLOTH_OPENMP_LIMIT 512
 
 //#define DEBUG_TIME
 
@@ -590,25 +590,23 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
   uint vcount = from[0].vcount;
   lfVector *temp = create_lfvector(vcount);
 
-  zero_lfvector(to, vcount);
-
-#  pragma omp parallel sections if (vcount > CLOTH_OPENMP_LIMIT)
-  {
-#  pragma omp section
-    {
-      for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
-        /* This is the lower triangle of the sparse matrix,
-         * therefore multiplication occurs with transposed sub-matrices. */
-        muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
-      }
-    }
-#  pragma omp section
-    {
-      for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
-        muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
-      }
-    }
-  }
+  /* The two halves write to separate vectors and are summed afterwards. Each half is computed in
+   * a fixed order, so the result does not depend on the scheduling. */
+  blender::threading::parallel_invoke(
+      vcount > CLOTH_OPENMP_LIMIT,
+      [&]() {
+        zero_lfvector(to, vcount);
+        for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
+          /* This is the lower triangle of the sparse matrix,
+           * therefore multiplication occurs with transposed sub-matrices. */
+          muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
+        }
+      },
+      [&]() {
+        for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
+          muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
+        }
+      });
   add_lfvector_lfvector(to, to, temp, from[0].vcount);
 
   del_lfvector(temp);
@@ -860,6 +860,7 @@ static void file_read_reports_finalize(BlendFileReadReport *bf_reports)
 {
   double duration_whole_minutes, duration_whole_seconds;
   double duration_libraries_minutes, duration_libraries_seconds;
+  double duration_versioning_minutes, duration_versioning_seconds;
   double duration_lib_override_minutes, duration_lib_override_seconds;
   double duration_lib_override_resync_minutes, duration_lib_override_resync_seconds;
   double duration_lib_override_recursive_resync_minutes,
@@ -877,6 +878,12 @@ static void file_read_reports_finalize(BlendFileReadReport *bf_reports)
                                   &duration_libraries_minutes,
                                   &duration_libraries_seconds,
                                   nullptr);
+  BLI_math_time_seconds_decompose(bf_reports->duration.versioning,
+                                  nullptr,
+                                  nullptr,
+                                  &duration_versioning_minutes,
+                                  &duration_versioning_seconds,
+                                  nullptr);
   BLI_math_time_seconds_decompose(bf_reports->duration.lib_overrides,
                                   nullptr,
                                   nullptr,
@@ -903,6 +910,11 @@ static void file_read_reports_finalize(BlendFileReadReport *bf_reports)
             " * Loading libraries: %.0fm%.2fs",
             duration_libraries_minutes,
             duration_libraries_seconds);
+  CLOG_INFO(&LOG,
+            0,
+            " * Versioning: %.0fm%.2fs",
+            duration_versioning_minutes,
+            duration_versioning_seconds);
   CLOG_INFO(&LOG,
             0,
             " * Applying overrides: %.0fm%.2fs",
@@ -2088,8 +2100,53 @@ static void wm_autosave_location(char filepath[FILE_MAX])
   BLI_path_join(filepath, FILE_MAX, tempdir_base, filename);
 }
 
+struct AutosaveWriteJob {
+  char filepath[FILE_MAX];
+  /** Copy of the undo memfile, owned by the job. */
+  MemFile memfile;
+};
+
+static void wm_autosave_write_job_exec(void *customdata, wmJobWorkerStatus * /*worker_status*/)
+{
+  AutosaveWriteJob *job = static_cast<AutosaveWriteJob *>(customdata);
+  BLO_memfile_write_file(&job->memfile, job->filepath);
+}
+
+static void wm_autosave_write_job_free(void *customdata)
+{
+  AutosaveWriteJob *job = static_cast<AutosaveWriteJob *>(customdata);
+  BLO_memfile_free(&job->memfile);
+  MEM_freeN(job);
+}
+
+/**
+ * Write the undo memfile in a background job, so that the UI is only blocked by copying the
+ * memfile (undo steps may be freed while the job is running), not by the disk access.
+ */
+static void wm_autosave_write_memfile_job(wmWindowManager *wm,
+                                          const MemFile *memfile,
+                                          const char *filepath)
+{
+  AutosaveWriteJob *job = MEM_cnew<AutosaveWriteJob>(__func__);
+  STRNCPY(job->filepath, filepath);
+  BLO_memfile_copy_flat(memfile, &job->memfile);
+
+  wmJob *wm_job = WM_jobs_get(
+      wm, nullptr, wm, "Auto-Save", eWM_JobFlag(0), WM_JOB_TYPE_AUTOSAVE);
+  WM_jobs_customdata_set(wm_job, job, wm_autosave_write_job_free);
+  WM_jobs_timer(wm_job, 0.1, 0, 0);
+  WM_jobs_callbacks(wm_job, wm_autosave_write_job_exec, nullptr, nullptr, nullptr);
+  WM_jobs_start(wm, wm_job);
+}
+
 static void wm_autosave_write(Main *bmain, wmWindowManager *wm)
 {
+  if (WM_jobs_test(wm, wm, WM_JOB_TYPE_AUTOSAVE)) {
+    /* The previous auto-save is still being written, skip this one. Both write paths use the
+     * same temporary file next to the auto-save file, so they must never run at the same time. */
+    return;
+  }
+
   char filepath[FILE_MAX];
 
   wm_autosave_location(filepath);
@@ -2098,7 +2155,7 @@ static void wm_autosave_write(Main *bmain, wmWindowManager *wm)
   const bool use_memfile = (U.uiflag & USER_GLOBALUNDO) != 0;
   MemFile *memfile = use_memfile ? ED_undosys_stack_memfile_get_active(wm->undo_stack) : nullptr;
   if (memfile != nullptr) {
-    BLO_memfile_write_file(memfile, filepath);
+    wm_autosave_write_memfile_job(wm, memfile, filepath);
   }
   else {
     if (use_memfile) {
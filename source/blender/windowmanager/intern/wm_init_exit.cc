@@ -30,6 +30,8 @@
 #include "BLI_timer.h"
 #include "BLI_utildefines.h"
 
+#include "PIL_time.h"
+
 #include "BLO_undofile.hh"
 #include "BLO_writefile.hh"
 
@@ -130,8 +132,38 @@ CLG_LOGREF_DECLARE_GLOBAL(WM_LOG_TOOLS, "wm.tool");
 CLG_LOGREF_DECLARE_GLOBAL(WM_LOG_MSGBUS_PUB, "wm.msgbus.pub");
 CLG_LOGREF_DECLARE_GLOBAL(WM_LOG_MSGBUS_SUB, "wm.msgbus.sub");
 
+static CLG_LogRef LOG_INIT = {"wm.init"};
+
 static void wm_init_scripts_extensions_once(bContext *C);
 
+/**
+ * Report the time spent in each phase of #WM_init, enabled with `--log "wm.init"`.
+ */
+struct WMInitTimer {
+  double time_start;
+  double time_phase;
+
+  WMInitTimer() : time_start(PIL_check_seconds_timer()), time_phase(time_start) {}
+
+  void phase_end(const char *phase)
+  {
+    if (!CLOG_CHECK(&LOG_INIT, 1)) {
+      return;
+    }
+    const double time = PIL_check_seconds_timer();
+    CLOG_INFO(&LOG_INIT, 1, "%s: %.3fs", phase, time - time_phase);
+    time_phase = time;
+  }
+
+  void end()
+  {
+    if (!CLOG_CHECK(&LOG_INIT, 1)) {
+      return;
+    }
+    CLOG_INFO(&LOG_INIT, 1, "Total: %.3fs", PIL_check_seconds_timer() - time_start);
+  }
+};
+
 static bool wm_start_with_console = false;
 
 void WM_init_state_start_with_console_set(bool value)
@@ -200,6 +232,7 @@ static void sound_jack_sync_callback(Main *bmain, int mode, double time)
 
 void WM_init(bContext *C, int argc, const char **argv)
 {
+  WMInitTimer timer;
 
   if (!G.background) {
     wm_ghost_init(C); /* NOTE: it assigns C to ghost! */
@@ -234,6 +267,8 @@ void WM_init(bContext *C, int argc, const char **argv)
 
   ED_node_init_butfuncs();
 
+  timer.phase_end("Types & callbacks");
+
   BLF_init();
 
   BLT_lang_init();
@@ -241,6 +276,8 @@ void WM_init(bContext *C, int argc, const char **argv)
    * since versioning code may create new IDs. See #57066. */
   BLT_lang_set(nullptr);
 
+  timer.phase_end("Fonts & translations");
+
   /* Init icons & previews before reading .blend files for preview icons, which can
    * get triggered by the depsgraph. This is also done in background mode
    * for scripts that do background processing with preview icons. */
@@ -250,9 +287,12 @@ void WM_init(bContext *C, int argc, const char **argv)
   WM_msgbus_types_init();
 
   /* Studio-lights needs to be init before we read the home-file,
-   * otherwise the versioning cannot find the default studio-light. */
+   * otherwise the versioning cannot find the default studio-light.
+   * The studio-light folders are only scanned on first access. */
   BKE_studiolight_init();
 
+  timer.phase_end("Icons & studio-lights");
+
   BLI_assert((G.fileflags & G_FILE_NO_UI) == 0);
 
   /**
@@ -284,6 +324,8 @@ void WM_init(bContext *C, int argc, const char **argv)
 
   wm_homefile_read_ex(C, &read_homefile_params, nullptr, &params_file_read_post);
 
+  timer.phase_end("Startup file & preferences");
+
   /* NOTE: leave `G_MAIN->filepath` set to an empty string since this
    * matches behavior after loading a new file. */
   BLI_assert(G_MAIN->filepath[0] == '\0');
@@ -311,6 +353,8 @@ void WM_init(bContext *C, int argc, const char **argv)
     UI_init();
     GPU_context_end_frame(GPU_context_active_get());
     GPU_render_end();
+
+    timer.phase_end("GPU & interface");
   }
 
   BKE_subdiv_init();
@@ -320,6 +364,8 @@ void WM_init(bContext *C, int argc, const char **argv)
 #ifdef WITH_PYTHON
   BPY_python_start(C, argc, argv);
   BPY_python_reset(C);
+
+  timer.phase_end("Python");
 #else
   UNUSED_VARS(argc, argv);
 #endif
@@ -358,7 +404,12 @@ void WM_init(bContext *C, int argc, const char **argv)
   WM_keyconfig_update_postpone_end();
   WM_keyconfig_update(static_cast<wmWindowManager *>(G_MAIN->wm.first));
 
+  timer.phase_end("Key-maps & add-ons");
+
   wm_homefile_read_post(C, params_file_read_post);
+
+  timer.phase_end("Startup file post-read");
+  timer.end();
 }
 
 static bool wm_init_splash_show_on_startup_check()
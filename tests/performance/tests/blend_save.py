@@ -0,0 +1,55 @@
+# SPDX-FileCopyrightText: 2023 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(args):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    bpy.ops.wm.open_mainfile(filepath=args['filepath'])
+
+    with tempfile.TemporaryDirectory() as temp_dir:
+        save_filepath = os.path.join(temp_dir, "save.blend")
+
+        # Save once to ensure any lazily computed data is ready.
+        bpy.ops.wm.save_as_mainfile(filepath=save_filepath, copy=True, compress=args['compress'])
+
+        # Measure saving the second time
+        start_time = time.time()
+        bpy.ops.wm.save_as_mainfile(filepath=save_filepath, copy=True, compress=args['compress'])
+        elapsed_time = time.time() - start_time
+
+    result = {'time': elapsed_time}
+    return result
+
+
+class BlendSaveTest(api.Test):
+    def __init__(self, filepath, compress):
+        self.filepath = filepath
+        self.compress = compress
+
+    def name(self):
+        if self.compress:
+            return self.filepath.stem + '_compressed'
+        return self.filepath.stem
+
+    def category(self):
+        return "blend_save"
+
+    def run(self, env, device_id):
+        args = {
+            'filepath': str(self.filepath),
+            'compress': self.compress,
+        }
+        result, _ = env.run_in_blender(_run, args)
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('*/*')
+    return [BlendSaveTest(filepath, compress) for filepath in filepaths for compress in (False, True)]